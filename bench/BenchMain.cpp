@@ -0,0 +1,656 @@
+#include "Benchmark.h"
+#include "SyntheticDataSources.h"
+#include "core/MetricTable.h"
+#include "core/AlertEngine.h"
+#include "core/AnomalyDetector.h"
+#include "core/SelfStats.h"
+#include "core/NameTable.h"
+#include "monitors/CPUMonitor.h"
+#include "monitors/RAMMonitor.h"
+#include "monitors/DiskMonitor.h"
+#include "monitors/NetworkMonitor.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/SchedMonitor.h"
+#include "monitors/NetStackMonitor.h"
+#include "monitors/ConnectionMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "monitors/FixtureDataSources.h"
+#ifdef _WIN32
+#include "monitors/WinDataSources.h"
+#endif
+#include "utils/SystemUtils.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    /**
+     * @struct MachineProfile
+     * @brief Size of a simulated machine
+     */
+    struct MachineProfile {
+        const char* name;
+        int cpus;
+        int interfaces;
+        int processes;
+    };
+
+    const MachineProfile PROFILES[] = {
+        {"small", 4, 1, 200},
+        {"medium", 64, 64, 2000},
+        {"huge", 512, 4000, 20000},
+    };
+
+    /**
+     * @brief Deterministic pseudo-random generator (same input on every run)
+     */
+    class Lcg {
+    public:
+        explicit Lcg(uint64_t seed) : m_state(seed) {}
+
+        uint64_t next() {
+            m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return m_state >> 33;
+        }
+
+        double nextDouble(double max) {
+            return static_cast<double>(next() % 1000000) / 1000000.0 * max;
+        }
+
+    private:
+        uint64_t m_state;
+    };
+
+    /**
+     * @brief Register the series a machine of this size would publish
+     */
+    void fillMetricTable(MetricTable& metrics, const MachineProfile& profile) {
+        metrics.addSeries(MetricId::CpuTotal);
+        metrics.addSeries(MetricId::RamUsage);
+        for (int i = 0; i < profile.cpus; i++) {
+            metrics.addSeries(MetricId::CpuCore, std::to_string(i));
+        }
+        for (int i = 0; i < profile.interfaces; i++) {
+            metrics.addSeries(MetricId::NetInterfaceDownload, "eth" + std::to_string(i));
+            metrics.addSeries(MetricId::NetInterfaceUpload, "eth" + std::to_string(i));
+        }
+        for (int i = 0; i < profile.processes; i++) {
+            metrics.addSeries("proc." + std::to_string(1000 + i) + ".cpu");
+        }
+    }
+
+    void benchFormatting(BenchmarkRunner& runner) {
+        Lcg rng(1);
+        std::vector<uint64_t> sizes(1024);
+        for (auto& size : sizes) {
+            size = rng.next() << (rng.next() % 24);
+        }
+
+        runner.run("format.bytes", sizes.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (uint64_t size : sizes) {
+                    std::wstring text = SystemUtils::formatBytes(size);
+                    BenchmarkRunner::doNotOptimize(text);
+                }
+            }
+        });
+
+        runner.run("format.speed", sizes.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (uint64_t size : sizes) {
+                    std::wstring text = SystemUtils::formatSpeed(static_cast<double>(size));
+                    BenchmarkRunner::doNotOptimize(text);
+                }
+            }
+        });
+
+        runner.run("format.percent", sizes.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (uint64_t size : sizes) {
+                    std::wstring text = SystemUtils::formatPercent(static_cast<double>(size % 10000) / 100.0);
+                    BenchmarkRunner::doNotOptimize(text);
+                }
+            }
+        });
+    }
+
+    void benchNames(BenchmarkRunner& runner) {
+        // Descriptions as a data source reads them every tick: all already interned
+        std::vector<std::string> descriptions;
+        for (int i = 0; i < 64; i++) {
+            descriptions.push_back("Intel(R) Ethernet Controller X710 for 10GbE SFP+ #" + std::to_string(i));
+            NameTable::intern(descriptions.back());
+        }
+
+        runner.run("names.intern", descriptions.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const std::string& description : descriptions) {
+                    NameId id = NameTable::intern(description.data(), description.size());
+                    BenchmarkRunner::doNotOptimize(id);
+                }
+            }
+        });
+
+        // What the same loop cost before interning
+        runner.run("names.convert", descriptions.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const std::string& description : descriptions) {
+                    std::wstring name = SystemUtils::stringToWstring(description);
+                    BenchmarkRunner::doNotOptimize(name);
+                }
+            }
+        });
+    }
+
+    void benchRates(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // Equivalent of NetworkMonitor::calculateSpeeds over every interface
+        Lcg rng(2);
+        size_t count = static_cast<size_t>(profile.interfaces) * 2;
+        std::vector<uint64_t> previous(count);
+        std::vector<uint64_t> current(count);
+        std::vector<double> rates(count);
+        for (size_t i = 0; i < count; i++) {
+            previous[i] = rng.next();
+            current[i] = previous[i] + rng.next() % 100000000;
+        }
+
+        runner.run(std::string("rate.interfaces/") + profile.name, count, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (size_t i = 0; i < count; i++) {
+                    rates[i] = SystemUtils::calculateRate(current[i], previous[i], 1.0);
+                }
+                BenchmarkRunner::doNotOptimize(rates);
+            }
+        });
+    }
+
+    void benchPublication(BenchmarkRunner& runner, const MachineProfile& profile) {
+        MetricTable metrics;
+        fillMetricTable(metrics, profile);
+        int count = metrics.seriesCount();
+
+        Lcg rng(3);
+        std::vector<double> sample(count);
+        for (auto& value : sample) {
+            value = rng.nextDouble(100.0);
+        }
+
+        runner.run(std::string("publish.set/") + profile.name, count, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (int i = 0; i < count; i++) {
+                    metrics.set(i, sample[i]);
+                }
+                BenchmarkRunner::doNotOptimize(metrics);
+            }
+        });
+
+        runner.run(std::string("publish.bulk/") + profile.name, count, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                metrics.setValues(sample.data(), count);
+                BenchmarkRunner::doNotOptimize(metrics);
+            }
+        });
+
+        // Every fixed schema metric, addressed the way collectors do it vs by name
+        std::vector<MetricId> fixed;
+        std::vector<std::string> fixedNames;
+        for (const MetricDef& def : METRIC_SCHEMA) {
+            if (!def.label) {
+                metrics.addSeries(def.id);
+                fixed.push_back(def.id);
+                fixedNames.push_back(def.name);
+            }
+        }
+
+        runner.run(std::string("publish.schema_id/") + profile.name, fixed.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (size_t i = 0; i < fixed.size(); i++) {
+                    metrics.set(fixed[i], sample[i % count]);
+                }
+                BenchmarkRunner::doNotOptimize(metrics);
+            }
+        });
+
+        runner.run(std::string("publish.by_name/") + profile.name, fixed.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (size_t i = 0; i < fixedNames.size(); i++) {
+                    metrics.set(metrics.findSeries(fixedNames[i]), sample[i % count]);
+                }
+                BenchmarkRunner::doNotOptimize(metrics);
+            }
+        });
+
+        runner.run(std::string("publish.self_stats/") + profile.name, 1, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                SelfStats::publish(metrics);
+            }
+        });
+    }
+
+    void benchCpuBreakdown(BenchmarkRunner& runner, const MachineProfile& profile) {
+        SyntheticCPUDataSource source(profile.cpus);
+        CPUTimes previous;
+        CPUTimes current;
+        CPUBreakdown breakdown;
+        previous.resize(profile.cpus);
+        current.resize(profile.cpus);
+        source.sample(previous);
+        source.sample(current);
+
+        runner.run(std::string("cpu.breakdown/") + profile.name, profile.cpus, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                CPUMonitor::computeBreakdown(previous, current, breakdown);
+                BenchmarkRunner::doNotOptimize(breakdown);
+            }
+        });
+    }
+
+    void benchCpuThermals(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // Full CPUMonitor tick with frequency and temperature sampling
+        CPUMonitor monitor(std::make_unique<SyntheticCPUDataSource>(profile.cpus),
+                           std::make_unique<SyntheticThermalDataSource>(profile.cpus > 64 ? 8 : 2));
+        monitor.initialize();
+
+        runner.run(std::string("cpu.update_thermals/") + profile.name, profile.cpus, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                monitor.update();
+                BenchmarkRunner::doNotOptimize(monitor.getThrottledCoreCount());
+            }
+        });
+    }
+
+    void benchInterruptParse(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // /proc/interrupts of this machine: a queue per CPU and interface
+        // (capped) plus the per-CPU architecture rows
+        Lcg rng(6);
+        std::ostringstream table;
+        for (int cpu = 0; cpu < profile.cpus; cpu++) {
+            table << "       CPU" << cpu;
+        }
+        table << "\n";
+        int queues = std::min(profile.cpus * profile.interfaces, 1024);
+        for (int irq = 0; irq < queues; irq++) {
+            table << " " << 32 + irq << ":";
+            for (int cpu = 0; cpu < profile.cpus; cpu++) {
+                table << " " << rng.next() % 100000000;
+            }
+            table << "  PCI-MSI " << irq << "-edge      eth" << irq / profile.cpus << "-TxRx-" << irq % profile.cpus << "\n";
+        }
+        for (const char* name : {"NMI", "LOC", "RES", "CAL", "TLB"}) {
+            table << name << ":";
+            for (int cpu = 0; cpu < profile.cpus; cpu++) {
+                table << " " << rng.next() % 100000000;
+            }
+            table << "  " << name << " interrupts\n";
+        }
+        table << "ERR: 0\nMIS: 0\n";
+        const std::string text = table.str();
+
+        InterruptCounters counters;
+        runner.run(std::string("irq.parse/") + profile.name, queues + 7, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                counters.reset(0);
+                InterruptMonitor::parseProcTable(text, false, counters);
+                BenchmarkRunner::doNotOptimize(counters);
+            }
+        });
+    }
+
+    void benchSchedParse(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // /proc/schedstat of this machine: a cpu line and two domain lines per CPU
+        Lcg rng(7);
+        std::ostringstream snapshot;
+        snapshot << "version 15\ntimestamp 4295000000\n";
+        for (int cpu = 0; cpu < profile.cpus; cpu++) {
+            snapshot << "cpu" << cpu << " 0 0";
+            for (int field = 0; field < 7; field++) {
+                snapshot << " " << rng.next() % 100000000000ULL;
+            }
+            snapshot << "\n";
+            for (int domain = 0; domain < 2; domain++) {
+                snapshot << "domain" << domain << " ffffffff";
+                for (int field = 0; field < 36; field++) {
+                    snapshot << " " << rng.next() % 100000;
+                }
+                snapshot << "\n";
+            }
+        }
+        const std::string text = snapshot.str();
+
+        SchedCounters counters;
+        counters.resize(profile.cpus);
+        runner.run(std::string("sched.parse/") + profile.name, profile.cpus, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                SchedMonitor::parseSchedstat(text, counters);
+                BenchmarkRunner::doNotOptimize(counters);
+            }
+        });
+    }
+
+    void benchNetStackParse(BenchmarkRunner& runner) {
+        // A /proc/net/snmp layout: six header/value table pairs
+        const char* const TABLES[][2] = {
+            {"Ip", "Forwarding DefaultTTL InReceives InHdrErrors InAddrErrors ForwDatagrams InUnknownProtos "
+                   "InDiscards InDelivers OutRequests OutDiscards OutNoRoutes ReasmTimeout ReasmReqds "
+                   "ReasmOKs ReasmFails FragOKs FragFails FragCreates"},
+            {"Icmp", "InMsgs InErrors InCsumErrors InDestUnreachs InTimeExcds OutMsgs OutErrors OutDestUnreachs"},
+            {"IcmpMsg", "InType3 OutType3"},
+            {"Tcp", "RtoAlgorithm RtoMin RtoMax MaxConn ActiveOpens PassiveOpens AttemptFails EstabResets "
+                    "CurrEstab InSegs OutSegs RetransSegs InErrs OutRsts InCsumErrors"},
+            {"Udp", "InDatagrams NoPorts InErrors OutDatagrams RcvbufErrors SndbufErrors InCsumErrors IgnoredMulti"},
+            {"UdpLite", "InDatagrams NoPorts InErrors OutDatagrams RcvbufErrors SndbufErrors InCsumErrors IgnoredMulti"},
+        };
+        Lcg rng(8);
+        std::ostringstream snapshot;
+        for (const auto& table : TABLES) {
+            snapshot << table[0] << ": " << table[1] << "\n" << table[0] << ":";
+            std::istringstream names(table[1]);
+            std::string name;
+            while (names >> name) {
+                snapshot << " " << rng.next() % 1000000000;
+            }
+            snapshot << "\n";
+        }
+        const std::string text = snapshot.str();
+
+        NetStackCounters counters;
+        SnmpTableParser parser(SnmpTableParser::SNMP_COLUMNS);
+        parser.bind(text, counters);
+        runner.run("netstack.parse", SnmpTableParser::SNMP_COLUMNS.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                parser.parse(text, counters);
+                BenchmarkRunner::doNotOptimize(counters);
+            }
+        });
+    }
+
+    void benchConnections(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // Five sockets per process: the huge profile dumps 100k connections
+        int connections = profile.processes * 5;
+        ConnectionMonitor monitor(std::make_unique<SyntheticConnectionDataSource>(connections));
+        monitor.initialize();
+        runner.run(std::string("conn.update/") + profile.name, connections, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                monitor.update();
+                BenchmarkRunner::doNotOptimize(monitor.getTopFlows());
+            }
+        });
+
+        // Byte counters read every fifth dump, as the IP Helper source does
+        ConnectionMonitor throttled(std::make_unique<SyntheticConnectionDataSource>(connections, 5));
+        throttled.initialize();
+        runner.run(std::string("conn.update_throttled/") + profile.name, connections, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                throttled.update();
+                BenchmarkRunner::doNotOptimize(throttled.getTopFlows());
+            }
+        });
+    }
+
+#ifdef _WIN32
+    void benchConnectionScan(BenchmarkRunner& runner) {
+        // This machine's sockets: every dump lists them, every fifth
+        // second one call per socket reads its byte counters
+        const CollectorStats& syscalls = SelfStats::probe("conn.collect_data");
+        ConnectionMonitor monitor(std::make_unique<WinConnectionDataSource>());
+        if (!monitor.initialize()) {
+            return;
+        }
+        runner.run("conn.scan/live", monitor.getConnectionCount(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                monitor.update();
+                BenchmarkRunner::doNotOptimize(monitor.getTopFlows());
+            }
+        }, &syscalls);
+    }
+#endif
+
+    void benchProcessIo(BenchmarkRunner& runner, const MachineProfile& profile) {
+        ProcessMonitor monitor(std::make_unique<SyntheticProcessDataSource>(profile.processes));
+        monitor.setMemoryBudget(0);     // I/O only; see process.memory
+        monitor.initialize();
+        runner.run(std::string("process.io/") + profile.name, profile.processes, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                monitor.update();
+                BenchmarkRunner::doNotOptimize(monitor.getTopWriters());
+            }
+        });
+    }
+
+#ifdef _WIN32
+    void benchProcessScan(BenchmarkRunner& runner) {
+        // This machine's processes: one snapshot call against three calls per handle
+        const CollectorStats& syscalls = SelfStats::probe("process.collect_io");
+        for (bool batched : {true, false}) {
+            WinProcessDataSource source(batched);
+            std::vector<ProcessCounters> processes;
+            uint64_t timestampUs = 0;
+            source.sample(processes, timestampUs);
+            runner.run(std::string("process.scan/") + (batched ? "batched" : "handles"), processes.size(),
+                       [&](uint64_t iterations) {
+                for (uint64_t it = 0; it < iterations; it++) {
+                    source.sample(processes, timestampUs);
+                    BenchmarkRunner::doNotOptimize(processes);
+                }
+            }, &syscalls);
+        }
+    }
+#endif
+
+    void benchProcessMemory(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // Page walks of up to 256 MB processes within the default budget
+        ProcessMonitor monitor(std::make_unique<SyntheticProcessDataSource>(profile.processes));
+        monitor.initialize();
+        runner.run(std::string("process.memory/") + profile.name, profile.processes, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                monitor.update();
+                BenchmarkRunner::doNotOptimize(monitor.getTopMemory());
+            }
+        });
+    }
+
+    void benchAnomaly(BenchmarkRunner& runner, const MachineProfile& profile) {
+        MetricTable metrics;
+        fillMetricTable(metrics, profile);
+        int count = metrics.seriesCount();
+        AnomalyDetector detector;
+
+        Lcg rng(4);
+        runner.run(std::string("anomaly.update/") + profile.name, count, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                metrics.set(static_cast<int>(rng.next() % count), rng.nextDouble(100.0));
+                detector.update(metrics);
+            }
+        });
+    }
+
+    void benchAlerts(BenchmarkRunner& runner, const MachineProfile& profile) {
+        MetricTable metrics;
+        fillMetricTable(metrics, profile);
+        int count = metrics.seriesCount();
+
+        // One rule per series, alternating rule shapes
+        std::vector<std::string> expressions;
+        for (int i = 0; i < count; i++) {
+            std::string series = metrics.seriesName(i);
+            switch (i % 3) {
+            case 0: expressions.push_back(series + " > 90 for 30s hysteresis 5"); break;
+            case 1: expressions.push_back(series + " < 5 falling"); break;
+            default: expressions.push_back(series + " > 50 rising for 1m"); break;
+            }
+        }
+
+        runner.run(std::string("alerts.parse/") + profile.name, expressions.size(), [&](uint64_t iterations) {
+            AlertRule rule;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const auto& expression : expressions) {
+                    AlertEngine::parseRule(expression, rule);
+                }
+                BenchmarkRunner::doNotOptimize(rule);
+            }
+        });
+
+        AlertEngine engine;
+        for (const auto& expression : expressions) {
+            engine.addRule(expression);
+        }
+
+        Lcg rng(5);
+        double now = 0.0;
+        runner.run(std::string("alerts.evaluate/") + profile.name, expressions.size(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                metrics.set(static_cast<int>(rng.next() % count), rng.nextDouble(100.0));
+                engine.evaluate(metrics, now);
+                now += 1.0;
+            }
+        });
+    }
+
+    void benchPipeline(BenchmarkRunner& runner, const MachineProfile& profile) {
+        // Full tick (collect, publish, score, alert) against generated data,
+        // driven through the Collector interface like MainWindow
+        CPUMonitor cpu(std::make_unique<SyntheticCPUDataSource>(profile.cpus));
+        RAMMonitor ram(std::make_unique<SyntheticMemoryDataSource>());
+        DiskMonitor disk(std::make_unique<SyntheticDiskDataSource>(4));
+        NetworkMonitor network(std::make_unique<SyntheticNetworkDataSource>(profile.interfaces));
+        Collector* const collectors[] = {&cpu, &ram, &disk, &network};
+
+        MetricTable metrics;
+        for (Collector* collector : collectors) {
+            collector->initialize();
+            collector->registerSeries(metrics);
+        }
+
+        AnomalyDetector detector;
+        detector.registerSeries(metrics);
+        AlertEngine engine;
+        engine.addRule("cpu.total > 90 for 30s hysteresis 10");
+        for (int i = 0; i < profile.cpus; i++) {
+            engine.addRule("cpu.core." + std::to_string(i) + " > 95 for 10s");
+        }
+
+        // One tick first so per-interface series exist before timing
+        auto tick = [&](double now) {
+            for (Collector* collector : collectors) {
+                collector->update();
+            }
+            for (Collector* collector : collectors) {
+                collector->publish(metrics);
+            }
+            detector.update(metrics);
+            detector.publish(metrics);
+            engine.evaluate(metrics, now);
+        };
+        double now = 0.0;
+        tick(now);
+
+        runner.run(std::string("pipeline.tick/") + profile.name, metrics.seriesCount(), [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                now += 0.0001;
+                tick(now);
+            }
+        });
+    }
+
+    void benchFixtureReplay(BenchmarkRunner& runner, const std::string& fixtureRoot) {
+        std::filesystem::path root(fixtureRoot);
+        if (!std::filesystem::exists(root / "cpu")) {
+            std::cerr << "Fixtures not found in " << fixtureRoot << ", skipping fixture.replay" << std::endl;
+            return;
+        }
+
+        CPUMonitor cpu(std::make_unique<FixtureCPUDataSource>(root));
+        RAMMonitor ram(std::make_unique<FixtureMemoryDataSource>(root));
+        DiskMonitor disk(std::make_unique<FixtureDiskDataSource>(root));
+        NetworkMonitor network(std::make_unique<FixtureNetworkDataSource>(root));
+        cpu.initialize();
+        ram.initialize();
+        disk.initialize();
+        network.initialize();
+
+        runner.run("fixture.replay", 4, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                cpu.update();
+                ram.update();
+                disk.update();
+                network.update();
+            }
+        });
+    }
+
+    void benchSelfStats(BenchmarkRunner& runner) {
+        CollectorStats& stats = SelfStats::probe("bench.scoped_timer");
+        runner.run("self.scoped_timer", 1, [&](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                ScopedTimer timer(stats);
+            }
+        });
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::string outPath;
+    std::string filter;
+    std::string fixtureRoot = "fixtures/basic";
+    double minTimeMs = 200.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--fixtures") == 0 && i + 1 < argc) {
+            fixtureRoot = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+            minTimeMs = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--out results.json] [--filter name] [--fixtures dir] [--min-time-ms N]" << std::endl;
+            return 1;
+        }
+    }
+
+    BenchmarkRunner runner(minTimeMs, filter);
+
+    benchFormatting(runner);
+    benchNames(runner);
+    benchSelfStats(runner);
+    benchFixtureReplay(runner, fixtureRoot);
+    benchNetStackParse(runner);
+#ifdef _WIN32
+    benchProcessScan(runner);
+    benchConnectionScan(runner);
+#endif
+    for (const MachineProfile& profile : PROFILES) {
+        benchRates(runner, profile);
+        benchPublication(runner, profile);
+        benchCpuBreakdown(runner, profile);
+        benchCpuThermals(runner, profile);
+        benchInterruptParse(runner, profile);
+        benchSchedParse(runner, profile);
+        benchConnections(runner, profile);
+        benchProcessIo(runner, profile);
+        benchProcessMemory(runner, profile);
+        benchAnomaly(runner, profile);
+        benchAlerts(runner, profile);
+        benchPipeline(runner, profile);
+    }
+
+    if (outPath.empty()) {
+        runner.writeJson(std::cout);
+    } else {
+        std::ofstream out(outPath);
+        if (!out) {
+            std::cerr << "Failed to open " << outPath << std::endl;
+            return 1;
+        }
+        runner.writeJson(out);
+    }
+
+    return 0;
+}
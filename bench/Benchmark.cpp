@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+#include "core/SelfStats.h"
+#include <chrono>
+#include <iostream>
+
+BenchmarkRunner::BenchmarkRunner(double minTimeMs, const std::string& filter)
+    : m_minTimeMs(minTimeMs)
+    , m_filter(filter)
+{
+}
+
+void BenchmarkRunner::run(const std::string& name, uint64_t itemsPerOp, const Body& body,
+                          const CollectorStats* syscalls) {
+    if (!m_filter.empty() && name.find(m_filter) == std::string::npos) {
+        return;
+    }
+
+    // Warm-up run (caches, lazy registrations)
+    body(1);
+
+    uint64_t iterations = 1;
+    double elapsedNs = 0.0;
+    uint64_t syscallCount = 0;
+    while (true) {
+        uint64_t syscallsBefore = syscalls ? syscalls->syscallCount() : 0;
+        auto start = std::chrono::steady_clock::now();
+        body(iterations);
+        auto end = std::chrono::steady_clock::now();
+        elapsedNs = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        syscallCount = syscalls ? syscalls->syscallCount() - syscallsBefore : 0;
+
+        if (elapsedNs >= m_minTimeMs * 1e6 || iterations >= (uint64_t(1) << 40)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.nsPerOp = elapsedNs / static_cast<double>(iterations);
+    result.itemsPerOp = itemsPerOp;
+    result.syscallsPerOp = syscalls ? static_cast<double>(syscallCount) / static_cast<double>(iterations) : -1.0;
+    m_results.push_back(result);
+
+    std::cerr << name << ": " << result.nsPerOp << " ns/op";
+    if (syscalls) {
+        std::cerr << ", " << result.syscallsPerOp << " syscalls/op";
+    }
+    std::cerr << std::endl;
+}
+
+void BenchmarkRunner::writeJson(std::ostream& out) const {
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < m_results.size(); i++) {
+        const BenchmarkResult& r = m_results[i];
+        double nsPerItem = r.itemsPerOp > 0 ? r.nsPerOp / static_cast<double>(r.itemsPerOp) : r.nsPerOp;
+        out << "    {\"name\": \"" << r.name << "\""
+            << ", \"iterations\": " << r.iterations
+            << ", \"ns_per_op\": " << r.nsPerOp
+            << ", \"items_per_op\": " << r.itemsPerOp
+            << ", \"ns_per_item\": " << nsPerItem;
+        if (r.syscallsPerOp >= 0.0) {
+            out << ", \"syscalls_per_op\": " << r.syscallsPerOp;
+        }
+        out << "}"
+            << (i + 1 < m_results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
@@ -0,0 +1,83 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+class CollectorStats;
+
+/**
+ * @struct BenchmarkResult
+ * @brief Timing result of one benchmark case
+ */
+struct BenchmarkResult {
+    std::string name;           // Case name, e.g. "rate.interfaces/4000"
+    uint64_t iterations;        // Number of timed iterations
+    double nsPerOp;             // Wall time per iteration
+    uint64_t itemsPerOp;        // Items processed per iteration (series, rules, ...)
+    double syscallsPerOp;       // OS calls per iteration (< 0 if not counted)
+};
+
+/**
+ * @class BenchmarkRunner
+ * @brief Minimal microbenchmark harness emitting JSON results
+ *
+ * Each case is a function running the measured operation a given number of
+ * times. The runner doubles the iteration count until a run lasts at least
+ * the minimum time, then reports the last run.
+ */
+class BenchmarkRunner {
+public:
+    using Body = std::function<void(uint64_t iterations)>;
+
+    /**
+     * @brief Constructor
+     * @param minTimeMs Minimum duration of the reported run
+     * @param filter Only run cases whose name contains this string
+     */
+    BenchmarkRunner(double minTimeMs, const std::string& filter);
+
+    /**
+     * @brief Run a benchmark case
+     * @param name Case name
+     * @param itemsPerOp Items processed per iteration
+     * @param body Function running the operation 'iterations' times
+     * @param syscalls Probe counting the OS calls of the operation (optional)
+     */
+    void run(const std::string& name, uint64_t itemsPerOp, const Body& body,
+             const CollectorStats* syscalls = nullptr);
+
+    /**
+     * @brief Write all results as a JSON document
+     * @param out Output stream
+     */
+    void writeJson(std::ostream& out) const;
+
+    /**
+     * @brief Keep a value alive so the optimizer can't drop the computation
+     */
+    template<typename T>
+    static void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#endif
+    }
+
+private:
+    double m_minTimeMs;
+    std::string m_filter;
+    std::vector<BenchmarkResult> m_results;
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,353 @@
+#ifndef SYNTHETICDATASOURCES_H
+#define SYNTHETICDATASOURCES_H
+
+#include "monitors/DataSources.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * In-memory data sources that generate a new, plausible sample on every
+ * call (random-walk usage, monotonically increasing counters). Used to
+ * load-test the collection pipeline without real hardware.
+ */
+
+/**
+ * @class SyntheticRandom
+ * @brief Deterministic generator shared by the synthetic sources
+ */
+class SyntheticRandom {
+public:
+    explicit SyntheticRandom(uint64_t seed) : m_state(seed) {}
+
+    uint64_t next() {
+        m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return m_state >> 33;
+    }
+
+    /**
+     * @brief Random step in [-range, range]
+     */
+    double step(double range) {
+        return (static_cast<double>(next() % 2001) / 1000.0 - 1.0) * range;
+    }
+
+private:
+    uint64_t m_state;
+};
+
+class SyntheticCPUDataSource : public CPUDataSource {
+public:
+    explicit SyntheticCPUDataSource(int cores) : m_cores(cores), m_random(11), m_usages(cores, 50.0) {
+        m_counters.resize(cores);
+    }
+
+    bool open(int& coreCount) override {
+        coreCount = m_cores;
+        return true;
+    }
+
+    bool sample(CPUTimes& times) override {
+        // 100 ticks per core per sample, split by a random-walk usage
+        for (int i = 0; i < m_cores && i < times.coreCount(); i++) {
+            double usage = m_usages[i] + m_random.step(5.0);
+            usage = usage < 0.0 ? 0.0 : (usage > 100.0 ? 100.0 : usage);
+            m_usages[i] = usage;
+
+            uint64_t busy = static_cast<uint64_t>(usage);
+            uint64_t system = busy / 4;
+            uint64_t irq = m_random.next() % 2;
+            if (irq > system) {
+                irq = system;
+            }
+            m_counters.columns[CPUTimes::User][i] += busy - system;
+            m_counters.columns[CPUTimes::System][i] += system - irq;
+            m_counters.columns[CPUTimes::Irq][i] += irq;
+            m_counters.columns[CPUTimes::Idle][i] += 100 - busy;
+
+            for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+                times.columns[c][i] = m_counters.columns[c][i];
+            }
+        }
+        return true;
+    }
+
+private:
+    int m_cores;
+    SyntheticRandom m_random;
+    std::vector<double> m_usages;
+    CPUTimes m_counters;
+};
+
+class SyntheticThermalDataSource : public ThermalDataSource {
+public:
+    explicit SyntheticThermalDataSource(int packages) : m_packages(packages), m_random(17), m_throttles(0) {}
+
+    bool open(int coreCount) override {
+        return coreCount > 0;
+    }
+
+    bool sample(CPUThermals& thermals) override {
+        // Random-walk clock per core, one sensor per package
+        for (size_t i = 0; i < thermals.currentMhz.size(); i++) {
+            double mhz = thermals.currentMhz[i] + m_random.step(200.0);
+            thermals.currentMhz[i] = mhz < 800.0 ? 800.0 : (mhz > 3600.0 ? 3600.0 : mhz);
+            thermals.maxMhz[i] = 3600.0;
+            thermals.limitMhz[i] = 3600.0;
+            thermals.throttleCount[i] = m_throttles;
+        }
+        m_throttles += m_random.next() % 2;
+
+        thermals.sensorNames.resize(m_packages);
+        thermals.sensorCelsius.resize(m_packages);
+        for (int i = 0; i < m_packages; i++) {
+            thermals.sensorNames[i] = "Package " + std::to_string(i);
+            thermals.sensorCelsius[i] = 60.0 + m_random.step(20.0);
+        }
+        return true;
+    }
+
+private:
+    int m_packages;
+    SyntheticRandom m_random;
+    uint64_t m_throttles;
+};
+
+class SyntheticMemoryDataSource : public MemoryDataSource {
+public:
+    SyntheticMemoryDataSource() : m_random(12), m_used(8ULL << 30) {}
+
+    bool sample(MemoryStatus& status) override {
+        const uint64_t total = 64ULL << 30;
+        m_used = static_cast<uint64_t>(static_cast<double>(m_used) + m_random.step(64.0 * 1024 * 1024));
+        if (m_used > total) {
+            m_used = total / 2;
+        }
+        status.totalPhys = total;
+        status.availPhys = total - m_used;
+        status.totalPageFile = total * 2;
+        status.availPageFile = total * 2 - m_used;
+        status.memoryLoad = static_cast<uint32_t>(m_used * 100 / total);
+        return true;
+    }
+
+private:
+    SyntheticRandom m_random;
+    uint64_t m_used;
+};
+
+class SyntheticDiskDataSource : public DiskDataSource {
+public:
+    explicit SyntheticDiskDataSource(int volumes) : m_volumes(volumes), m_random(13) {}
+
+    bool enumerate(std::vector<DiskInfo>& disks) override {
+        disks.clear();
+        for (int i = 0; i < m_volumes; i++) {
+            DiskInfo info = {};
+            info.driveLetter = NameTable::intern(std::wstring(1, static_cast<wchar_t>(L'C' + i % 24)) + L":");
+            info.totalSpace = 1ULL << 40;
+            info.freeSpace = 1ULL << 39;
+            disks.push_back(info);
+        }
+        return true;
+    }
+
+    void describe(DiskInfo& disk) override {
+        disk.volumeName = NameTable::intern(L"Volume " + NameTable::wide(disk.driveLetter));
+        disk.fileSystem = NameTable::intern(L"NTFS");
+    }
+
+    void sampleSpace(std::vector<DiskInfo>& disks) override {
+        for (auto& disk : disks) {
+            disk.freeSpace -= m_random.next() % 4096;
+        }
+    }
+
+    void sampleSpeeds(std::vector<DiskInfo>& disks) override {
+        for (auto& disk : disks) {
+            disk.readSpeed = static_cast<double>(m_random.next() % (64 << 20));
+            disk.writeSpeed = static_cast<double>(m_random.next() % (64 << 20));
+        }
+    }
+
+private:
+    int m_volumes;
+    SyntheticRandom m_random;
+};
+
+class SyntheticNetworkDataSource : public NetworkDataSource {
+public:
+    explicit SyntheticNetworkDataSource(int interfaces)
+        : m_random(14)
+        , m_received(interfaces, 0)
+        , m_sent(interfaces, 0)
+        , m_timestamp(0)
+    {
+        for (int i = 0; i < interfaces; i++) {
+            m_names.push_back(NameTable::intern(L"eth" + std::to_wstring(i)));
+        }
+    }
+
+    bool sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) override {
+        interfaces.clear();
+        m_timestamp += 1000;    // 1 ms per sample keeps rates finite at any rate
+        timestampUs = m_timestamp;
+
+        for (size_t i = 0; i < m_names.size(); i++) {
+            m_received[i] += m_random.next() % 100000;
+            m_sent[i] += m_random.next() % 10000;
+
+            NetworkInterfaceInfo info;
+            info.name = m_names[i];
+            info.description = m_names[i];
+            info.bytesReceived = m_received[i];
+            info.bytesSent = m_sent[i];
+            info.packetsReceived = m_received[i] / 1500;
+            info.packetsSent = m_sent[i] / 1500;
+            info.errors = 0;
+            info.drops = 0;
+            info.downloadSpeed = 0.0;
+            info.uploadSpeed = 0.0;
+            info.packetReceiveRate = 0.0;
+            info.packetSendRate = 0.0;
+            info.errorRate = 0.0;
+            info.dropRate = 0.0;
+            info.isActive = true;
+            interfaces.push_back(info);
+        }
+        return true;
+    }
+
+private:
+    SyntheticRandom m_random;
+    std::vector<NameId> m_names;
+    std::vector<uint64_t> m_received;
+    std::vector<uint64_t> m_sent;
+    uint64_t m_timestamp;
+};
+
+class SyntheticConnectionDataSource : public ConnectionDataSource {
+public:
+    /**
+     * @param connections Sockets per dump
+     * @param counterInterval Read the byte counters every this many dumps
+     *        (like the IP Helper source); the others repeat the timestamp
+     */
+    explicit SyntheticConnectionDataSource(int connections, int counterInterval = 1)
+        : m_random(15)
+        , m_received(connections, 0)
+        , m_acked(connections, 0)
+        , m_timestamp(0)
+        , m_counterInterval(counterInterval)
+        , m_dumps(0)
+    {
+    }
+
+    bool sample(ConnectionTable& table, uint64_t& timestampUs) override {
+        table.clear();
+        bool readBytes = m_dumps++ % m_counterInterval == 0;
+        if (readBytes) {
+            m_timestamp += 1000;
+        }
+        timestampUs = m_timestamp;
+
+        // The kernel's dump order is not the id order
+        for (size_t i = 0; i < m_received.size(); i++) {
+            size_t row = (i * 7919) % m_received.size();
+            if (readBytes) {
+                m_received[row] += m_random.next() % 100000;
+                m_acked[row] += m_random.next() % 10000;
+            }
+
+            ConnectionEndpoint local = {{10, 0, 0, 1}, static_cast<uint16_t>(443), 4};
+            ConnectionEndpoint remote = {{10, static_cast<uint8_t>(row >> 16), static_cast<uint8_t>(row >> 8),
+                                          static_cast<uint8_t>(row)}, static_cast<uint16_t>(40000 + row % 20000), 4};
+            table.add(row * 2654435761ULL, static_cast<uint32_t>(1000 + row % 500), local, remote,
+                      m_received[row], m_acked[row]);
+        }
+        return true;
+    }
+
+    NameId processName(uint32_t pid) override {
+        return NameTable::intern(L"proc" + std::to_wstring(pid));
+    }
+
+private:
+    SyntheticRandom m_random;
+    std::vector<uint64_t> m_received;
+    std::vector<uint64_t> m_acked;
+    uint64_t m_timestamp;
+    int m_counterInterval;
+    uint64_t m_dumps;
+};
+
+class SyntheticProcessDataSource : public ProcessDataSource {
+public:
+    explicit SyntheticProcessDataSource(int processes)
+        : m_random(16)
+        , m_counters(processes)
+        , m_timestamp(0)
+    {
+        for (int i = 0; i < processes; i++) {
+            uint64_t resident = (1 + m_random.next() % 256) << 20;
+            m_counters[i] = {static_cast<uint32_t>(4 + i * 4), 0, 0, 0, 0, resident, 0};
+        }
+    }
+
+    bool sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) override {
+        m_timestamp += 1000;
+        timestampUs = m_timestamp;
+
+        // Most processes are idle; a few do I/O every tick
+        for (ProcessCounters& counters : m_counters) {
+            if (m_random.next() % 16 == 0) {
+                counters.readBytes += m_random.next() % 1000000;
+                counters.writeBytes += m_random.next() % 1000000;
+                counters.readOps += m_random.next() % 100;
+                counters.writeOps += m_random.next() % 100;
+                counters.residentBytes += m_random.next() % (1 << 20);
+                counters.cpuMicros += m_random.next() % 1000000;
+            }
+        }
+        processes = m_counters;
+        return true;
+    }
+
+    bool readMemory(uint32_t pid, ProcessMemory& memory) override {
+        // A page walk: one share count per resident page
+        size_t index = (pid - 4) / 4;
+        if (index >= m_counters.size()) {
+            return false;
+        }
+        const ProcessCounters& counters = m_counters[index];
+        uint64_t pages = counters.residentBytes >> 12;
+        uint64_t proportional = 0;
+        for (uint64_t page = 0; page < pages; page++) {
+            proportional += 4096 / (1 + (page & 3));
+        }
+        memory.resident = counters.residentBytes;
+        memory.proportional = proportional;
+        memory.unique = counters.residentBytes / 4;
+        memory.swapped = 0;
+        return true;
+    }
+
+    bool openEvents() override {
+        return false;
+    }
+
+    void drainExits(std::vector<ProcessExit>& exits) override {
+        exits.clear();
+    }
+
+    NameId processName(uint32_t pid) override {
+        return NameTable::intern(L"proc" + std::to_wstring(pid));
+    }
+
+private:
+    SyntheticRandom m_random;
+    std::vector<ProcessCounters> m_counters;
+    uint64_t m_timestamp;
+};
+
+#endif // SYNTHETICDATASOURCES_H
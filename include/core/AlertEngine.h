@@ -0,0 +1,203 @@
+#ifndef ALERTENGINE_H
+#define ALERTENGINE_H
+
+#include "core/MetricSchema.h"
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+
+class MetricTable;
+
+/**
+ * @enum AlertComparison
+ * @brief Direction in which a value violates the rule threshold
+ */
+enum class AlertComparison {
+    Greater,    // Violated when value > threshold
+    Less        // Violated when value < threshold
+};
+
+/**
+ * @enum AlertTrend
+ * @brief Optional trend the series must also follow for the rule to trigger
+ */
+enum class AlertTrend {
+    Any,
+    Rising,
+    Falling
+};
+
+/**
+ * @struct AlertRule
+ * @brief Declarative threshold rule, e.g. "cpu.total > 90 for 30s"
+ */
+struct AlertRule {
+    std::string name;               // Display name (defaults to the expression)
+    std::string series;             // Metric series name
+    AlertComparison comparison;     // Violation direction
+    double threshold;               // Threshold value
+    double hysteresis;              // Distance back past threshold needed to clear
+    double durationSec;             // Violation must hold this long before firing
+    AlertTrend trend;               // Required trend while violating
+    bool burst;                     // Start a burst capture when raised
+};
+
+/**
+ * @struct AlertEvent
+ * @brief Raised or cleared alert delivered to sinks
+ */
+struct AlertEvent {
+    std::string ruleName;           // Rule display name
+    std::string series;             // Metric series name
+    double value;                   // Value that triggered the transition
+    MetricUnit unit;                // Unit of value and threshold
+    double threshold;               // Rule threshold
+    bool raised;                    // true = alert raised, false = cleared
+    double timestamp;               // Evaluation time in seconds
+    bool burst;                     // Rule asks for a burst capture
+};
+
+/**
+ * @class AlertSink
+ * @brief Receiver of alert transitions (tray icon, log, headless output)
+ */
+class AlertSink {
+public:
+    virtual ~AlertSink() = default;
+
+    /**
+     * @brief Called once per raise/clear transition
+     * @param event Alert event
+     */
+    virtual void onAlert(const AlertEvent& event) = 0;
+};
+
+/**
+ * @class StreamAlertSink
+ * @brief Writes alert transitions as text lines (alert log, --alert-log)
+ */
+class StreamAlertSink : public AlertSink {
+public:
+    explicit StreamAlertSink(std::ostream& stream);
+
+    void onAlert(const AlertEvent& event) override;
+
+private:
+    std::ostream& m_stream;
+};
+
+/**
+ * @class AlertEngine
+ * @brief Evaluates threshold/hysteresis rules incrementally against a MetricTable
+ *
+ * Each rule keeps O(1) state (bound series ID, active flag, violation start
+ * time and the value before it), so a tick costs one comparison per rule and no
+ * allocation. Series names are resolved to IDs only when the table grows.
+ *
+ * Rule syntax:
+ *   <series> <op> <threshold> [for <N>s|m] [rising|falling] [hysteresis <H>] [burst]
+ * where <op> is '>' or '<', e.g. "disk.C:.free_percent < 5 falling".
+ * "rising"/"falling" compare against the last value before the violation
+ * began, not the previous tick, so a value that stays flat past the
+ * threshold still fires; a series that is already past the threshold at
+ * its first sample never does until it moves further. "burst" marks the
+ * events of a rule so a BurstAlertSink starts a high-frequency capture
+ * when it fires.
+ */
+class AlertEngine {
+public:
+    /**
+     * @brief Constructor
+     */
+    AlertEngine();
+
+    /**
+     * @brief Add a rule
+     * @param rule Rule definition
+     */
+    void addRule(const AlertRule& rule);
+
+    /**
+     * @brief Parse and add a rule expression
+     * @param expression Rule expression (see class description)
+     * @return true if the expression was valid, false otherwise
+     */
+    bool addRule(const std::string& expression);
+
+    /**
+     * @brief Load rules, one expression per line ('#' starts a comment)
+     * @param input Input stream
+     * @return Number of rules added
+     */
+    int loadRules(std::istream& input);
+
+    /**
+     * @brief Parse a rule expression
+     * @param expression Rule expression
+     * @param rule Output rule
+     * @return true if the expression was valid, false otherwise
+     */
+    static bool parseRule(const std::string& expression, AlertRule& rule);
+
+    /**
+     * @brief Register a sink (not owned)
+     * @param sink Alert sink
+     */
+    void addSink(AlertSink* sink);
+
+    /**
+     * @brief Evaluate all rules against the latest metric values
+     * @param metrics Metric table
+     * @param nowSec Current time in seconds (monotonic)
+     */
+    void evaluate(const MetricTable& metrics, double nowSec);
+
+    /**
+     * @brief Get number of rules
+     * @return Rule count
+     */
+    int ruleCount() const;
+
+    /**
+     * @brief Check whether a rule watches a series starting with a prefix
+     * @param prefix Series name prefix (e.g. "numa.")
+     * @return true if at least one rule's series matches
+     */
+    bool referencesSeries(const std::string& prefix) const;
+
+    /**
+     * @brief Get number of currently raised alerts
+     * @return Active alert count
+     */
+    int activeCount() const;
+
+private:
+    struct RuleState {
+        int seriesId;               // Bound series ID (-1 if unresolved)
+        MetricUnit unit;            // Unit of the bound series
+        bool active;                // Alert currently raised
+        bool hasPrevious;           // previousValue is valid
+        double violatingSince;      // Start of current violation (-1 if none)
+        double previousValue;       // Value at previous tick
+        double trendBase;           // Value before the current violation (for trends)
+    };
+
+    std::vector<AlertRule> m_rules;     // Rule definitions
+    std::vector<RuleState> m_states;    // Per-rule evaluation state
+    std::vector<AlertSink*> m_sinks;    // Registered sinks
+    int m_boundSeriesCount;             // Table size at last name resolution
+    int m_activeCount;                  // Number of raised alerts
+
+    /**
+     * @brief Resolve series names of all rules to IDs
+     */
+    void bindSeries(const MetricTable& metrics);
+
+    /**
+     * @brief Deliver an event to all sinks
+     */
+    void notify(const AlertRule& rule, const RuleState& state, double value, bool raised, double nowSec);
+};
+
+#endif // ALERTENGINE_H
@@ -0,0 +1,104 @@
+#ifndef ANOMALYDETECTOR_H
+#define ANOMALYDETECTOR_H
+
+#include "core/MetricTable.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class AnomalyDetector
+ * @brief Streaming EWMA z-score anomaly scoring for every metric series
+ *
+ * Mean and variance of each series are tracked with an exponentially
+ * weighted moving average. State is kept as structure-of-arrays indexed by
+ * series ID, so one update() scores all CPU, network and disk series in a
+ * single SIMD pass over the MetricTable values.
+ *
+ * Scores and flags are read per series through score() and isAnomalous().
+ * The summary is published into the MetricTable itself as "anomaly.count"
+ * and "anomaly.max_score", so alert rules, the Self tab and exports see it
+ * like any other metric; those two series are not scored.
+ */
+class AnomalyDetector {
+public:
+    /**
+     * @brief Constructor
+     * @param alpha EWMA smoothing factor (0.0 - 1.0)
+     * @param threshold Absolute z-score above which a sample is anomalous
+     * @param warmupSamples Samples per series before flags are raised
+     */
+    explicit AnomalyDetector(double alpha = 0.1, double threshold = 4.0, int warmupSamples = 10);
+
+    /**
+     * @brief Score the latest values and fold them into the baselines
+     * @param metrics Metric table with the current sample
+     */
+    void update(const MetricTable& metrics);
+
+    /**
+     * @brief Get the z-score of a series from the last update
+     * @param seriesId Series ID in the source MetricTable
+     * @return Signed z-score (0.0 if unknown)
+     */
+    double score(int seriesId) const;
+
+    /**
+     * @brief Check whether a series was anomalous at the last update
+     * @param seriesId Series ID in the source MetricTable
+     * @return true if the series was flagged
+     */
+    bool isAnomalous(int seriesId) const;
+
+    /**
+     * @brief Get number of series flagged at the last update
+     * @return Anomaly count
+     */
+    int anomalyCount() const;
+
+    /**
+     * @brief Get the largest absolute z-score of a warmed-up series
+     * @return Max |z| at the last update (0.0 before warm-up)
+     */
+    double maxScore() const;
+
+    /**
+     * @brief Register the anomaly summary series in a table
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics);
+
+    /**
+     * @brief Write the summary of the last update into a table
+     * @param metrics Metric table passed to registerSeries()
+     */
+    void publish(MetricTable& metrics) const;
+
+private:
+    double m_alpha;                 // EWMA smoothing factor
+    double m_threshold;             // |z| threshold
+    int m_warmupSamples;            // Samples before flagging
+
+    // Per-series state (SoA, indexed by series ID)
+    std::vector<double> m_mean;     // EWMA mean
+    std::vector<double> m_variance; // EWMA variance
+    std::vector<double> m_scores;   // Last z-score
+    std::vector<int> m_samples;     // Samples seen (saturating)
+    std::vector<uint8_t> m_flags;   // Last anomaly flag
+
+    int m_anomalyCount;             // Flags raised at last update
+    double m_maxScore;              // Max |z| at last update
+    int m_countSeries;              // "anomaly.count" series (-1 if unregistered)
+    int m_maxScoreSeries;           // "anomaly.max_score" series (-1 if unregistered)
+
+    /**
+     * @brief Grow state arrays for newly registered series
+     */
+    void resize(const MetricTable& metrics);
+
+    /**
+     * @brief Vectorized EWMA update and z-score kernel
+     */
+    void scoreBatch(const double* values, int count);
+};
+
+#endif // ANOMALYDETECTOR_H
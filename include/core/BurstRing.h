@@ -0,0 +1,93 @@
+#ifndef BURSTRING_H
+#define BURSTRING_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct BurstSample
+ * @brief One high-frequency sample taken during a burst capture
+ */
+struct BurstSample {
+    uint64_t timeNs;                // Time since the capture started
+    double cpuTotal;                // Total CPU usage since the previous sample (0.0 - 100.0)
+    uint64_t bytesReceived;         // Sum of active interface receive counters
+    uint64_t bytesSent;             // Sum of active interface send counters
+    double diskReadBps;             // Sum of volume read speeds
+    double diskWriteBps;            // Sum of volume write speeds
+    uint64_t costNs;                // Time spent collecting this sample
+};
+
+/**
+ * @class BurstRing
+ * @brief Preallocated single-producer/single-consumer ring of burst samples
+ *
+ * The sampler thread pushes and the UI thread pops without locks. Each
+ * slot also holds coreCount per-core usages in a flat side array, so
+ * pushing copies into storage allocated by reset() and never allocates.
+ * A push into a full ring is dropped and counted.
+ */
+class BurstRing {
+public:
+    BurstRing();
+
+    /**
+     * @brief Allocate storage (not thread-safe: call while nobody pushes or pops)
+     * @param capacity Number of samples the ring holds
+     * @param coreCount Per-core usages stored with each sample
+     */
+    void reset(size_t capacity, int coreCount);
+
+    /**
+     * @brief Append a sample (producer thread only)
+     * @param sample Sample to copy
+     * @param coreUsages coreCount() per-core usages to copy
+     * @return false if the ring was full and the sample was dropped
+     */
+    bool push(const BurstSample& sample, const double* coreUsages);
+
+    /**
+     * @brief Remove the oldest sample (consumer thread only)
+     * @param sample Output sample
+     * @param coreUsages Output buffer of coreCount() values (may be nullptr)
+     * @return false if the ring is empty
+     */
+    bool pop(BurstSample& sample, double* coreUsages);
+
+    /**
+     * @brief Get number of samples waiting to be popped
+     * @return Sample count (a snapshot when the producer is running)
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get ring capacity
+     * @return Number of samples the ring holds
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Get number of per-core usages stored per sample
+     * @return Core count
+     */
+    int coreCount() const;
+
+    /**
+     * @brief Get number of samples dropped because the ring was full
+     * @return Dropped sample count since reset()
+     */
+    uint64_t droppedCount() const;
+
+private:
+    std::vector<BurstSample> m_samples;     // Sample slots
+    std::vector<double> m_coreUsages;       // coreCount usages per slot
+    size_t m_capacity;                      // Number of slots
+    int m_coreCount;                        // Usages per slot
+    std::atomic<size_t> m_head;             // Next slot to write (producer)
+    std::atomic<size_t> m_tail;             // Next slot to read (consumer)
+    std::atomic<uint64_t> m_dropped;        // Pushes rejected while full
+};
+
+#endif // BURSTRING_H
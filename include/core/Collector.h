@@ -0,0 +1,58 @@
+#ifndef COLLECTOR_H
+#define COLLECTOR_H
+
+class MetricTable;
+
+/**
+ * @class Collector
+ * @brief Common interface of every source sampled by the update loop
+ *
+ * A collector samples its data source in update() and emits the result as
+ * a batch of MetricTable series. registerSeries() adds the series it knows
+ * about after initialize(), so alert rules bind once. publish() writes the
+ * values of the latest update, and may add series for objects that show up
+ * later (e.g. interfaces). The update loop, exporters and alerting drive
+ * every collector through this interface. Widgets keep using the typed
+ * getters of the concrete monitors.
+ */
+class Collector {
+public:
+    virtual ~Collector() = default;
+
+    /**
+     * @brief Get the registry name of the collector
+     * @return Name (e.g. "cpu", "processes")
+     */
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief Open the data source and take the baseline sample
+     * @return true if initialization successful, false otherwise
+     */
+    virtual bool initialize() = 0;
+
+    /**
+     * @brief Take a sample (called once per tick)
+     */
+    virtual void update() = 0;
+
+    /**
+     * @brief Check if the collector is initialized
+     * @return true if initialized, false otherwise
+     */
+    virtual bool isInitialized() const = 0;
+
+    /**
+     * @brief Register the series known after initialize()
+     * @param metrics Metric table
+     */
+    virtual void registerSeries(MetricTable& metrics) = 0;
+
+    /**
+     * @brief Publish the values of the latest update
+     * @param metrics Metric table passed to registerSeries()
+     */
+    virtual void publish(MetricTable& metrics) = 0;
+};
+
+#endif // COLLECTOR_H
@@ -0,0 +1,134 @@
+#ifndef COLLECTORREGISTRY_H
+#define COLLECTORREGISTRY_H
+
+#include "core/Collector.h"
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct CollectorContext
+ * @brief Settings passed to every collector factory
+ */
+struct CollectorContext {
+    std::filesystem::path fixtureRoot;  // Replay fixtures from here (empty = live data)
+};
+
+/**
+ * @brief Creates one collector (may return nullptr if unsupported)
+ */
+typedef std::function<std::unique_ptr<Collector>(const CollectorContext&)> CollectorFactory;
+
+class CollectorRegistry;
+
+/**
+ * @brief Entry point exported by a collector plugin (a shared library)
+ *
+ * A plugin exports extern "C" registerCollectors(CollectorRegistry&) and
+ * calls add() for each collector it provides.
+ */
+typedef void (*CollectorPluginEntry)(CollectorRegistry& registry);
+
+/**
+ * @class CollectorRegistry
+ * @brief Named collector factories, built in or loaded from plugins, and
+ *        which of them are enabled on this host
+ *
+ * Collectors are created in registration order, which is also the order
+ * the update loop samples them in. Every collector is enabled unless a
+ * config line turns it off. Config lines are "<name|*> on|off [host]";
+ * a line naming a host only applies on that host, and later lines win:
+ *
+ *   perf off
+ *   connections off BUILD-01
+ *
+ * A disabled collector is never created, so it costs nothing per tick.
+ */
+class CollectorRegistry {
+public:
+    static constexpr const char* PLUGIN_ENTRY = "registerCollectors";
+
+    CollectorRegistry();
+    virtual ~CollectorRegistry() = default;
+
+    /**
+     * @brief Register (or replace) a collector factory
+     *
+     * Virtual so that plugins reach it through the vtable without linking
+     * against the executable.
+     *
+     * @param name Collector name
+     * @param factory Factory
+     */
+    virtual void add(const std::string& name, CollectorFactory factory);
+
+    /**
+     * @brief Get the registered names in registration order
+     */
+    std::vector<std::string> names() const;
+
+    /**
+     * @brief Enable or disable a collector (unknown names are kept for
+     *        collectors registered later)
+     * @param name Collector name ("*" for all)
+     * @param enabled New state
+     */
+    void setEnabled(const std::string& name, bool enabled);
+
+    /**
+     * @brief Check if a collector is enabled
+     * @param name Collector name
+     * @return true unless turned off
+     */
+    bool isEnabled(const std::string& name) const;
+
+    /**
+     * @brief Apply config lines
+     * @param config Config text
+     * @param host Name of this host (lines for other hosts are skipped)
+     * @return Number of lines applied
+     */
+    int loadConfig(std::istream& config, const std::string& host);
+
+    /**
+     * @brief Load every plugin in a directory (Windows DLLs)
+     *
+     * Plugins stay loaded for the lifetime of the program, since their
+     * collectors' code lives in them.
+     *
+     * @param directory Plugin directory (missing is fine)
+     * @return Number of plugins loaded
+     */
+    int loadPlugins(const std::filesystem::path& directory);
+
+    /**
+     * @brief Create one collector
+     * @param name Collector name
+     * @param context Factory settings
+     * @return Collector, or nullptr if unknown or the factory declined
+     */
+    std::unique_ptr<Collector> create(const std::string& name, const CollectorContext& context) const;
+
+    /**
+     * @brief Create every enabled collector, in registration order
+     * @param context Factory settings
+     * @return Collectors
+     */
+    std::vector<std::unique_ptr<Collector>> createEnabled(const CollectorContext& context) const;
+
+private:
+    struct Entry {
+        std::string name;
+        CollectorFactory factory;
+    };
+
+    std::vector<Entry> m_entries;               // Registration order
+    std::vector<std::pair<std::string, bool>> m_overrides;  // Per-name state
+    bool m_defaultEnabled;                      // State of names without an override
+};
+
+#endif // COLLECTORREGISTRY_H
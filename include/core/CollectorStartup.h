@@ -0,0 +1,101 @@
+#ifndef COLLECTORSTARTUP_H
+#define COLLECTORSTARTUP_H
+
+#include "core/Collector.h"
+#include <future>
+#include <vector>
+
+/**
+ * @class CollectorStartup
+ * @brief Runs Collector::initialize() on worker threads so the window can
+ *        show before the slowest collector is ready
+ *
+ * Collectors are added in update order. start() launches their
+ * initialize() calls concurrently (collectors share no state while
+ * initializing), except deferred ones, which wait for an explicit
+ * start(collector), e.g. when their tab is first opened. The owner polls
+ * from its own thread; a collector is handed to update(), publish() and
+ * the widgets only once poll() has reported it ready, so it is never
+ * touched while its initialize() is still running.
+ */
+class CollectorStartup {
+public:
+    /**
+     * @brief Destructor - waits for running initializations
+     */
+    ~CollectorStartup();
+
+    /**
+     * @brief Add a collector (call before start())
+     * @param collector Collector, owned by the caller
+     * @param deferred Only initialize on an explicit start(collector)
+     */
+    void add(Collector *collector, bool deferred);
+
+    /**
+     * @brief Start initializing every collector that is not deferred
+     */
+    void start();
+
+    /**
+     * @brief Start initializing a deferred collector (no-op if already started)
+     * @param collector Collector passed to add()
+     * @return true if initialization was started by this call
+     */
+    bool start(Collector *collector);
+
+    /**
+     * @brief Collect finished initializations
+     * @return Collectors that became ready since the last poll, in update order
+     */
+    std::vector<Collector*> poll();
+
+    /**
+     * @brief Wait for every started initialization
+     */
+    void wait();
+
+    /**
+     * @brief Check if a collector finished initializing (successfully or not)
+     * @param collector Collector (nullptr is never ready)
+     * @return true once poll() has reported it
+     */
+    bool isReady(const Collector *collector) const;
+
+    /**
+     * @brief Check if collectors that are not deferred are still initializing
+     */
+    bool isStarting() const;
+
+    /**
+     * @brief Check if any initialization is still running
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief Get the ready collectors in update order
+     */
+    const std::vector<Collector*>& ready() const;
+
+private:
+    enum class State {
+        Deferred,       // Waiting for start(collector)
+        Queued,         // Waiting for start()
+        Starting,       // initialize() running
+        Ready           // Reported by poll()
+    };
+
+    struct Entry {
+        Collector *collector;
+        bool deferred;
+        State state;
+        std::future<bool> result;
+    };
+
+    std::vector<Entry> m_entries;       // Update order
+    std::vector<Collector*> m_ready;    // Ready collectors, update order
+
+    void launch(Entry& entry);
+};
+
+#endif // COLLECTORSTARTUP_H
@@ -0,0 +1,289 @@
+#ifndef METRICSCHEMA_H
+#define METRICSCHEMA_H
+
+#include "utils/SystemUtils.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Unit of a metric series, used to pick its formatter
+ */
+enum class MetricUnit {
+    None,           // Plain number
+    Percent,        // 0-100
+    Bytes,          // Byte count
+    BytesPerSec,    // Byte rate
+    PerSec,         // Event rate
+    Count,          // Event or object count
+    Celsius,        // Temperature
+    Micros,         // Duration in microseconds
+    Millis,         // Duration in milliseconds
+    Ratio           // Dimensionless ratio (IPC, cores)
+};
+
+/**
+ * @brief How the value of a metric series behaves over time
+ */
+enum class MetricKind {
+    Gauge,          // Current level
+    Rate,           // Change per second over the last tick
+    Counter         // Monotonic total
+};
+
+/**
+ * @brief Dense compile-time ID of every metric the built-in collectors publish
+ *
+ * Order must match METRIC_SCHEMA. Metrics whose name has a "{}" are
+ * families: one series per label value (core, drive, interface...).
+ */
+enum class MetricId : int {
+    CpuTotal,
+    CpuFrequency,
+    CpuThrottled,
+    CpuTemperature,
+    CpuCore,
+    CpuColumn,
+    RamUsage,
+    DiskFree,
+    NetDownload,
+    NetUpload,
+    NetErrors,
+    NetDrops,
+    NetInterfaceDownload,
+    NetInterfaceUpload,
+    NetRetransmit,
+    NetStackCounter,
+    NetConnections,
+    IrqCore,
+    NumaNodeCpu,
+    NumaNodeMemory,
+    NumaSocketCpu,
+    PerfContextSwitches,
+    PerfPageFaults,
+    PerfMigrations,
+    PerfIpc,
+    SchedWait,
+    SchedTimeslices,
+    SchedWaitPerTimeslice,
+    ProcessRead,
+    ProcessWrite,
+    ProcessExits,
+    ProcessExitedCpu,
+    TickInterval,
+    TickSpan,
+    TickLate,
+    TickMissed,
+    StartupFirstFrame,
+    StartupFirstData,
+    AnomalyCount,
+    AnomalyMaxScore,
+    SelfCalls,
+    SelfMean,
+    SelfP99,
+    SelfSyscalls,
+    SelfBytesRead,
+    Count
+};
+
+/**
+ * @struct MetricDef
+ * @brief Schema entry of one metric (or metric family)
+ */
+struct MetricDef {
+    MetricId id;            // Must equal the entry's index
+    const char* name;       // Series name, "{}" is replaced by the label value
+    MetricUnit unit;        // Unit of the values
+    MetricKind kind;        // Gauge, rate or counter
+    const char* label;      // Name of the label of a family (nullptr if fixed)
+};
+
+constexpr int METRIC_COUNT = static_cast<int>(MetricId::Count);
+
+constexpr MetricDef METRIC_SCHEMA[METRIC_COUNT] = {
+    {MetricId::CpuTotal,              "cpu.total",                   MetricUnit::Percent,     MetricKind::Gauge,   nullptr},
+    {MetricId::CpuFrequency,          "cpu.frequency_percent",       MetricUnit::Percent,     MetricKind::Gauge,   nullptr},
+    {MetricId::CpuThrottled,          "cpu.throttled_cores",         MetricUnit::Count,       MetricKind::Gauge,   nullptr},
+    {MetricId::CpuTemperature,        "cpu.temperature_max",         MetricUnit::Celsius,     MetricKind::Gauge,   nullptr},
+    {MetricId::CpuCore,               "cpu.core.{}",                 MetricUnit::Percent,     MetricKind::Gauge,   "core"},
+    {MetricId::CpuColumn,             "cpu.{}",                      MetricUnit::Percent,     MetricKind::Gauge,   "column"},
+    {MetricId::RamUsage,              "ram.usage_percent",           MetricUnit::Percent,     MetricKind::Gauge,   nullptr},
+    {MetricId::DiskFree,              "disk.{}.free_percent",        MetricUnit::Percent,     MetricKind::Gauge,   "drive"},
+    {MetricId::NetDownload,           "net.download",                MetricUnit::BytesPerSec, MetricKind::Rate,    nullptr},
+    {MetricId::NetUpload,             "net.upload",                  MetricUnit::BytesPerSec, MetricKind::Rate,    nullptr},
+    {MetricId::NetErrors,             "net.errors",                  MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::NetDrops,              "net.drops",                   MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::NetInterfaceDownload,  "net.{}.download",             MetricUnit::BytesPerSec, MetricKind::Rate,    "interface"},
+    {MetricId::NetInterfaceUpload,    "net.{}.upload",               MetricUnit::BytesPerSec, MetricKind::Rate,    "interface"},
+    {MetricId::NetRetransmit,         "net.tcp.retransmit_percent",  MetricUnit::Percent,     MetricKind::Gauge,   nullptr},
+    {MetricId::NetStackCounter,       "net.{}",                      MetricUnit::PerSec,      MetricKind::Rate,    "counter"},
+    {MetricId::NetConnections,        "net.connections",             MetricUnit::Count,       MetricKind::Gauge,   nullptr},
+    {MetricId::IrqCore,               "irq.core.{}",                 MetricUnit::PerSec,      MetricKind::Rate,    "core"},
+    {MetricId::NumaNodeCpu,           "numa.node.{}.cpu",            MetricUnit::Percent,     MetricKind::Gauge,   "node"},
+    {MetricId::NumaNodeMemory,        "numa.node.{}.memory_percent", MetricUnit::Percent,     MetricKind::Gauge,   "node"},
+    {MetricId::NumaSocketCpu,         "numa.socket.{}.cpu",          MetricUnit::Percent,     MetricKind::Gauge,   "socket"},
+    {MetricId::PerfContextSwitches,   "perf.context_switches",       MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::PerfPageFaults,        "perf.page_faults",            MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::PerfMigrations,        "perf.migrations",             MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::PerfIpc,               "perf.ipc",                    MetricUnit::Ratio,       MetricKind::Gauge,   nullptr},
+    {MetricId::SchedWait,             "sched.wait_percent",          MetricUnit::Percent,     MetricKind::Gauge,   nullptr},
+    {MetricId::SchedTimeslices,       "sched.timeslices",            MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::SchedWaitPerTimeslice, "sched.wait_per_timeslice_us", MetricUnit::Micros,      MetricKind::Gauge,   nullptr},
+    {MetricId::ProcessRead,           "process.io_read",             MetricUnit::BytesPerSec, MetricKind::Rate,    nullptr},
+    {MetricId::ProcessWrite,          "process.io_write",            MetricUnit::BytesPerSec, MetricKind::Rate,    nullptr},
+    {MetricId::ProcessExits,          "process.exits",               MetricUnit::PerSec,      MetricKind::Rate,    nullptr},
+    {MetricId::ProcessExitedCpu,      "process.exited_cpu",          MetricUnit::Ratio,       MetricKind::Rate,    nullptr},
+    {MetricId::TickInterval,          "tick.interval_ms",            MetricUnit::Millis,      MetricKind::Gauge,   nullptr},
+    {MetricId::TickSpan,              "tick.span_ms",                MetricUnit::Millis,      MetricKind::Gauge,   nullptr},
+    {MetricId::TickLate,              "tick.late",                   MetricUnit::Count,       MetricKind::Counter, nullptr},
+    {MetricId::TickMissed,            "tick.missed",                 MetricUnit::Count,       MetricKind::Counter, nullptr},
+    {MetricId::StartupFirstFrame,     "startup.first_frame_ms",      MetricUnit::Millis,      MetricKind::Gauge,   nullptr},
+    {MetricId::StartupFirstData,      "startup.first_data_ms",       MetricUnit::Millis,      MetricKind::Gauge,   nullptr},
+    {MetricId::AnomalyCount,          "anomaly.count",               MetricUnit::Count,       MetricKind::Gauge,   nullptr},
+    {MetricId::AnomalyMaxScore,       "anomaly.max_score",           MetricUnit::Ratio,       MetricKind::Gauge,   nullptr},
+    {MetricId::SelfCalls,             "self.{}.calls",               MetricUnit::Count,       MetricKind::Counter, "probe"},
+    {MetricId::SelfMean,              "self.{}.mean_us",             MetricUnit::Micros,      MetricKind::Gauge,   "probe"},
+    {MetricId::SelfP99,               "self.{}.p99_us",              MetricUnit::Micros,      MetricKind::Gauge,   "probe"},
+    {MetricId::SelfSyscalls,          "self.{}.syscalls",            MetricUnit::Count,       MetricKind::Counter, "probe"},
+    {MetricId::SelfBytesRead,         "self.{}.bytes_read",          MetricUnit::Bytes,       MetricKind::Counter, "probe"},
+};
+
+namespace MetricSchema {
+    /**
+     * @brief Get the schema entry of a metric
+     */
+    constexpr const MetricDef& def(MetricId id) {
+        return METRIC_SCHEMA[static_cast<int>(id)];
+    }
+
+    /**
+     * @brief Check if a metric is a family (one series per label value)
+     */
+    constexpr bool isFamily(MetricId id) {
+        return def(id).label != nullptr;
+    }
+
+    /**
+     * @brief Find a fixed metric by series name
+     * @param name Series name
+     * @return Metric ID, or MetricId::Count if the name is not a fixed metric
+     */
+    constexpr MetricId find(std::string_view name) {
+        for (const MetricDef& entry : METRIC_SCHEMA) {
+            if (!entry.label && name == entry.name) {
+                return entry.id;
+            }
+        }
+        return MetricId::Count;
+    }
+
+    /**
+     * @brief Build the series name of one member of a family
+     *
+     * The label is made usable in alert rules: runs of characters other
+     * than letters, digits, '.', ':', '_' and '-' (spaces, parentheses...)
+     * become one '_', e.g. "Intel(R) Ethernet I219-V" -> "Intel_R_Ethernet_I219-V".
+     *
+     * @param family Family metric
+     * @param label Label value (e.g. "3" for core 3)
+     * @return Series name
+     */
+    std::string seriesName(MetricId family, const std::string& label);
+
+    /**
+     * @brief Format a value for display according to its unit
+     * @param unit Unit of the value
+     * @param value Value
+     * @return Formatted text (e.g. "12.5%", "3.20 MB/s")
+     */
+    std::wstring format(MetricUnit unit, double value);
+
+    /**
+     * @brief Format a value with a fixed number of decimals and a suffix
+     * @param value Value
+     * @param precision Decimals
+     * @param suffix Unit suffix (e.g. L" ms", empty for none)
+     * @return Formatted text
+     */
+    std::wstring formatFixed(double value, int precision, const wchar_t* suffix);
+
+    /**
+     * @brief Format a value without unit or fixed precision
+     */
+    std::wstring formatPlain(double value);
+
+    constexpr bool ordered() {
+        for (int i = 0; i < METRIC_COUNT; i++) {
+            if (static_cast<int>(METRIC_SCHEMA[i].id) != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool uniqueNames() {
+        for (int i = 0; i < METRIC_COUNT; i++) {
+            for (int j = i + 1; j < METRIC_COUNT; j++) {
+                if (std::string_view(METRIC_SCHEMA[i].name) == METRIC_SCHEMA[j].name) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static_assert(ordered(), "METRIC_SCHEMA must list metrics in MetricId order");
+    static_assert(uniqueNames(), "METRIC_SCHEMA names must be unique");
+}
+
+/**
+ * @brief Format a value of a unit known at compile time
+ *
+ * One branch per MetricUnit; a unit added without a formatter fails to
+ * compile instead of falling back to plain output.
+ *
+ * @param value Value
+ * @return Formatted text
+ */
+template <MetricUnit unit>
+std::wstring formatUnit(double value) {
+    if constexpr (unit == MetricUnit::Percent) {
+        return SystemUtils::formatPercent(value);
+    } else if constexpr (unit == MetricUnit::BytesPerSec) {
+        return SystemUtils::formatSpeed(value);
+    } else if constexpr (unit == MetricUnit::Bytes) {
+        return SystemUtils::formatBytes(value > 0.0 ? static_cast<uint64_t>(value) : 0);
+    } else if constexpr (unit == MetricUnit::PerSec) {
+        return MetricSchema::formatFixed(value, 1, L"/s");
+    } else if constexpr (unit == MetricUnit::Count) {
+        return MetricSchema::formatFixed(value, 0, L"");
+    } else if constexpr (unit == MetricUnit::Celsius) {
+        return MetricSchema::formatFixed(value, 1, L" \u00B0C");
+    } else if constexpr (unit == MetricUnit::Micros) {
+        return MetricSchema::formatFixed(value, 1, L" us");
+    } else if constexpr (unit == MetricUnit::Millis) {
+        return MetricSchema::formatFixed(value, 1, L" ms");
+    } else if constexpr (unit == MetricUnit::Ratio) {
+        return MetricSchema::formatFixed(value, 2, L"");
+    } else {
+        static_assert(unit == MetricUnit::None, "formatUnit: unit without a formatter");
+        return MetricSchema::formatPlain(value);
+    }
+}
+
+/**
+ * @brief Format a value of a metric known at compile time
+ *
+ * The formatter is picked by the metric's unit at compile time, so a
+ * byte rate cannot be shown with the percent formatter by mistake.
+ *
+ * @param value Value
+ * @return Formatted text
+ */
+template <MetricId Id>
+std::wstring formatMetric(double value) {
+    return formatUnit<MetricSchema::def(Id).unit>(value);
+}
+
+#endif // METRICSCHEMA_H
@@ -0,0 +1,132 @@
+#ifndef METRICTABLE_H
+#define METRICTABLE_H
+
+#include "core/MetricSchema.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * @class MetricTable
+ * @brief Flat table of the latest value of every published metric series
+ *
+ * Series are registered once by name (e.g. "cpu.total", "cpu.core.3",
+ * "disk.C:.free_percent") and addressed by a dense integer ID afterwards,
+ * so consumers evaluated every tick (alerts, exporters) index a contiguous
+ * array instead of hashing strings.
+ *
+ * Metrics listed in METRIC_SCHEMA are registered by their compile-time
+ * MetricId instead of by name. The table keeps a flat MetricId -> series
+ * ID array, so collectors publish fixed metrics with set(MetricId) without
+ * carrying series IDs around, and a metric that was never registered (a
+ * disabled collector, an unsupported counter) stays absent: set() ignores
+ * it and alert rules naming it don't bind.
+ */
+class MetricTable {
+public:
+    MetricTable();
+
+    /**
+     * @brief Register a series (or look up an existing one)
+     * @param name Series name
+     * @param unit Unit of the values (kept if the series exists)
+     * @return Dense series ID
+     */
+    int addSeries(const std::string& name, MetricUnit unit = MetricUnit::None);
+
+    /**
+     * @brief Register a fixed schema metric
+     * @param metric Metric (must not be a family)
+     * @return Dense series ID
+     */
+    int addSeries(MetricId metric);
+
+    /**
+     * @brief Register one member of a schema metric family
+     * @param family Family metric (e.g. MetricId::CpuCore)
+     * @param label Label value (e.g. "3")
+     * @return Dense series ID
+     */
+    int addSeries(MetricId family, const std::string& label);
+
+    /**
+     * @brief Find a series by name
+     * @param name Series name
+     * @return Series ID or -1 if not registered
+     */
+    int findSeries(const std::string& name) const;
+
+    /**
+     * @brief Get the series ID of a fixed schema metric
+     * @param metric Metric
+     * @return Series ID or -1 if not registered
+     */
+    int seriesId(MetricId metric) const {
+        return m_schemaSeries[static_cast<int>(metric)];
+    }
+
+    /**
+     * @brief Set the current value of a series
+     * @param id Series ID returned by addSeries()
+     * @param value New value
+     */
+    void set(int id, double value);
+
+    /**
+     * @brief Set the current value of a fixed schema metric
+     * @param metric Metric (ignored if not registered)
+     * @param value New value
+     */
+    void set(MetricId metric, double value) {
+        set(seriesId(metric), value);
+    }
+
+    /**
+     * @brief Overwrite the values of the first count series at once
+     * @param values Source values, indexed by series ID
+     * @param count Number of values to copy (clamped to seriesCount())
+     */
+    void setValues(const double* values, int count);
+
+    /**
+     * @brief Get the current value of a series
+     * @param id Series ID
+     * @return Current value (0.0 if the ID is invalid)
+     */
+    double value(int id) const;
+
+    /**
+     * @brief Get all current values, indexed by series ID
+     * @return Pointer to seriesCount() values
+     */
+    const double* values() const;
+
+    /**
+     * @brief Get number of registered series
+     * @return Series count
+     */
+    int seriesCount() const;
+
+    /**
+     * @brief Get the name of a series
+     * @param id Series ID
+     * @return Series name
+     */
+    const std::string& seriesName(int id) const;
+
+    /**
+     * @brief Get the unit of a series
+     * @param id Series ID
+     * @return Unit (MetricUnit::None if the ID is invalid)
+     */
+    MetricUnit seriesUnit(int id) const;
+
+private:
+    std::vector<double> m_values;                   // Latest value per series
+    std::vector<std::string> m_names;               // Name per series
+    std::vector<MetricUnit> m_units;                // Unit per series
+    std::unordered_map<std::string, int> m_index;   // Name -> series ID
+    std::vector<int> m_schemaSeries;                // MetricId -> series ID (-1 = absent)
+};
+
+#endif // METRICTABLE_H
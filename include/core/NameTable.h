@@ -0,0 +1,79 @@
+#ifndef NAMETABLE_H
+#define NAMETABLE_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Compact id of an interned name (0 is the empty name)
+ */
+typedef uint32_t NameId;
+
+/**
+ * @class NameTable
+ * @brief Process-wide intern table for identifiers (interface, volume and
+ *        process names)
+ *
+ * Each distinct name gets a NameId the first time it is seen, and its
+ * UTF-8 and UTF-16 forms are built once, at that time. Collectors keep
+ * only ids, so per-tick code compares and hashes integers; the string
+ * forms are looked up when a name is displayed or a series name is
+ * built. Interning a name that is already known converts nothing and
+ * allocates nothing. Ids are never released (names are few and
+ * long-lived) and the returned strings have stable addresses.
+ */
+class NameTable {
+public:
+    /**
+     * @brief Get (or create) the id of a name
+     * @param name UTF-16 name
+     * @return Name id
+     */
+    static NameId intern(const std::wstring& name);
+
+    /**
+     * @brief Get (or create) the id of a name
+     * @param name UTF-16 name
+     * @param length Characters in name
+     * @return Name id
+     */
+    static NameId intern(const wchar_t* name, size_t length);
+
+    /**
+     * @brief Get (or create) the id of a name
+     * @param name UTF-8 name
+     * @param length Bytes in name
+     * @return Name id
+     */
+    static NameId intern(const char* name, size_t length);
+
+    /**
+     * @brief Get (or create) the id of a name
+     * @param name UTF-8 name
+     * @return Name id
+     */
+    static NameId intern(const std::string& name);
+
+    /**
+     * @brief Get the UTF-16 form of a name
+     * @param id Name id ("" if unknown)
+     */
+    static const std::wstring& wide(NameId id);
+
+    /**
+     * @brief Get the UTF-8 form of a name
+     * @param id Name id ("" if unknown)
+     */
+    static const std::string& utf8(NameId id);
+
+    /**
+     * @brief Get number of interned names, including the empty name
+     * @return Name count (ids are below this)
+     */
+    static size_t size();
+
+    static constexpr NameId EMPTY = 0;
+};
+
+#endif // NAMETABLE_H
@@ -0,0 +1,142 @@
+#ifndef SELFSTATS_H
+#define SELFSTATS_H
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+class MetricTable;
+
+/**
+ * @class CollectorStats
+ * @brief Latency histogram and OS call counters for one instrumented probe
+ *
+ * Latencies go into fixed log2 buckets (bucket 0: < 1 us, bucket k:
+ * [2^(k-1), 2^k) us), so recording a sample is a few integer operations
+ * and never allocates. Counters are relaxed atomics: the burst sampler
+ * and collector startup threads record into the same probes the UI
+ * thread reads. Creating a probe (SelfStats::probe) takes the registry
+ * lock and may happen on any thread; a probe never moves once created.
+ */
+class CollectorStats {
+public:
+    static constexpr int BUCKET_COUNT = 32;
+
+    explicit CollectorStats(const std::string& name);
+
+    /**
+     * @brief Record one call duration
+     * @param nanos Duration in nanoseconds
+     */
+    void record(uint64_t nanos);
+
+    /**
+     * @brief Count OS/API calls issued by the probe
+     * @param count Number of calls
+     */
+    void addSyscalls(uint64_t count);
+
+    /**
+     * @brief Count bytes returned by the OS to the probe
+     * @param bytes Number of bytes
+     */
+    void addBytesRead(uint64_t bytes);
+
+    /**
+     * @brief Get probe name (e.g. "cpu.update")
+     */
+    const std::string& name() const;
+
+    uint64_t callCount() const;
+    uint64_t syscallCount() const;
+    uint64_t bytesRead() const;
+
+    /**
+     * @brief Get mean call duration
+     * @return Mean duration in microseconds
+     */
+    double meanMicros() const;
+
+    /**
+     * @brief Get longest call duration
+     * @return Max duration in microseconds
+     */
+    double maxMicros() const;
+
+    /**
+     * @brief Estimate a latency percentile from the histogram
+     * @param percentile Percentile (0.0 - 100.0)
+     * @return Upper bound of the bucket holding the percentile, in microseconds
+     */
+    double percentileMicros(double percentile) const;
+
+private:
+    std::string m_name;                 // Probe name
+    std::atomic<uint64_t> m_buckets[BUCKET_COUNT];  // Latency histogram
+    std::atomic<uint64_t> m_calls;                  // Number of recorded calls
+    std::atomic<uint64_t> m_totalNanos;             // Sum of durations
+    std::atomic<uint64_t> m_maxNanos;               // Longest duration
+    std::atomic<uint64_t> m_syscalls;               // OS/API calls issued
+    std::atomic<uint64_t> m_bytesRead;              // Bytes returned by the OS
+};
+
+/**
+ * @class SelfStats
+ * @brief Registry of self-instrumentation probes
+ *
+ * Probes are looked up once per call site and cached in a function-local
+ * static:
+ *   static CollectorStats& stats = SelfStats::probe("cpu.update");
+ *   ScopedTimer timer(stats);
+ */
+class SelfStats {
+public:
+    /**
+     * @brief Get (or create) a probe by name
+     * @param name Probe name
+     * @return Probe with a stable address for the lifetime of the program
+     */
+    static CollectorStats& probe(const std::string& name);
+
+    /**
+     * @brief Get all registered probes in registration order
+     * @return Snapshot of the probes (thread-safe; probes never move)
+     */
+    static std::vector<const CollectorStats*> probes();
+
+    /**
+     * @brief Publish probe statistics as "self.<probe>.*" metric series
+     * @param metrics Metric table
+     */
+    static void publish(MetricTable& metrics);
+};
+
+/**
+ * @class ScopedTimer
+ * @brief Records the lifetime of a scope into a CollectorStats probe
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(CollectorStats& stats)
+        : m_stats(stats)
+        , m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_stats.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    CollectorStats& m_stats;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // SELFSTATS_H
@@ -0,0 +1,116 @@
+#ifndef TICKCLOCK_H
+#define TICKCLOCK_H
+
+#include <cstdint>
+
+/**
+ * @struct Tick
+ * @brief Timestamp and health of one update tick, shared by every monitor
+ *        sampled in that tick
+ */
+struct Tick {
+    uint64_t sequence;              // Tick number (1 = first tick)
+    uint64_t timestampUs;           // Start of the tick (SystemUtils::monotonicMicros)
+    uint64_t intervalUs;            // Time since the previous tick (0 for the first)
+    uint64_t missed;                // Whole periods skipped before this tick
+    uint64_t spanUs;                // Start of the tick to its last sample (set by end())
+    bool late;                      // Interval exceeded the period by more than LATE_PERCENT
+};
+
+/**
+ * @class TickClock
+ * @brief Stamps update ticks with one monotonic timestamp and detects
+ *        missed and late ticks
+ *
+ * A timer-driven update loop drifts when the UI thread is busy or the
+ * machine sleeps; the timer then fires late, or coalesces several
+ * periods into one. begin() compares the real interval with the period:
+ * an interval more than LATE_PERCENT over the period marks the tick
+ * late, and the whole periods it spans beyond the first are counted as
+ * missed. Monitors still compute their rates against their own sample
+ * timestamps, so a late tick yields a correct rate over a longer
+ * interval rather than an inflated one; the counts make the gap visible.
+ */
+class TickClock {
+public:
+    /**
+     * @brief Constructor
+     * @param periodUs Expected interval between ticks in microseconds
+     */
+    explicit TickClock(uint64_t periodUs);
+
+    /**
+     * @brief Start a tick now
+     * @return The new tick
+     */
+    const Tick& begin();
+
+    /**
+     * @brief Start a tick at a given time
+     * @param nowUs Monotonic time in microseconds (not before the previous tick)
+     * @return The new tick
+     */
+    const Tick& begin(uint64_t nowUs);
+
+    /**
+     * @brief Mark the end of the sampling part of the current tick
+     *
+     * The span between begin() and end() bounds how far apart the
+     * monitors' own sample timestamps are within one tick.
+     */
+    void end();
+
+    /**
+     * @brief Mark the end of the sampling part of the current tick at a given time
+     * @param nowUs Monotonic time in microseconds
+     */
+    void end(uint64_t nowUs);
+
+    /**
+     * @brief Get the latest tick
+     */
+    const Tick& current() const;
+
+    /**
+     * @brief Get the time of the latest tick since the first one
+     * @return Seconds (0.0 before the second tick)
+     */
+    double elapsedSeconds() const;
+
+    /**
+     * @brief Get the number of late ticks since construction
+     */
+    uint64_t lateCount() const;
+
+    /**
+     * @brief Get the number of missed periods since construction
+     */
+    uint64_t missedCount() const;
+
+    /**
+     * @brief Change the expected interval (e.g. when the loop is throttled)
+     *
+     * The next tick spans both periods, so it is never counted as late.
+     *
+     * @param periodUs New interval in microseconds
+     */
+    void setPeriod(uint64_t periodUs);
+
+    /**
+     * @brief Get the expected interval
+     * @return Period in microseconds
+     */
+    uint64_t period() const;
+
+    static constexpr int LATE_PERCENT = 20;
+
+private:
+    uint64_t m_periodUs;            // Expected interval
+    uint64_t m_firstUs;             // Timestamp of the first tick (0 = none yet)
+    uint64_t m_lateCount;           // Late ticks so far
+    uint64_t m_missedCount;         // Missed periods so far
+    bool m_periodChanged;           // setPeriod() since the latest tick
+    Tick m_tick;                    // Latest tick
+};
+
+#endif // TICKCLOCK_H
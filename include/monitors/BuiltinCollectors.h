@@ -0,0 +1,17 @@
+#ifndef BUILTINCOLLECTORS_H
+#define BUILTINCOLLECTORS_H
+
+class CollectorRegistry;
+
+/**
+ * @brief Register the monitors compiled into the executable
+ *
+ * Registration order is the update order: "cpu" comes before "numa",
+ * which aggregates its per-core usage. With a fixture root in the
+ * CollectorContext every monitor replays fixtures instead of live data.
+ *
+ * @param registry Registry
+ */
+void registerBuiltinCollectors(CollectorRegistry& registry);
+
+#endif // BUILTINCOLLECTORS_H
@@ -0,0 +1,199 @@
+#ifndef BURSTSAMPLER_H
+#define BURSTSAMPLER_H
+
+#include "core/BurstRing.h"
+#include "core/AlertEngine.h"
+#include "monitors/CPUMonitor.h"
+#include "monitors/DiskMonitor.h"
+#include "monitors/NetworkMonitor.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CPUDataSource;
+class DiskDataSource;
+class NetworkDataSource;
+class CollectorStats;
+
+/**
+ * @struct BurstConfig
+ * @brief Sampling interval and length of a burst capture
+ */
+struct BurstConfig {
+    int intervalMs;                 // Sampling interval (clamped to 1 - 10 ms)
+    int windowMs;                   // Capture length (clamped to 100 ms - 60 s)
+};
+
+/**
+ * @struct BurstRecording
+ * @brief Completed burst capture with rates derived from the raw samples
+ */
+struct BurstRecording {
+    int intervalMs;                         // Requested sampling interval
+    int windowMs;                           // Requested capture length
+    int coreCount;                          // Per-core usages per sample
+    uint64_t droppedCount;                  // Samples lost to a full ring
+
+    std::vector<double> timeMs;             // Sample time since the capture started
+    std::vector<double> cpuTotal;           // Total CPU usage (percent)
+    std::vector<double> coreUsages;         // coreCount usages per sample, flat
+    std::vector<double> netDownloadBps;     // Receive rate over all interfaces
+    std::vector<double> netUploadBps;       // Send rate over all interfaces
+    std::vector<double> diskReadBps;        // Read rate over all volumes
+    std::vector<double> diskWriteBps;       // Write rate over all volumes
+    std::vector<double> costMicros;         // Collection cost of each sample
+
+    /**
+     * @brief Get number of samples
+     * @return Sample count
+     */
+    size_t sampleCount() const;
+
+    /**
+     * @brief Get a percentile of the per-sample collection cost
+     * @param percentile Percentile (0 - 100)
+     * @return Cost in microseconds
+     */
+    double costPercentileMicros(double percentile) const;
+
+    /**
+     * @brief Save as CSV (header comment with the capture settings and
+     *        overhead, then one row per sample)
+     * @param path Output file path
+     * @return true if the file was written
+     */
+    bool save(const std::string& path) const;
+};
+
+/**
+ * @class BurstSampler
+ * @brief Samples CPU, network and disk counters every 1 - 10 ms for a
+ *        bounded window on a background thread
+ *
+ * The sampler owns its own data sources so it never races the monitors
+ * used by the UI tick. All buffers are allocated in start(); the capture
+ * thread only writes into preallocated state and a BurstRing, and the UI
+ * thread collects the result with takeRecording() once it finished.
+ * Each sample's collection cost is stored with it and recorded in the
+ * "burst.sample" SelfStats probe.
+ */
+class BurstSampler {
+public:
+    /**
+     * @brief Constructor
+     * @param cpuSource CPU counters (required)
+     * @param networkSource Interface counters (may be nullptr)
+     * @param diskSource Volume speeds (may be nullptr)
+     */
+    BurstSampler(std::unique_ptr<CPUDataSource> cpuSource,
+                 std::unique_ptr<NetworkDataSource> networkSource,
+                 std::unique_ptr<DiskDataSource> diskSource);
+
+    /**
+     * @brief Destructor - stops and joins a running capture
+     */
+    ~BurstSampler();
+
+    BurstSampler(const BurstSampler&) = delete;
+    BurstSampler& operator=(const BurstSampler&) = delete;
+
+    /**
+     * @brief Start a capture (discards samples not collected yet)
+     * @param config Interval and window
+     * @return false if a capture is running or the sources cannot be opened
+     */
+    bool start(const BurstConfig& config);
+
+    /**
+     * @brief Ask a running capture to stop early
+     */
+    void stop();
+
+    /**
+     * @brief Check if a capture is running
+     * @return true while the capture thread samples
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Collect the samples of the finished capture
+     * @param recording Output recording
+     * @return false if a capture is running or there is nothing to collect
+     */
+    bool takeRecording(BurstRecording& recording);
+
+    /**
+     * @brief Take one sample into the ring (capture thread, or benchmarks)
+     * @param timeNs Sample time since the capture started
+     */
+    void sampleOnce(uint64_t timeNs);
+
+    /**
+     * @brief Request a capture from a signal handler (Ctrl+Break on
+     *        Windows, SIGUSR1 elsewhere)
+     */
+    static void installSignalTrigger();
+
+    /**
+     * @brief Consume a pending signal request
+     * @return true once per delivered signal
+     */
+    static bool takeSignalRequest();
+
+private:
+    std::unique_ptr<CPUDataSource> m_cpuSource;         // CPU counters
+    std::unique_ptr<NetworkDataSource> m_networkSource; // Interface counters
+    std::unique_ptr<DiskDataSource> m_diskSource;       // Volume speeds
+    bool m_opened;                                      // Sources opened
+
+    BurstConfig m_config;                   // Settings of the current capture
+    BurstRing m_ring;                       // Samples handed to the UI thread
+    std::thread m_thread;                   // Capture thread
+    std::atomic<bool> m_running;            // Capture thread is sampling
+    std::atomic<bool> m_stopRequested;      // stop() was called
+    CollectorStats *m_stats;                // "burst.sample" probe
+
+    // Preallocated per-sample state
+    CPUTimes m_previousTimes;               // CPU counters of the previous sample
+    CPUTimes m_currentTimes;                // CPU counters of this sample
+    CPUBreakdown m_breakdown;               // CPU usage between the two
+    std::vector<NetworkInterfaceInfo> m_interfaces; // Interface counters
+    std::vector<DiskInfo> m_disks;          // Volumes and speeds
+    uint64_t m_baselineReceived;            // Interface counters when the capture started
+    uint64_t m_baselineSent;
+
+    /**
+     * @brief Open the data sources on first use
+     * @return true if at least the CPU source is usable
+     */
+    bool open();
+
+    /**
+     * @brief Capture loop run on m_thread
+     */
+    void run();
+};
+
+/**
+ * @class BurstAlertSink
+ * @brief Starts a burst capture when an alert rule marked "burst" is raised
+ */
+class BurstAlertSink : public AlertSink {
+public:
+    /**
+     * @brief Constructor
+     * @param sampler Sampler to start
+     * @param config Capture settings used for alert-triggered captures
+     */
+    BurstAlertSink(BurstSampler *sampler, const BurstConfig& config);
+
+    void onAlert(const AlertEvent& event) override;
+
+private:
+    BurstSampler *m_sampler;
+    BurstConfig m_config;
+};
+
+#endif // BURSTSAMPLER_H
@@ -1,29 +1,131 @@
 #ifndef CPUMONITOR_H
 #define CPUMONITOR_H
 
-#include <windows.h>
-#include <pdh.h>
+#include "core/Collector.h"
+#include <memory>
 #include <string>
 #include <vector>
+#include <cstdint>
+
+class CPUDataSource;
+class ThermalDataSource;
+
+/**
+ * @struct CPUTimes
+ * @brief Raw cumulative per-core CPU time counters, one array per column
+ *
+ * Structure-of-arrays layout: columns[c][core]. Units are whatever the
+ * data source counts in (100 ns on Windows, clock ticks in fixtures);
+ * only deltas are ever used. Guest time is already part of User and is
+ * not added to the elapsed total.
+ */
+struct CPUTimes {
+    enum Column {
+        User,
+        Nice,
+        System,
+        Idle,
+        IOWait,
+        Irq,
+        SoftIrq,
+        Steal,
+        Guest,
+        ColumnCount
+    };
+
+    std::vector<uint64_t> columns[ColumnCount];     // Counters per column, indexed by core
+
+    /**
+     * @brief Resize every column (new counters start at zero)
+     * @param coreCount Number of cores
+     */
+    void resize(int coreCount);
+
+    /**
+     * @brief Get number of cores
+     * @return Length of every column
+     */
+    int coreCount() const;
+
+    /**
+     * @brief Get the lowercase name of a column ("user", "iowait", ...)
+     * @param column Breakdown column
+     * @return Column name, or "" for an invalid column
+     */
+    static const char* columnName(Column column);
+};
+
+/**
+ * @struct CPUBreakdown
+ * @brief Usage split by CPUTimes column between two samples, in percent
+ */
+struct CPUBreakdown {
+    std::vector<double> percent[CPUTimes::ColumnCount]; // Share of elapsed time per column, indexed by core
+    std::vector<double> busy;                           // 100 - idle - iowait, indexed by core
+    std::vector<double> elapsed;                        // Elapsed counter units, indexed by core
+    double totalPercent[CPUTimes::ColumnCount];         // Per column across all cores
+    double totalBusy;                                   // Busy across all cores
+
+    /**
+     * @brief Resize every array
+     * @param coreCount Number of cores
+     */
+    void resize(int coreCount);
+};
+
+/**
+ * @struct CPUThermals
+ * @brief Per-core clock and throttling state plus temperature sensors
+ */
+struct CPUThermals {
+    std::vector<double> currentMhz;         // Current frequency, indexed by core
+    std::vector<double> maxMhz;             // Rated maximum frequency, indexed by core
+    std::vector<double> limitMhz;           // Current frequency cap (= maxMhz when uncapped), indexed by core
+    std::vector<uint64_t> throttleCount;    // Cumulative thermal throttle events (0 if not counted), indexed by core
+    std::vector<std::string> sensorNames;   // Temperature sensors ("Package 0", "Core 3", thermal zones)
+    std::vector<double> sensorCelsius;      // Temperature per sensor
+
+    /**
+     * @brief Resize the per-core arrays (new entries start at zero)
+     * @param coreCount Number of cores
+     */
+    void resize(int coreCount);
+};
 
 /**
  * @class CPUMonitor
- * @brief Monitors CPU usage using Windows Performance Data Helper (PDH) API
+ * @brief Monitors CPU usage from a CPUDataSource (processor time counters by default)
  * 
  * This class provides real-time CPU usage information including:
  * - Total CPU usage across all cores
  * - Per-core CPU usage
+ * - Per-core and total breakdown (user, system, idle, iowait, irq, steal...)
+ * - Per-core frequency and throttling, and temperatures (if a
+ *   ThermalDataSource is available)
  * - Number of logical processors
  */
-class CPUMonitor {
+class CPUMonitor : public Collector {
 public:
     /**
-     * @brief Constructor - Initializes PDH query and counters
+     * @brief Constructor - Uses the platform's default data source
      */
     CPUMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit CPUMonitor(std::unique_ptr<CPUDataSource> source);
+
+    /**
+     * @brief Constructor with injected data sources
+     * @param source Data source
+     * @param thermalSource Frequency and temperature source (may be nullptr)
+     */
+    CPUMonitor(std::unique_ptr<CPUDataSource> source, std::unique_ptr<ThermalDataSource> thermalSource);
     
     /**
-     * @brief Destructor - Cleans up PDH resources
+     * @brief Destructor
      */
     ~CPUMonitor();
 
@@ -31,12 +133,12 @@ public:
      * @brief Initialize the CPU monitor
      * @return true if initialization successful, false otherwise
      */
-    bool initialize();
+    bool initialize() override;
 
     /**
      * @brief Update CPU usage values (should be called periodically)
      */
-    void update();
+    void update() override;
 
     /**
      * @brief Get total CPU usage across all cores
@@ -51,32 +153,168 @@ public:
      */
     double getCoreUsage(int coreIndex) const;
 
+    /**
+     * @brief Get CPU usage of all cores
+     * @return Per-core usage percentages, indexed by core
+     */
+    const std::vector<double>& getCoreUsages() const;
+
+    /**
+     * @brief Get the share of one column for a specific core
+     * @param coreIndex Index of the core (0-based)
+     * @param column Breakdown column
+     * @return Percentage of the core's elapsed time (0.0 - 100.0)
+     */
+    double getCoreBreakdown(int coreIndex, CPUTimes::Column column) const;
+
+    /**
+     * @brief Get the share of one column across all cores
+     * @param column Breakdown column
+     * @return Percentage of elapsed time (0.0 - 100.0)
+     */
+    double getTotalBreakdown(CPUTimes::Column column) const;
+
+    /**
+     * @brief Get the full breakdown of the last interval
+     * @return Per-core and total breakdown
+     */
+    const CPUBreakdown& getBreakdown() const;
+
+    /**
+     * @brief Compute deltas and percentages of all cores in one pass
+     * @param previous Counters of the previous sample
+     * @param current Counters of the current sample
+     * @param result Output breakdown (resized to the core count)
+     */
+    static void computeBreakdown(const CPUTimes& previous, const CPUTimes& current, CPUBreakdown& result);
+
+    /**
+     * @brief Check if frequency and temperature readings are available
+     * @return true if a thermal source was opened
+     */
+    bool hasThermalData() const;
+
+    /**
+     * @brief Get the current frequency of a core
+     * @param coreIndex Index of the core (0-based)
+     * @return Frequency in MHz (0.0 if unknown)
+     */
+    double getCoreFrequency(int coreIndex) const;
+
+    /**
+     * @brief Get the rated maximum frequency of a core
+     * @param coreIndex Index of the core (0-based)
+     * @return Frequency in MHz (0.0 if unknown)
+     */
+    double getCoreMaxFrequency(int coreIndex) const;
+
+    /**
+     * @brief Get the average current frequency relative to the maximum
+     * @return Percentage of the rated maximum over all cores (0.0 if unknown)
+     */
+    double getAverageFrequencyPercent() const;
+
+    /**
+     * @brief Check if a core was throttled during the last interval
+     * @param coreIndex Index of the core (0-based)
+     * @return true if the core is capped below its maximum or logged
+     *         throttle events since the previous update
+     */
+    bool isCoreThrottled(int coreIndex) const;
+
+    /**
+     * @brief Get number of throttled cores
+     * @return Cores for which isCoreThrottled() is true
+     */
+    int getThrottledCoreCount() const;
+
+    /**
+     * @brief Get thermal throttle events of a core during the last interval
+     * @param coreIndex Index of the core (0-based)
+     * @return Event count
+     */
+    uint64_t getCoreThrottleEvents(int coreIndex) const;
+
+    /**
+     * @brief Get number of temperature sensors
+     * @return Sensor count
+     */
+    int getSensorCount() const;
+
+    /**
+     * @brief Get the name of a temperature sensor
+     * @param sensor Sensor index
+     * @return Sensor name ("" if the index is invalid)
+     */
+    std::string getSensorName(int sensor) const;
+
+    /**
+     * @brief Get the temperature of a sensor
+     * @param sensor Sensor index
+     * @return Degrees Celsius (0.0 if the index is invalid)
+     */
+    double getSensorTemperature(int sensor) const;
+
+    /**
+     * @brief Get the hottest sensor reading
+     * @return Degrees Celsius (0.0 if there are no sensors)
+     */
+    double getMaxTemperature() const;
+
     /**
      * @brief Get number of logical processors
      * @return Number of CPU cores
      */
     int getCoreCount() const;
 
+    /**
+     * @brief Get the registry name ("cpu")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the "cpu.*" series (total, thermals, per core, breakdown)
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the latest usage, breakdown and thermals
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
     /**
      * @brief Check if monitor is initialized
      * @return true if initialized, false otherwise
      */
-    bool isInitialized() const;
+    bool isInitialized() const override;
 
 private:
-    PDH_HQUERY m_query;                    // PDH query handle
-    PDH_HCOUNTER m_totalCounter;            // Total CPU usage counter
-    std::vector<PDH_HCOUNTER> m_coreCounters; // Per-core counters
+    std::unique_ptr<CPUDataSource> m_source; // Data source
+    std::unique_ptr<ThermalDataSource> m_thermalSource; // Frequency and temperature source (optional)
     
-    double m_totalUsage;                    // Current total CPU usage
-    std::vector<double> m_coreUsages;       // Current per-core usages
+    CPUTimes m_previousTimes;               // Counters of the previous sample
+    CPUTimes m_currentTimes;                // Counters of the current sample
+    CPUBreakdown m_breakdown;               // Breakdown of the last interval (holds the usages)
+    CPUThermals m_thermals;                 // Latest frequency and temperature readings
+    std::vector<uint64_t> m_previousThrottleCount; // Throttle counters of the previous sample
+    std::vector<uint64_t> m_throttleEvents; // Throttle events during the last interval
+    bool m_hasThermals;                     // Thermal source opened
     int m_coreCount;                        // Number of CPU cores
+    std::vector<int> m_coreSeries;          // "cpu.core.<n>"
+    std::vector<int> m_breakdownSeries;     // Indexed by CPUTimes::Column
     bool m_initialized;                     // Initialization status
 
     /**
-     * @brief Collect CPU usage data from PDH counters
+     * @brief Sample the counters and recompute the breakdown
      */
     void collectData();
+
+    /**
+     * @brief Sample frequencies, throttle counters and temperatures
+     */
+    void collectThermals();
 };
 
 #endif // CPUMONITOR_H
@@ -0,0 +1,201 @@
+#ifndef CONNECTIONMONITOR_H
+#define CONNECTIONMONITOR_H
+
+#include "core/Collector.h"
+#include "core/NameTable.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class ConnectionDataSource;
+
+/**
+ * @struct ConnectionEndpoint
+ * @brief Binary socket address (formatted only for displayed flows)
+ */
+struct ConnectionEndpoint {
+    uint8_t address[16];            // IPv4 in the first 4 bytes, or IPv6
+    uint16_t port;                  // Host byte order
+    uint8_t family;                 // 4 or 6
+};
+
+/**
+ * @struct ConnectionTable
+ * @brief One dump of all TCP connections, one row per socket
+ *
+ * Structure-of-arrays layout; clear() keeps the capacity so a dump of
+ * the same size does not allocate.
+ */
+struct ConnectionTable {
+    std::vector<uint64_t> ids;              // Stable socket identity (cookie or 4-tuple hash)
+    std::vector<uint32_t> pids;             // Owning process (0 if unknown)
+    std::vector<ConnectionEndpoint> local;  // Local address
+    std::vector<ConnectionEndpoint> remote; // Remote address
+    std::vector<uint64_t> bytesReceived;    // Payload bytes received
+    std::vector<uint64_t> bytesAcked;       // Payload bytes sent and acknowledged
+
+    /**
+     * @brief Remove all rows, keeping the capacity
+     */
+    void clear();
+
+    /**
+     * @brief Get number of connections
+     * @return Row count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Append a connection
+     */
+    void add(uint64_t id, uint32_t pid, const ConnectionEndpoint& localEndpoint,
+             const ConnectionEndpoint& remoteEndpoint, uint64_t received, uint64_t acked);
+};
+
+/**
+ * @struct FlowInfo
+ * @brief A displayed connection with its rates
+ */
+struct FlowInfo {
+    std::string local;              // "address:port"
+    std::string remote;             // "address:port"
+    uint32_t pid;                   // Owning process
+    NameId process;                 // Process name (NameTable, EMPTY if unknown)
+    double receiveRate;             // Bytes/sec received
+    double sendRate;                // Bytes/sec sent and acknowledged
+};
+
+/**
+ * @class ConnectionMonitor
+ * @brief Per-connection throughput and the top flows from a
+ *        ConnectionDataSource (IP Helper TCP table by default)
+ *
+ * Each update takes one dump of every TCP socket, matches it against the
+ * previous dump by socket id (a merge of two id-sorted index arrays, so
+ * 100k sockets cost two sorts and one linear pass) and keeps the busiest
+ * flows with their process. A connection that is new since the previous
+ * dump counts all of its bytes, so a spike caused by a short connection
+ * still shows up.
+ */
+class ConnectionMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    ConnectionMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit ConnectionMonitor(std::unique_ptr<ConnectionDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~ConnectionMonitor();
+
+    /**
+     * @brief Initialize the connection monitor
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update connection rates and the top flows (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Set the number of flows kept by update()
+     * @param count Flow count
+     */
+    void setTopCount(int count);
+
+    /**
+     * @brief Get number of connections in the latest dump
+     * @return Connection count
+     */
+    size_t getConnectionCount() const;
+
+    /**
+     * @brief Get the busiest flows of the latest update
+     * @return Flows, busiest (receive + send) first
+     */
+    const std::vector<FlowInfo>& getTopFlows() const;
+
+    /**
+     * @brief Get the receive rate over all connections
+     * @return Bytes/sec
+     */
+    double getTotalReceiveRate() const;
+
+    /**
+     * @brief Get the send rate over all connections
+     * @return Bytes/sec
+     */
+    double getTotalSendRate() const;
+
+    /**
+     * @brief Get the registry name ("connections")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register "net.connections"
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the connection count
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+    /**
+     * @brief Format an endpoint
+     * @param endpoint Endpoint
+     * @return "a.b.c.d:port" or "[v6]:port"
+     */
+    static std::string formatEndpoint(const ConnectionEndpoint& endpoint);
+
+    static constexpr int DEFAULT_TOP_COUNT = 10;
+
+private:
+    std::unique_ptr<ConnectionDataSource> m_source; // Data source
+
+    ConnectionTable m_previous;             // Dump of the previous sample
+    ConnectionTable m_current;              // Dump of the current sample
+    std::vector<uint32_t> m_previousOrder;  // Rows of m_previous sorted by id
+    std::vector<uint32_t> m_currentOrder;   // Rows of m_current sorted by id
+    std::vector<double> m_receiveRates;     // Per row of m_current
+    std::vector<double> m_sendRates;        // Per row of m_current
+    std::vector<uint32_t> m_ranking;        // Rows of m_current, busiest first
+    std::vector<FlowInfo> m_topFlows;       // Busiest flows
+    double m_totalReceiveRate;              // Over all connections
+    double m_totalSendRate;                 // Over all connections
+    uint64_t m_previousTime;                // Timestamp of m_previous (us)
+    size_t m_connectionCount;               // Connections in the latest dump
+    int m_topCount;                         // Flows kept per update
+    bool m_initialized;                     // Initialization status
+
+    /**
+     * @brief Dump the connections and recompute rates and top flows
+     */
+    void collectData();
+
+    /**
+     * @brief Fill an index array with the rows of a table sorted by id
+     */
+    static void sortById(const ConnectionTable& table, std::vector<uint32_t>& order);
+};
+
+#endif // CONNECTIONMONITOR_H
@@ -0,0 +1,410 @@
+#ifndef DATASOURCES_H
+#define DATASOURCES_H
+
+#include "monitors/CPUMonitor.h"
+#include "monitors/ConnectionMonitor.h"
+#include "monitors/DiskMonitor.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/NetworkMonitor.h"
+#include "monitors/NetStackMonitor.h"
+#include "monitors/PerfMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "monitors/SchedMonitor.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Data-source interfaces used by the monitors.
+ *
+ * Monitors never call OS APIs directly: they pull raw samples from a data
+ * source. The default sources wrap the Windows APIs (WinDataSources.h);
+ * tests, benchmarks and load generators inject FixtureDataSources (files
+ * under a root directory) or their own implementations instead.
+ */
+
+/**
+ * @class CPUDataSource
+ * @brief Source of raw per-core CPU time counters
+ */
+class CPUDataSource {
+public:
+    virtual ~CPUDataSource() = default;
+
+    /**
+     * @brief Prepare the source
+     * @param coreCount Output number of logical processors
+     * @return true if the source is usable
+     */
+    virtual bool open(int& coreCount) = 0;
+
+    /**
+     * @brief Take one sample of the cumulative counters
+     * @param times Output counters, pre-sized to coreCount; columns the
+     *              platform does not track are left at zero
+     * @return true if the sample is valid
+     */
+    virtual bool sample(CPUTimes& times) = 0;
+};
+
+/**
+ * @class ThermalDataSource
+ * @brief Source of per-core frequency and throttling state and of
+ *        temperature sensors
+ */
+class ThermalDataSource {
+public:
+    virtual ~ThermalDataSource() = default;
+
+    /**
+     * @brief Prepare the source (open handles once; sample() reuses them)
+     * @param coreCount Number of logical processors reported by the CPUDataSource
+     * @return true if the source is usable
+     */
+    virtual bool open(int coreCount) = 0;
+
+    /**
+     * @brief Take one sample
+     * @param thermals Output readings, per-core arrays pre-sized to
+     *                 coreCount; the sensor lists are refilled
+     * @return true if the sample is valid
+     */
+    virtual bool sample(CPUThermals& thermals) = 0;
+};
+
+/**
+ * @struct MemoryStatus
+ * @brief Raw physical and virtual memory figures
+ */
+struct MemoryStatus {
+    uint64_t totalPhys;             // Total physical memory in bytes
+    uint64_t availPhys;             // Available physical memory in bytes
+    uint64_t totalPageFile;         // Commit limit in bytes
+    uint64_t availPageFile;         // Available commit in bytes
+    uint32_t memoryLoad;            // Memory load percentage (0 - 100)
+};
+
+/**
+ * @class MemoryDataSource
+ * @brief Source of system memory status
+ */
+class MemoryDataSource {
+public:
+    virtual ~MemoryDataSource() = default;
+
+    /**
+     * @brief Take one sample
+     * @param status Output memory status
+     * @return true if the sample is valid
+     */
+    virtual bool sample(MemoryStatus& status) = 0;
+};
+
+/**
+ * @class PerfDataSource
+ * @brief Source of per-CPU scheduler, memory and hardware event counters
+ */
+class PerfDataSource {
+public:
+    virtual ~PerfDataSource() = default;
+
+    /**
+     * @brief Prepare the source
+     * @param counters Output: resized to the CPU count, with the
+     *                 available and perCpu flags of every event set
+     * @return true if the source is usable
+     */
+    virtual bool open(PerfCounters& counters) = 0;
+
+    /**
+     * @brief Take one sample of the cumulative counters
+     * @param counters Counters prepared by open(); only available events are written
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(PerfCounters& counters, uint64_t& timestampUs) = 0;
+};
+
+/**
+ * @struct CPUTopology
+ * @brief Placement of every logical CPU, indexed like CPUTimes columns
+ *
+ * IDs are dense (0 - count-1) so they can index per-node and per-package
+ * arrays directly. Logical CPUs with the same core ID are SMT siblings.
+ */
+struct CPUTopology {
+    std::vector<int> node;          // NUMA node of each logical CPU
+    std::vector<int> package;       // Socket of each logical CPU
+    std::vector<int> die;           // Die of each logical CPU (= package if unknown)
+    std::vector<int> core;          // Physical core of each logical CPU
+    int nodeCount;
+    int packageCount;
+    int dieCount;
+    int coreCount;
+
+    CPUTopology();
+
+    /**
+     * @brief Get number of logical CPUs
+     * @return Logical CPU count
+     */
+    int cpuCount() const;
+};
+
+/**
+ * @struct NodeMemory
+ * @brief Memory of one NUMA node
+ */
+struct NodeMemory {
+    uint64_t totalPhys;             // Memory attached to the node in bytes
+    uint64_t availPhys;             // Available memory on the node in bytes
+    uint64_t localPages;            // Allocations by this node's CPUs served locally (cumulative)
+    uint64_t remotePages;           // Allocations by this node's CPUs served by another node (cumulative)
+};
+
+/**
+ * @class TopologyDataSource
+ * @brief Source of the CPU topology and per-node memory
+ */
+class TopologyDataSource {
+public:
+    virtual ~TopologyDataSource() = default;
+
+    /**
+     * @brief Read the CPU topology (static for the lifetime of the process)
+     * @param topology Output topology
+     * @return true if the topology is valid
+     */
+    virtual bool readTopology(CPUTopology& topology) = 0;
+
+    /**
+     * @brief Take one sample of per-node memory
+     * @param nodes Output memory per node, pre-sized to nodeCount; the
+     *              locality counters stay zero if the platform has none
+     * @return true if the sample is valid
+     */
+    virtual bool sampleNodes(std::vector<NodeMemory>& nodes) = 0;
+};
+
+/**
+ * @class DiskDataSource
+ * @brief Source of volume list, space and I/O speed
+ */
+class DiskDataSource {
+public:
+    virtual ~DiskDataSource() = default;
+
+    /**
+     * @brief Enumerate volumes (fills driveLetter; volumeName and
+     *        fileSystem are left empty for describe())
+     * @param disks Output volume list
+     * @return true if at least the enumeration succeeded
+     */
+    virtual bool enumerate(std::vector<DiskInfo>& disks) = 0;
+
+    /**
+     * @brief Fill volumeName and fileSystem of one volume
+     *
+     * Runs on a worker thread, concurrently with sampleSpace() and
+     * sampleSpeeds() (never with another describe()), on a copy of the
+     * volume; it must not touch the state the sample calls use.
+     *
+     * @param disk Volume returned by enumerate()
+     */
+    virtual void describe(DiskInfo& disk) = 0;
+
+    /**
+     * @brief Fill totalSpace and freeSpace of every volume
+     * @param disks Volumes returned by enumerate()
+     */
+    virtual void sampleSpace(std::vector<DiskInfo>& disks) = 0;
+
+    /**
+     * @brief Fill readSpeed and writeSpeed of every volume
+     * @param disks Volumes returned by enumerate()
+     */
+    virtual void sampleSpeeds(std::vector<DiskInfo>& disks) = 0;
+};
+
+/**
+ * @class NetworkDataSource
+ * @brief Source of per-interface traffic counters
+ */
+class NetworkDataSource {
+public:
+    virtual ~NetworkDataSource() = default;
+
+    /**
+     * @brief Take one sample (fills name, description, byte counters, isActive)
+     * @param interfaces Output interface list (cleared first)
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) = 0;
+};
+
+/**
+ * @class NetStackDataSource
+ * @brief Source of cumulative TCP, UDP and IP protocol counters
+ */
+class NetStackDataSource {
+public:
+    virtual ~NetStackDataSource() = default;
+
+    /**
+     * @brief Prepare the source
+     * @param counters Output: available flags of every counter set
+     * @return true if the source is usable
+     */
+    virtual bool open(NetStackCounters& counters) = 0;
+
+    /**
+     * @brief Take one sample of the cumulative counters
+     * @param counters Counters prepared by open(); only available counters are written
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(NetStackCounters& counters, uint64_t& timestampUs) = 0;
+};
+
+/**
+ * @class ConnectionDataSource
+ * @brief Source of per-socket TCP byte counters
+ */
+class ConnectionDataSource {
+public:
+    virtual ~ConnectionDataSource() = default;
+
+    /**
+     * @brief Dump all TCP connections in one batch
+     *
+     * A source that reads the byte counters less often than it is
+     * sampled returns the timestamp of the last read again; the monitor
+     * then only takes the connection list and keeps its rates.
+     *
+     * @param table Output table (cleared by the caller)
+     * @param timestampUs Output time the byte counters were read in
+     *        microseconds (SystemUtils::monotonicMicros)
+     * @return true if the dump is valid
+     */
+    virtual bool sample(ConnectionTable& table, uint64_t& timestampUs) = 0;
+
+    /**
+     * @brief Get the name of a process owning connections
+     * @param pid Process ID
+     * @return Executable name (NameTable::EMPTY if unknown)
+     */
+    virtual NameId processName(uint32_t pid) = 0;
+};
+
+/**
+ * @class ProcessDataSource
+ * @brief Source of per-process I/O counters and memory breakdowns
+ */
+class ProcessDataSource {
+public:
+    virtual ~ProcessDataSource() = default;
+
+    /**
+     * @brief Read the I/O counters and resident set of every tracked process
+     * @param processes Output rows, one per process, sorted by PID
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) = 0;
+
+    /**
+     * @brief Walk the resident pages of a tracked process (expensive)
+     * @param pid Process ID
+     * @param memory Output breakdown
+     * @return false if the process cannot be inspected
+     */
+    virtual bool readMemory(uint32_t pid, ProcessMemory& memory) = 0;
+
+    /**
+     * @brief Subscribe to process start/exit notifications
+     * @return false if unavailable (e.g. missing privileges): sample() then
+     *         rescans all processes every time
+     */
+    virtual bool openEvents() = 0;
+
+    /**
+     * @brief Take the processes that exited up to the latest sample()
+     * @param exits Output exits with their final totals (cleared first)
+     */
+    virtual void drainExits(std::vector<ProcessExit>& exits) = 0;
+
+    /**
+     * @brief Get the name of a tracked process
+     * @param pid Process ID
+     * @return Executable name (NameTable::EMPTY if unknown)
+     */
+    virtual NameId processName(uint32_t pid) = 0;
+};
+
+/**
+ * @class InterruptDataSource
+ * @brief Source of per-CPU interrupt and softirq/DPC counters
+ */
+class InterruptDataSource {
+public:
+    virtual ~InterruptDataSource() = default;
+
+    /**
+     * @brief Prepare the source
+     * @param cpuCount Output number of CPUs
+     * @return true if the source is usable
+     */
+    virtual bool open(int& cpuCount) = 0;
+
+    /**
+     * @brief Take one sample of the cumulative counters
+     * @param counters Output counters, reset to cpuCount columns with no rows
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(InterruptCounters& counters, uint64_t& timestampUs) = 0;
+};
+
+/**
+ * @class SchedDataSource
+ * @brief Source of per-CPU run-queue wait time and timeslice counters
+ */
+class SchedDataSource {
+public:
+    virtual ~SchedDataSource() = default;
+
+    /**
+     * @brief Prepare the source
+     * @param counters Output: resized to the CPU count, with waitPerCpu set
+     * @return true if the source is usable
+     */
+    virtual bool open(SchedCounters& counters) = 0;
+
+    /**
+     * @brief Take one sample of the cumulative counters
+     * @param counters Counters prepared by open()
+     * @param timestampUs Output sample time in microseconds (SystemUtils::monotonicMicros)
+     * @return true if the sample is valid
+     */
+    virtual bool sample(SchedCounters& counters, uint64_t& timestampUs) = 0;
+};
+
+/**
+ * @brief Create the platform's default sources (nullptr if unsupported)
+ */
+std::unique_ptr<CPUDataSource> createDefaultCPUDataSource();
+std::unique_ptr<ThermalDataSource> createDefaultThermalDataSource();
+std::unique_ptr<MemoryDataSource> createDefaultMemoryDataSource();
+std::unique_ptr<DiskDataSource> createDefaultDiskDataSource();
+std::unique_ptr<NetworkDataSource> createDefaultNetworkDataSource();
+std::unique_ptr<NetStackDataSource> createDefaultNetStackDataSource();
+std::unique_ptr<ConnectionDataSource> createDefaultConnectionDataSource();
+std::unique_ptr<ProcessDataSource> createDefaultProcessDataSource();
+std::unique_ptr<InterruptDataSource> createDefaultInterruptDataSource();
+std::unique_ptr<TopologyDataSource> createDefaultTopologyDataSource();
+std::unique_ptr<PerfDataSource> createDefaultPerfDataSource();
+std::unique_ptr<SchedDataSource> createDefaultSchedDataSource();
+
+#endif // DATASOURCES_H
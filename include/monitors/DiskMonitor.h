@@ -1,26 +1,31 @@
 #ifndef DISKMONITOR_H
 #define DISKMONITOR_H
 
-#include <windows.h>
-#include <pdh.h>
+#include "core/Collector.h"
+#include "core/NameTable.h"
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 #include <cstdint>
 
+class DiskDataSource;
+
 /**
  * @struct DiskInfo
  * @brief Information about a single disk drive
  */
 struct DiskInfo {
-    std::wstring driveLetter;      // Drive letter (e.g., "C:")
+    NameId driveLetter;             // Drive letter (e.g., "C:", NameTable)
     uint64_t totalSpace;            // Total space in bytes
     uint64_t freeSpace;             // Free space in bytes
     uint64_t usedSpace;             // Used space in bytes
     double usagePercent;            // Usage percentage
     double readSpeed;               // Read speed in bytes/sec
     double writeSpeed;              // Write speed in bytes/sec
-    std::wstring volumeName;        // Volume name
-    std::wstring fileSystem;        // File system type (NTFS, FAT32, etc.)
+    NameId volumeName;              // Volume name (NameTable)
+    NameId fileSystem;              // File system type (NTFS, FAT32, etc., NameTable)
+    bool described;                 // volumeName and fileSystem fetched
 };
 
 /**
@@ -30,14 +35,27 @@ struct DiskInfo {
  * This class provides:
  * - Disk space information for all drives
  * - Read/write speeds using PDH counters
- * - File system information
+ * - File system information, fetched on first use
+ *
+ * Data comes from a DiskDataSource (Windows APIs by default).
+ * Volume names and file systems are not needed for metrics and can take
+ * seconds to read from a slow or empty removable drive, so they are only
+ * fetched by describeVolumes(), which the Disk tab calls when shown. The
+ * fetch runs on a worker thread on copies of the volumes; update() takes
+ * the names once it has finished, so a stalled drive never blocks a tick.
  */
-class DiskMonitor {
+class DiskMonitor : public Collector {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor - Uses the platform's default data source
      */
     DiskMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit DiskMonitor(std::unique_ptr<DiskDataSource> source);
     
     /**
      * @brief Destructor
@@ -48,12 +66,12 @@ public:
      * @brief Initialize the disk monitor
      * @return true if initialization successful, false otherwise
      */
-    bool initialize();
+    bool initialize() override;
 
     /**
      * @brief Update disk usage and speed information
      */
-    void update();
+    void update() override;
 
     /**
      * @brief Get disk information for all drives
@@ -74,29 +92,42 @@ public:
      */
     int getDriveCount() const;
 
+    /**
+     * @brief Start fetching the volume name and file system of volumes not
+     *        yet described on a worker thread (no-op while a fetch runs or
+     *        once all are described); update() applies the result
+     */
+    void describeVolumes();
+
+    /**
+     * @brief Get the registry name ("disk")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register "disk.<drive>.free_percent" for each disk found by initialize()
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the free space of each disk
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
     /**
      * @brief Check if monitor is initialized
      * @return true if initialized, false otherwise
      */
-    bool isInitialized() const;
+    bool isInitialized() const override;
 
 private:
     std::vector<DiskInfo> m_disks;      // Information for all disks
-    PDH_HQUERY m_query;                 // PDH query handle
-    
-    struct SpeedCounters {
-        PDH_HCOUNTER readCounter;
-        PDH_HCOUNTER writeCounter;
-        std::wstring diskName;
-    };
-    std::vector<SpeedCounters> m_speedCounters; // Speed counters for each disk
-    
+    std::unique_ptr<DiskDataSource> m_source;   // Data source
+    std::vector<int> m_freeSeries;      // Free space series per disk
     bool m_initialized;                 // Initialization status
-
-    /**
-     * @brief Enumerate all available drives
-     */
-    void enumerateDrives();
+    std::future<std::vector<DiskInfo>> m_describing;    // Volumes being described (worker)
 
     /**
      * @brief Collect disk space information
@@ -104,14 +135,14 @@ private:
     void collectSpaceInfo();
 
     /**
-     * @brief Collect disk speed information from PDH
+     * @brief Collect disk speed information
      */
     void collectSpeedInfo();
-    
+
     /**
-     * @brief Setup PDH counters for disk I/O monitoring
+     * @brief Copy the names of a finished describeVolumes() into m_disks
      */
-    bool setupSpeedCounters();
+    void applyDescriptions();
 };
 
 #endif // DISKMONITOR_H
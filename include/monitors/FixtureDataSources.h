@@ -0,0 +1,344 @@
+#ifndef FIXTUREDATASOURCES_H
+#define FIXTUREDATASOURCES_H
+
+#include "monitors/DataSources.h"
+#include <string>
+#include <vector>
+#include <filesystem>
+
+/**
+ * Data sources that replay text fixtures from a root directory instead of
+ * querying the OS, for deterministic tests, benchmarks and load tests.
+ *
+ * Every file holds one sample per line ('#' starts a comment). Lines are
+ * replayed in order and wrap around at the end, and a file is re-read
+ * when its modification time changes, so a generator can rewrite the
+ * fixtures while the monitors run.
+ *
+ * Layout of <root>:
+ *   cpu         <user> <nice> <system> <idle> <iowait> <irq> <softirq> <steal> <guest>
+ *               repeated per core                            (ticks since the previous line)
+ *   cpufreq     <currentMhz> <maxMhz> <limitMhz> <throttleCount>  repeated per core
+ *   sensors     <name>                                        (static, one per temperature sensor)
+ *   thermal     <celsius>  repeated per sensor
+ *   memory      <totalPhys> <availPhys> <totalPageFile> <availPageFile> <load>
+ *   volumes     <drive>\t<volumeName>\t<fileSystem>           (static, one per volume)
+ *   disks       <total> <free> <readBps> <writeBps>  repeated per volume
+ *   interfaces  <name>\t<active 0|1>                          (static, one per interface)
+ *   network     <timestampMs> <rx> <tx> [<rxPackets> <txPackets> <rxErrors> <txErrors> <rxDrops> <txDrops>]
+ *               repeated per interface                       (all interfaces with or all without the packet columns)
+ *   connections <id> <pid> <local a.b.c.d:port> <remote a.b.c.d:port> <bytesReceived> <bytesAcked>
+ *               one line per socket, dumps separated by "---" lines (1000 ms apart)
+ *   processes   <pid>\t<name>                                 (static)
+ *   process_io  <pid> <readBytes> <writeBytes> <readOps> <writeOps> [<cpuMicros>]
+ *               one line per process, samples separated by "---" lines (1000 ms apart)
+ *   process_memory <pid> <resident> <proportional> <unique> <swapped>
+ *               samples aligned with process_io (optional; missing processes
+ *               have no resident set and cannot be walked)
+ *   process_exits <pid> <parentPid> <lifetimeMs> <cpuMicros> <readBytes> <writeBytes> <name>
+ *               exits reported with each process_io sample, "none" for a sample
+ *               without exits (optional; present = event-driven source)
+ *   snmp        /proc/net/snmp snapshots separated by "---" lines (1000 ms apart)
+ *   netstat     /proc/net/netstat snapshots, same layout (optional)
+ *   interrupts  /proc/interrupts snapshots separated by "---" lines
+ *   softirqs    /proc/softirqs snapshots separated by "---" lines
+ *               (one snapshot per sample, taken 1000 ms apart)
+ *   perf        <switches> <migrations> <faults> <cycles> <instructions> <cacheMisses>
+ *               repeated per CPU                             (events since the previous line, 1000 ms apart)
+ *   schedstat   /proc/schedstat snapshots separated by "---" lines (1000 ms apart)
+ *   topology    <node> <package> <die> <core>                 (static, one per logical CPU)
+ *   numa        <totalPhys> <availPhys> <localPages> <remotePages>  repeated per node
+ */
+
+/**
+ * @class FixtureFile
+ * @brief Line-per-sample fixture file with wrap-around replay
+ */
+class FixtureFile {
+public:
+    explicit FixtureFile(const std::filesystem::path& path);
+
+    /**
+     * @brief Get the next sample line
+     * @param line Output line
+     * @return false if the file is missing or has no samples
+     */
+    bool next(std::string& line);
+
+    /**
+     * @brief Get the next multi-line sample (lines up to a "---" line)
+     * @param block Output lines joined with '\n'
+     * @return false if the file is missing or has no samples
+     */
+    bool nextBlock(std::string& block);
+
+    /**
+     * @brief Get the first multi-line sample without advancing the replay
+     *        (e.g. to learn a table layout in open())
+     * @param block Output lines joined with '\n'
+     * @return false if the file is missing or has no samples
+     */
+    bool firstBlock(std::string& block);
+
+    /**
+     * @brief Get all sample lines (for static files such as "volumes")
+     * @return Sample lines, reloaded if the file changed
+     */
+    const std::vector<std::string>& lines();
+
+    /**
+     * @brief Parse whitespace-separated numbers
+     * @param line Input line
+     * @param values Output values (cleared first)
+     */
+    static void parseNumbers(const std::string& line, std::vector<double>& values);
+
+private:
+    std::filesystem::path m_path;
+    std::filesystem::file_time_type m_loadedTime;
+    std::vector<std::string> m_lines;
+    size_t m_cursor;
+    bool m_loaded;
+
+    /**
+     * @brief Reload the file if it changed since the last load
+     */
+    void refresh();
+};
+
+/**
+ * @class FixtureCPUDataSource
+ * @brief Replays <root>/cpu, accumulating the per-line ticks into counters
+ */
+class FixtureCPUDataSource : public CPUDataSource {
+public:
+    explicit FixtureCPUDataSource(const std::filesystem::path& root);
+
+    bool open(int& coreCount) override;
+    bool sample(CPUTimes& times) override;
+
+private:
+    FixtureFile m_file;
+    std::vector<double> m_values;
+    CPUTimes m_counters;            // Running sum of the replayed ticks
+};
+
+/**
+ * @class FixtureThermalDataSource
+ * @brief Replays <root>/cpufreq and <root>/thermal, sensor names from
+ *        <root>/sensors
+ */
+class FixtureThermalDataSource : public ThermalDataSource {
+public:
+    explicit FixtureThermalDataSource(const std::filesystem::path& root);
+
+    bool open(int coreCount) override;
+    bool sample(CPUThermals& thermals) override;
+
+private:
+    FixtureFile m_frequencies;
+    FixtureFile m_sensors;
+    FixtureFile m_temperatures;
+    std::vector<double> m_values;
+};
+
+/**
+ * @class FixtureMemoryDataSource
+ * @brief Replays <root>/memory
+ */
+class FixtureMemoryDataSource : public MemoryDataSource {
+public:
+    explicit FixtureMemoryDataSource(const std::filesystem::path& root);
+
+    bool sample(MemoryStatus& status) override;
+
+private:
+    FixtureFile m_file;
+    std::vector<double> m_values;
+};
+
+/**
+ * @class FixtureDiskDataSource
+ * @brief Reads <root>/volumes and replays <root>/disks
+ */
+class FixtureDiskDataSource : public DiskDataSource {
+public:
+    explicit FixtureDiskDataSource(const std::filesystem::path& root);
+
+    bool enumerate(std::vector<DiskInfo>& disks) override;
+    void describe(DiskInfo& disk) override;
+    void sampleSpace(std::vector<DiskInfo>& disks) override;
+    void sampleSpeeds(std::vector<DiskInfo>& disks) override;
+
+private:
+    FixtureFile m_volumes;
+    FixtureFile m_file;
+    std::vector<double> m_values;
+};
+
+/**
+ * @class FixtureNetworkDataSource
+ * @brief Reads <root>/interfaces and replays <root>/network
+ */
+class FixtureNetworkDataSource : public NetworkDataSource {
+public:
+    explicit FixtureNetworkDataSource(const std::filesystem::path& root);
+
+    bool sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) override;
+
+private:
+    FixtureFile m_interfaces;
+    FixtureFile m_file;
+    std::vector<double> m_values;
+    uint64_t m_lastTimestamp;       // Last timestamp handed out
+    uint64_t m_timeOffset;          // Added after wrap-around to keep time monotonic
+};
+
+/**
+ * @class FixtureInterruptDataSource
+ * @brief Replays <root>/interrupts and <root>/softirqs snapshots through
+ *        InterruptMonitor::parseProcTable
+ */
+class FixtureInterruptDataSource : public InterruptDataSource {
+public:
+    explicit FixtureInterruptDataSource(const std::filesystem::path& root);
+
+    bool open(int& cpuCount) override;
+    bool sample(InterruptCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    FixtureFile m_interrupts;
+    FixtureFile m_softirqs;
+    std::string m_block;
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixtureConnectionDataSource
+ * @brief Replays <root>/connections dumps, naming processes from
+ *        <root>/processes
+ */
+class FixtureConnectionDataSource : public ConnectionDataSource {
+public:
+    explicit FixtureConnectionDataSource(const std::filesystem::path& root);
+
+    bool sample(ConnectionTable& table, uint64_t& timestampUs) override;
+    NameId processName(uint32_t pid) override;
+
+    /**
+     * @brief Parse "a.b.c.d:port"
+     * @param text Endpoint text
+     * @param endpoint Output endpoint
+     * @return false if the text is not an IPv4 endpoint
+     */
+    static bool parseEndpoint(const std::string& text, ConnectionEndpoint& endpoint);
+
+private:
+    FixtureFile m_connections;
+    FixtureFile m_processes;
+    std::string m_block;
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixtureProcessDataSource
+ * @brief Replays <root>/process_io, <root>/process_memory and
+ *        <root>/process_exits samples, naming processes from <root>/processes
+ */
+class FixtureProcessDataSource : public ProcessDataSource {
+public:
+    explicit FixtureProcessDataSource(const std::filesystem::path& root);
+
+    bool sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) override;
+    bool readMemory(uint32_t pid, ProcessMemory& memory) override;
+    bool openEvents() override;
+    void drainExits(std::vector<ProcessExit>& exits) override;
+    NameId processName(uint32_t pid) override;
+
+private:
+    FixtureFile m_io;
+    FixtureFile m_memory;
+    FixtureFile m_exitFile;
+    FixtureFile m_processes;
+    std::string m_block;
+    std::vector<std::pair<uint32_t, ProcessMemory>> m_breakdowns;  // Of the current sample
+    std::vector<ProcessExit> m_exits;   // Reported since the last drainExits()
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixtureNetStackDataSource
+ * @brief Replays <root>/snmp and <root>/netstat snapshots through
+ *        SnmpTableParser
+ */
+class FixtureNetStackDataSource : public NetStackDataSource {
+public:
+    explicit FixtureNetStackDataSource(const std::filesystem::path& root);
+
+    bool open(NetStackCounters& counters) override;
+    bool sample(NetStackCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    FixtureFile m_snmp;
+    FixtureFile m_netstat;
+    SnmpTableParser m_snmpParser;
+    SnmpTableParser m_netstatParser;
+    std::string m_block;
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixtureSchedDataSource
+ * @brief Replays <root>/schedstat snapshots through
+ *        SchedMonitor::parseSchedstat
+ */
+class FixtureSchedDataSource : public SchedDataSource {
+public:
+    explicit FixtureSchedDataSource(const std::filesystem::path& root);
+
+    bool open(SchedCounters& counters) override;
+    bool sample(SchedCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    FixtureFile m_file;
+    std::string m_block;
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixturePerfDataSource
+ * @brief Replays <root>/perf, accumulating the per-line counts into
+ *        counters (every event available and counted per CPU)
+ */
+class FixturePerfDataSource : public PerfDataSource {
+public:
+    explicit FixturePerfDataSource(const std::filesystem::path& root);
+
+    bool open(PerfCounters& counters) override;
+    bool sample(PerfCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    FixtureFile m_file;
+    std::vector<double> m_values;
+    PerfCounters m_counters;        // Running sum of the replayed counts
+    uint64_t m_timestamp;           // Advances 1 s per sample (us)
+};
+
+/**
+ * @class FixtureTopologyDataSource
+ * @brief Reads <root>/topology and replays <root>/numa
+ */
+class FixtureTopologyDataSource : public TopologyDataSource {
+public:
+    explicit FixtureTopologyDataSource(const std::filesystem::path& root);
+
+    bool readTopology(CPUTopology& topology) override;
+    bool sampleNodes(std::vector<NodeMemory>& nodes) override;
+
+private:
+    FixtureFile m_topology;
+    FixtureFile m_file;
+    std::vector<double> m_values;
+};
+
+#endif // FIXTUREDATASOURCES_H
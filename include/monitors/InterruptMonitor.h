@@ -0,0 +1,228 @@
+#ifndef INTERRUPTMONITOR_H
+#define INTERRUPTMONITOR_H
+
+#include "core/Collector.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class InterruptDataSource;
+
+/**
+ * @struct InterruptCounters
+ * @brief Cumulative interrupt counts per source and CPU
+ *
+ * counts is a sources x cpuCount matrix in row-major order. A source is
+ * either a hardware interrupt line ("35 eth0-TxRx-0", "LOC", or the
+ * "Interrupts" total on Windows) or a deferred one (softirq such as
+ * "NET_RX", or "DPC" on Windows).
+ */
+struct InterruptCounters {
+    int cpuCount;                       // Columns per row
+    std::vector<std::string> names;     // Source names, one per row
+    std::vector<uint8_t> deferred;      // 1 = softirq/DPC row, 0 = hardware IRQ row
+    std::vector<uint64_t> counts;       // names.size() x cpuCount counters
+
+    InterruptCounters();
+
+    /**
+     * @brief Remove all rows
+     * @param cpus Number of CPU columns
+     */
+    void reset(int cpus);
+
+    /**
+     * @brief Get number of sources
+     * @return Row count
+     */
+    int sourceCount() const;
+
+    /**
+     * @brief Append a zeroed row
+     * @param name Source name
+     * @param isDeferred true for a softirq/DPC row
+     * @return Pointer to the cpuCount counters of the new row
+     */
+    uint64_t* addSource(const std::string& name, bool isDeferred);
+};
+
+/**
+ * @class InterruptMonitor
+ * @brief Per-CPU interrupt and softirq/DPC rates from an InterruptDataSource
+ *        (processor interrupt and DPC counters by default)
+ *
+ * Every update turns two counter matrices into a per-source, per-CPU rate
+ * matrix and flags hotspot CPUs: cores that take far more interrupts than
+ * the average core, typically a NIC queue pinned to one CPU.
+ */
+class InterruptMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    InterruptMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit InterruptMonitor(std::unique_ptr<InterruptDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~InterruptMonitor();
+
+    /**
+     * @brief Initialize the interrupt monitor
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update interrupt rates (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Get number of CPUs
+     * @return CPU count
+     */
+    int getCpuCount() const;
+
+    /**
+     * @brief Get number of interrupt sources
+     * @return Source count
+     */
+    int getSourceCount() const;
+
+    /**
+     * @brief Get the name of a source
+     * @param source Source index
+     * @return Source name ("" if the index is invalid)
+     */
+    std::string getSourceName(int source) const;
+
+    /**
+     * @brief Check if a source is a softirq/DPC source
+     * @param source Source index
+     * @return true for deferred sources
+     */
+    bool isDeferred(int source) const;
+
+    /**
+     * @brief Find a source by name
+     * @param name Source name (e.g. "NET_RX")
+     * @return Source index or -1
+     */
+    int findSource(const std::string& name) const;
+
+    /**
+     * @brief Get the rate of one source on one CPU
+     * @param source Source index
+     * @param cpu CPU index
+     * @return Interrupts per second
+     */
+    double getRate(int source, int cpu) const;
+
+    /**
+     * @brief Get the rate of one source over all CPUs
+     * @param source Source index
+     * @return Interrupts per second (0.0 if the index is invalid)
+     */
+    double getSourceRate(int source) const;
+
+    /**
+     * @brief Get the hardware interrupt rate of a CPU
+     * @param cpu CPU index
+     * @return Interrupts per second
+     */
+    double getCpuRate(int cpu) const;
+
+    /**
+     * @brief Get the softirq/DPC rate of a CPU
+     * @param cpu CPU index
+     * @return Deferred interrupts per second
+     */
+    double getCpuDeferredRate(int cpu) const;
+
+    /**
+     * @brief Get the busiest hardware sources of a CPU
+     * @param cpu CPU index
+     * @param count Maximum number of sources
+     * @return Source indices, busiest first (sources with a zero rate omitted)
+     */
+    std::vector<int> getTopSources(int cpu, int count) const;
+
+    /**
+     * @brief Check if a CPU is an interrupt hotspot
+     * @param cpu CPU index
+     * @return true if the CPU takes over HOTSPOT_FACTOR times the average
+     *         interrupt rate of the other CPUs and at least
+     *         HOTSPOT_MIN_RATE interrupts/s
+     */
+    bool isHotspot(int cpu) const;
+
+    /**
+     * @brief Get the registry name ("interrupts")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register "irq.core.<n>" for each CPU
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the interrupt + deferred rate of each CPU
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+    /**
+     * @brief Parse a /proc/interrupts or /proc/softirqs style table in one
+     *        pass and append its rows to counters
+     *
+     * The header line names the CPU columns. Rows may carry fewer numbers
+     * than CPUs (e.g. "ERR:" and "MIS:") and a trailing description; a
+     * numeric IRQ is named "<irq> <last description token>" (the device).
+     *
+     * @param text Table text
+     * @param isDeferred true for softirq tables
+     * @param counters Output counters; reset to the table's CPU count if
+     *        they hold no rows yet
+     * @return false if the header has no CPU columns
+     */
+    static bool parseProcTable(const std::string& text, bool isDeferred, InterruptCounters& counters);
+
+    static constexpr double HOTSPOT_FACTOR = 4.0;       // Times the mean rate of the other CPUs
+    static constexpr double HOTSPOT_MIN_RATE = 1000.0;  // Interrupts per second
+
+private:
+    std::unique_ptr<InterruptDataSource> m_source;  // Data source
+
+    InterruptCounters m_previous;           // Counters of the previous sample
+    InterruptCounters m_current;            // Counters of the current sample
+    std::vector<double> m_rates;            // Per-source, per-CPU rates (row-major)
+    std::vector<double> m_cpuRates;         // Hardware rate per CPU
+    std::vector<double> m_cpuDeferredRates; // Softirq/DPC rate per CPU
+    uint64_t m_previousTime;                // Timestamp of m_previous (us)
+    uint64_t m_currentTime;                 // Timestamp of m_current (us)
+    std::vector<int> m_cpuSeries;           // "irq.core.<n>"
+    bool m_initialized;                     // Initialization status
+
+    /**
+     * @brief Sample the counters and recompute the rates
+     */
+    void collectData();
+};
+
+#endif // INTERRUPTMONITOR_H
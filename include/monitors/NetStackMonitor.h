@@ -0,0 +1,210 @@
+#ifndef NETSTACKMONITOR_H
+#define NETSTACKMONITOR_H
+
+#include "core/Collector.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class NetStackDataSource;
+
+/**
+ * @struct NetStackCounters
+ * @brief Cumulative TCP, UDP and IP protocol counters
+ *
+ * Counters the source cannot read are flagged unavailable (e.g. listen
+ * queue overflows and SYN cookies have no Windows counterpart).
+ */
+struct NetStackCounters {
+    enum Counter {
+        TcpOutSegments,         // Tcp OutSegs
+        TcpRetransmits,         // Tcp RetransSegs
+        TcpResets,              // Tcp OutRsts
+        TcpEstablishedResets,   // Tcp EstabResets
+        TcpListenOverflows,     // TcpExt ListenOverflows
+        TcpListenDrops,         // TcpExt ListenDrops
+        TcpSynCookies,          // TcpExt SyncookiesSent
+        UdpReceiveErrors,       // Udp InErrors
+        UdpBufferErrors,        // Udp RcvbufErrors
+        IpReassemblyFailures,   // Ip ReasmFails
+        CounterCount
+    };
+
+    uint64_t values[CounterCount];      // Cumulative counts
+    bool available[CounterCount];       // Counter is read by the source
+
+    NetStackCounters();
+
+    /**
+     * @brief Get the metric name of a counter ("tcp.retransmits", ...)
+     * @param counter Counter
+     * @return Counter name, or "" for an invalid counter
+     */
+    static const char* counterName(Counter counter);
+};
+
+/**
+ * @class SnmpTableParser
+ * @brief Parser for the paired header/value line tables of /proc/net/snmp
+ *        and /proc/net/netstat
+ *
+ * Each table is a "Prefix: Name1 Name2 ..." header line followed by a
+ * "Prefix: v1 v2 ..." value line. bind() maps the columns of interest to
+ * counters once; parse() then walks the value lines and only converts
+ * numbers, without building strings. A layout change (different prefix
+ * order) makes parse() fail so the caller can bind again.
+ */
+class SnmpTableParser {
+public:
+    /**
+     * @struct Column
+     * @brief A counter to pick from a table
+     */
+    struct Column {
+        const char* prefix;             // Table prefix without ':' ("Tcp", "TcpExt")
+        const char* name;               // Column name ("RetransSegs")
+        NetStackCounters::Counter counter;
+    };
+
+    /**
+     * @brief Constructor
+     * @param columns Counters to pick (e.g. SNMP_COLUMNS)
+     */
+    explicit SnmpTableParser(std::vector<Column> columns);
+
+    /**
+     * @brief Build the column-index map from the header lines
+     * @param text Table text
+     * @param counters Counters whose available flags are set for every
+     *        column found
+     * @return true if at least one column was found
+     */
+    bool bind(const std::string& text, NetStackCounters& counters);
+
+    /**
+     * @brief Read the bound columns from the value lines
+     * @param text Table text with the layout seen by bind()
+     * @param counters Output counters
+     * @return false if the layout differs from the bound one
+     */
+    bool parse(const std::string& text, NetStackCounters& counters) const;
+
+    /**
+     * @brief Check if bind() succeeded
+     * @return true if bound
+     */
+    bool isBound() const;
+
+    static const std::vector<Column> SNMP_COLUMNS;      // Columns read from /proc/net/snmp
+    static const std::vector<Column> NETSTAT_COLUMNS;   // Columns read from /proc/net/netstat
+
+private:
+    // One table: its prefix and the counter of every value column (-1 = skip)
+    struct Table {
+        std::string prefix;
+        std::vector<int> counters;
+    };
+
+    std::vector<Column> m_columns;      // Counters to pick
+    std::vector<Table> m_tables;        // Tables in file order
+};
+
+/**
+ * @class NetStackMonitor
+ * @brief TCP/IP stack health rates from a NetStackDataSource
+ *        (IP Helper protocol statistics by default)
+ *
+ * Retransmits, resets, listen queue overflows and drops, SYN cookies,
+ * UDP receive errors and IP reassembly failures per second, the counters
+ * that explain a slow network when the interface throughput looks fine.
+ */
+class NetStackMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    NetStackMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit NetStackMonitor(std::unique_ptr<NetStackDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~NetStackMonitor();
+
+    /**
+     * @brief Initialize the stack monitor
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update counter rates (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Check if a counter is read by the source
+     * @param counter Counter
+     * @return true if available
+     */
+    bool isAvailable(NetStackCounters::Counter counter) const;
+
+    /**
+     * @brief Get the rate of a counter
+     * @param counter Counter
+     * @return Events per second (0.0 if unavailable)
+     */
+    double getRate(NetStackCounters::Counter counter) const;
+
+    /**
+     * @brief Get retransmitted segments relative to sent segments
+     * @return Percentage (0.0 without sent segments)
+     */
+    double getRetransmitPercent() const;
+
+    /**
+     * @brief Get the registry name ("netstack")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the retransmit share and a series per available counter
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the counter rates
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+private:
+    std::unique_ptr<NetStackDataSource> m_source;   // Data source
+
+    NetStackCounters m_previous;                    // Counters of the previous sample
+    NetStackCounters m_current;                     // Counters of the current sample
+    double m_rates[NetStackCounters::CounterCount]; // Rates per counter
+    uint64_t m_previousTime;                        // Timestamp of m_previous (us)
+    std::vector<int> m_counterSeries;               // Indexed by NetStackCounters::Counter (-1 if unavailable)
+    bool m_initialized;                             // Initialization status
+
+    /**
+     * @brief Sample the counters and recompute the rates
+     */
+    void collectData();
+};
+
+#endif // NETSTACKMONITOR_H
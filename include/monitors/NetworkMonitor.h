@@ -1,43 +1,62 @@
 #ifndef NETWORKMONITOR_H
 #define NETWORKMONITOR_H
 
-#include <windows.h>
-#include <iphlpapi.h>
+#include "core/Collector.h"
+#include "core/NameTable.h"
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <cstdint>
 
-#pragma comment(lib, "iphlpapi.lib")
+class NetworkDataSource;
 
 /**
  * @struct NetworkInterfaceInfo
  * @brief Information about a network interface
  */
 struct NetworkInterfaceInfo {
-    std::wstring name;              // Interface name
-    std::wstring description;       // Interface description
+    NameId name;                    // Interface name (NameTable)
+    NameId description;             // Interface description (NameTable)
     uint64_t bytesReceived;         // Total bytes received
     uint64_t bytesSent;             // Total bytes sent
+    uint64_t packetsReceived;       // Total packets received
+    uint64_t packetsSent;           // Total packets sent
+    uint64_t errors;                // Total receive + send errors
+    uint64_t drops;                 // Total receive + send drops (discards)
     double downloadSpeed;           // Download speed in bytes/sec
     double uploadSpeed;             // Upload speed in bytes/sec
+    double packetReceiveRate;       // Packets received/sec
+    double packetSendRate;          // Packets sent/sec
+    double errorRate;               // Errors/sec
+    double dropRate;                // Drops/sec
     bool isActive;                  // Is interface currently active
 };
 
 /**
  * @class NetworkMonitor
- * @brief Monitors network traffic using Windows IP Helper API
+ * @brief Monitors network traffic from a NetworkDataSource
+ *        (Windows IP Helper API by default)
  * 
  * This class provides:
  * - Network interface information
  * - Upload/download speeds
+ * - Packet, error and drop rates
  * - Total bytes transferred
  */
-class NetworkMonitor {
+class NetworkMonitor : public Collector {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor - Uses the platform's default data source
      */
     NetworkMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit NetworkMonitor(std::unique_ptr<NetworkDataSource> source);
     
     /**
      * @brief Destructor
@@ -48,12 +67,12 @@ public:
      * @brief Initialize the network monitor
      * @return true if initialization successful, false otherwise
      */
-    bool initialize();
+    bool initialize() override;
 
     /**
      * @brief Update network statistics
      */
-    void update();
+    void update() override;
 
     /**
      * @brief Get information for all network interfaces
@@ -85,25 +104,62 @@ public:
      */
     uint64_t getTotalBytesUploaded() const;
 
+    /**
+     * @brief Get total error rate across all active interfaces
+     * @return Receive + send errors per second
+     */
+    double getTotalErrorRate() const;
+
+    /**
+     * @brief Get total drop rate across all active interfaces
+     * @return Receive + send drops per second
+     */
+    double getTotalDropRate() const;
+
+    /**
+     * @brief Get the registry name ("network")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the "net.*" totals
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the totals and the per-interface speeds
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
     /**
      * @brief Check if monitor is initialized
      * @return true if initialized, false otherwise
      */
-    bool isInitialized() const;
+    bool isInitialized() const override;
 
 private:
     std::vector<NetworkInterfaceInfo> m_interfaces;  // Network interfaces
+    std::unique_ptr<NetworkDataSource> m_source;     // Data source
     
     // Previous values for speed calculation
     struct PreviousStats {
+        NameId name;            // Interface the counters belong to
         uint64_t bytesReceived;
         uint64_t bytesSent;
-        DWORD timestamp;
+        uint64_t packetsReceived;
+        uint64_t packetsSent;
+        uint64_t errors;
+        uint64_t drops;
+        uint64_t timestamp;
     };
     std::vector<PreviousStats> m_previousStats;
     
+    std::unordered_map<NameId, std::pair<int, int>> m_interfaceSeries; // Interface -> download, upload series
     bool m_initialized;         // Initialization status
-    DWORD m_lastUpdateTime;     // Last update timestamp
+    uint64_t m_sampleTime;      // Timestamp of the latest sample (us)
+    uint64_t m_lastUpdateTime;  // Last update timestamp (us)
 
     /**
      * @brief Collect network interface data
@@ -114,6 +170,11 @@ private:
      * @brief Calculate speeds based on previous data
      */
     void calculateSpeeds();
+
+    /**
+     * @brief Remember the counters of an interface for the next update
+     */
+    void storePrevious(size_t index, uint64_t timestamp);
 };
 
 #endif // NETWORKMONITOR_H
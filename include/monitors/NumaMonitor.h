@@ -0,0 +1,185 @@
+#ifndef NUMAMONITOR_H
+#define NUMAMONITOR_H
+
+#include "core/Collector.h"
+#include "monitors/DataSources.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+class CPUMonitor;
+
+/**
+ * @class NumaMonitor
+ * @brief Aggregates CPU usage and memory by NUMA node and socket from a
+ *        TopologyDataSource (processor topology and NUMA APIs by default)
+ *
+ * Machine-wide totals hide a saturated node on multi-socket machines;
+ * this monitor reports every node and package separately, plus the share
+ * of each node's allocations that had to be served by a remote node
+ * where the platform counts it.
+ */
+class NumaMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    NumaMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit NumaMonitor(std::unique_ptr<TopologyDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~NumaMonitor();
+
+    /**
+     * @brief Initialize the NUMA monitor (reads the topology once)
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Set the CPU monitor whose per-core usage is aggregated
+     * @param cpuMonitor CPU monitor updated before this one (may be
+     *        nullptr: node CPU usage then stays at zero)
+     */
+    void setCpuSource(const CPUMonitor* cpuMonitor);
+
+    /**
+     * @brief Sample node memory and aggregate the latest per-core usage
+     *        of the CPU source
+     */
+    void update() override;
+
+    /**
+     * @brief Get the CPU topology
+     * @return Topology read by initialize()
+     */
+    const CPUTopology& getTopology() const;
+
+    /**
+     * @brief Get number of NUMA nodes
+     * @return Node count (1 on non-NUMA machines)
+     */
+    int getNodeCount() const;
+
+    /**
+     * @brief Get number of sockets
+     * @return Package count
+     */
+    int getPackageCount() const;
+
+    /**
+     * @brief Get number of logical CPUs on a node
+     * @param node Node index
+     * @return Logical CPU count
+     */
+    int getNodeCpuCount(int node) const;
+
+    /**
+     * @brief Get average CPU usage of a node
+     * @param node Node index
+     * @return Usage percentage (0.0 - 100.0)
+     */
+    double getNodeCpuUsage(int node) const;
+
+    /**
+     * @brief Get average CPU usage of a socket
+     * @param package Package index
+     * @return Usage percentage (0.0 - 100.0)
+     */
+    double getPackageCpuUsage(int package) const;
+
+    /**
+     * @brief Get memory attached to a node
+     * @param node Node index
+     * @return Bytes (0 if unknown)
+     */
+    uint64_t getNodeTotalMemory(int node) const;
+
+    /**
+     * @brief Get available memory on a node
+     * @param node Node index
+     * @return Bytes
+     */
+    uint64_t getNodeAvailableMemory(int node) const;
+
+    /**
+     * @brief Get memory usage of a node
+     * @param node Node index
+     * @return Usage percentage (0.0 - 100.0; 0.0 if the node size is unknown)
+     */
+    double getNodeMemoryUsagePercent(int node) const;
+
+    /**
+     * @brief Get the share of a node's allocations served by remote nodes
+     *        since the previous update
+     * @param node Node index
+     * @return Percentage (0.0 - 100.0), or -1.0 if the platform has no
+     *         locality counters
+     */
+    double getNodeRemotePercent(int node) const;
+
+    /**
+     * @brief Get the node with the highest CPU usage
+     * @return Node index
+     */
+    int getBusiestNode() const;
+
+    /**
+     * @brief Get the registry name ("numa")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the per-node and per-socket series
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish node CPU and memory usage and socket CPU usage
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+private:
+    std::unique_ptr<TopologyDataSource> m_source;  // Data source
+    const CPUMonitor* m_cpuSource;                 // Per-core usage (optional)
+
+    CPUTopology m_topology;                     // Static topology
+    std::vector<NodeMemory> m_nodes;            // Latest node memory
+    std::vector<NodeMemory> m_previousNodes;    // Node memory of the previous update
+    std::vector<int> m_nodeCpuCounts;           // Logical CPUs per node
+    std::vector<int> m_packageCpuCounts;        // Logical CPUs per package
+    std::vector<double> m_nodeCpuUsage;         // Average usage per node
+    std::vector<double> m_packageCpuUsage;      // Average usage per package
+    std::vector<double> m_remotePercent;        // Remote allocation share per node (-1 = unknown)
+    std::vector<int> m_nodeCpuSeries;           // "numa.node.<n>.cpu"
+    std::vector<int> m_nodeMemorySeries;        // "numa.node.<n>.memory_percent"
+    std::vector<int> m_packageSeries;           // "numa.socket.<n>.cpu"
+    bool m_initialized;                         // Initialization status
+
+    /**
+     * @brief Average per-core usage into m_nodeCpuUsage and m_packageCpuUsage
+     */
+    void aggregateCpu(const CPUMonitor& cpuMonitor);
+
+    /**
+     * @brief Sample node memory and compute the remote allocation share
+     */
+    void collectData();
+};
+
+#endif // NUMAMONITOR_H
@@ -0,0 +1,176 @@
+#ifndef PERFMONITOR_H
+#define PERFMONITOR_H
+
+#include "core/Collector.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+class PerfDataSource;
+
+/**
+ * @struct PerfCounters
+ * @brief Cumulative scheduler, memory and hardware event counts per CPU
+ *
+ * Structure-of-arrays layout like CPUTimes: values[event][cpu]. Events
+ * the source cannot count (no PMU access, inside a VM) are flagged
+ * unavailable; events only counted system-wide keep their count in
+ * values[event][0].
+ */
+struct PerfCounters {
+    enum Event {
+        ContextSwitches,
+        Migrations,
+        PageFaults,
+        Cycles,
+        Instructions,
+        CacheMisses,
+        EventCount
+    };
+
+    std::vector<uint64_t> values[EventCount];   // Counters per event, indexed by CPU
+    bool available[EventCount];                 // Event is counted
+    bool perCpu[EventCount];                    // Event is counted per CPU (else system-wide in values[e][0])
+
+    PerfCounters();
+
+    /**
+     * @brief Resize every event (new counters start at zero)
+     * @param cpuCount Number of CPUs
+     */
+    void resize(int cpuCount);
+
+    /**
+     * @brief Get number of CPUs
+     * @return Length of every event array
+     */
+    int cpuCount() const;
+
+    /**
+     * @brief Get the name of an event ("context_switches", "ipc" is derived)
+     * @param event Event
+     * @return Event name, or "" for an invalid event
+     */
+    static const char* eventName(Event event);
+};
+
+/**
+ * @class PerfMonitor
+ * @brief Optional scheduler and hardware event rates from a PerfDataSource
+ *        (processor performance counters by default)
+ *
+ * Context switches, migrations and page faults per second and, where the
+ * hardware counters are reachable, cycles, instructions and the derived
+ * IPC. High CPU usage with a low IPC points at stalls rather than useful
+ * work; high usage with many switches points at scheduling overhead.
+ */
+class PerfMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    PerfMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit PerfMonitor(std::unique_ptr<PerfDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~PerfMonitor();
+
+    /**
+     * @brief Initialize the perf monitor
+     * @return true if at least one event is available
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update event rates (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Check if an event is counted
+     * @param event Event
+     * @return true if the source counts it
+     */
+    bool isAvailable(PerfCounters::Event event) const;
+
+    /**
+     * @brief Get the rate of an event over all CPUs
+     * @param event Event
+     * @return Events per second (0.0 if unavailable)
+     */
+    double getRate(PerfCounters::Event event) const;
+
+    /**
+     * @brief Get the rate of an event on one CPU
+     * @param event Event
+     * @param cpu CPU index
+     * @return Events per second (0.0 if unavailable or not counted per CPU)
+     */
+    double getCpuRate(PerfCounters::Event event, int cpu) const;
+
+    /**
+     * @brief Get instructions per cycle over all CPUs
+     * @return IPC, or -1.0 if instructions or cycles are unavailable
+     */
+    double getIpc() const;
+
+    /**
+     * @brief Get instructions per cycle of one CPU
+     * @param cpu CPU index
+     * @return IPC, or -1.0 if unavailable
+     */
+    double getCpuIpc(int cpu) const;
+
+    /**
+     * @brief Get number of CPUs
+     * @return CPU count
+     */
+    int getCpuCount() const;
+
+    /**
+     * @brief Get the registry name ("perf")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register a "perf.*" series for each counted event
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the event rates and IPC
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+private:
+    std::unique_ptr<PerfDataSource> m_source;   // Data source
+
+    PerfCounters m_previous;                    // Counters of the previous sample
+    PerfCounters m_current;                     // Counters of the current sample
+    std::vector<double> m_rates[PerfCounters::EventCount]; // Rates per event, indexed by CPU
+    double m_totalRates[PerfCounters::EventCount];         // Rates per event over all CPUs
+    uint64_t m_previousTime;                    // Timestamp of m_previous (us)
+    bool m_initialized;                         // Initialization status
+
+    /**
+     * @brief Sample the counters and recompute the rates
+     */
+    void collectData();
+};
+
+#endif // PERFMONITOR_H
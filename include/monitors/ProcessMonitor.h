@@ -0,0 +1,330 @@
+#ifndef PROCESSMONITOR_H
+#define PROCESSMONITOR_H
+
+#include "core/Collector.h"
+#include "core/NameTable.h"
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class ProcessDataSource;
+
+/**
+ * @struct ProcessCounters
+ * @brief Cheap per-tick figures of one process: cumulative I/O counters
+ *        and the current resident set
+ */
+struct ProcessCounters {
+    uint32_t pid;                   // Process ID
+    uint64_t readBytes;             // Bytes read
+    uint64_t writeBytes;            // Bytes written
+    uint64_t readOps;               // Read calls
+    uint64_t writeOps;              // Write calls
+    uint64_t residentBytes;         // Resident set (shared pages counted in full)
+    uint64_t cpuMicros;             // User + kernel CPU time
+};
+
+/**
+ * @struct ProcessExit
+ * @brief Final totals of a process that exited
+ */
+struct ProcessExit {
+    uint32_t pid;                   // Process ID
+    uint32_t parentPid;             // Parent process ID (0 if unknown)
+    NameId name;                    // Executable name (NameTable, EMPTY if unknown)
+    uint64_t lifetimeMs;            // Exit time - start time
+    uint64_t cpuMicros;             // Lifetime user + kernel CPU time
+    uint64_t readBytes;             // Lifetime bytes read
+    uint64_t writeBytes;            // Lifetime bytes written
+};
+
+/**
+ * @struct ProcessMemory
+ * @brief Expensive memory breakdown of one process (page walk)
+ */
+struct ProcessMemory {
+    uint64_t resident;              // Resident set
+    uint64_t proportional;          // Resident, shared pages divided among their sharers
+    uint64_t unique;                // Resident pages mapped by this process only
+    uint64_t swapped;               // Private memory not resident (swap / pagefile)
+};
+
+/**
+ * @struct ProcessMemoryInfo
+ * @brief A displayed process with its memory breakdown
+ */
+struct ProcessMemoryInfo {
+    uint32_t pid;                   // Process ID
+    NameId name;                    // Executable name (NameTable, EMPTY if unknown)
+    ProcessMemory memory;           // Last breakdown (resident only if !detailed)
+    bool detailed;                  // memory comes from a page walk
+    uint64_t ageMs;                 // Time since the page walk
+};
+
+/**
+ * @struct ProcessIoInfo
+ * @brief A displayed process with its I/O rates
+ */
+struct ProcessIoInfo {
+    uint32_t pid;                   // Process ID
+    NameId name;                    // Executable name (NameTable, EMPTY if unknown)
+    double readRate;                // Bytes/sec read
+    double writeRate;               // Bytes/sec written
+    double readOpsRate;             // Read calls/sec
+    double writeOpsRate;            // Write calls/sec
+};
+
+/**
+ * @class ProcessMonitor
+ * @brief Per-process I/O rates, memory breakdowns and the top readers,
+ *        writers and memory users from a ProcessDataSource (cached process
+ *        handles by default)
+ *
+ * The source returns one row per tracked process, sorted by PID; each
+ * update merges it with the previous sample so every process costs one
+ * counter read and one comparison. A process that is new since the
+ * previous sample counts all of its I/O, so a short burst from a freshly
+ * started process still shows up. Names are only looked up for the
+ * processes that make the top lists.
+ *
+ * Proportional and unique memory need a walk over every resident page, so
+ * they are refreshed on an adaptive schedule within a time budget per
+ * update: new processes first, then processes whose resident set moved by
+ * more than MEMORY_CHANGE_PERCENT since their last walk, then overdue
+ * ones, heaviest first. A process that stays stable doubles its interval
+ * up to MAX_MEMORY_INTERVAL_MS (HEAVY_MEMORY_INTERVAL_MS for processes
+ * above HEAVY_MEMORY_BYTES).
+ *
+ * Processes that exit are reported by the source with their final
+ * totals; the part of those totals not yet seen by a sample (all of it for
+ * a process that lived less than one update) is added to the I/O rates
+ * and to the CPU of exited processes. With an event-driven source the
+ * process table follows start/exit notifications, so short-lived
+ * processes are caught and full rescans are rare; otherwise processes
+ * that start and exit between two updates are missed.
+ */
+class ProcessMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    ProcessMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit ProcessMonitor(std::unique_ptr<ProcessDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~ProcessMonitor();
+
+    /**
+     * @brief Initialize the process monitor
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update I/O rates and the top lists (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Set the number of processes kept in each top list
+     * @param count Process count
+     */
+    void setTopCount(int count);
+
+    /**
+     * @brief Get number of tracked processes
+     * @return Process count
+     */
+    size_t getProcessCount() const;
+
+    /**
+     * @brief Get the processes reading the most bytes
+     * @return Processes, busiest first (idle processes omitted)
+     */
+    const std::vector<ProcessIoInfo>& getTopReaders() const;
+
+    /**
+     * @brief Get the processes writing the most bytes
+     * @return Processes, busiest first (idle processes omitted)
+     */
+    const std::vector<ProcessIoInfo>& getTopWriters() const;
+
+    /**
+     * @brief Get the read rate over all processes
+     * @return Bytes/sec
+     */
+    double getTotalReadRate() const;
+
+    /**
+     * @brief Get the write rate over all processes
+     * @return Bytes/sec
+     */
+    double getTotalWriteRate() const;
+
+    /**
+     * @brief Check if the source follows start/exit notifications
+     * @return true if short-lived processes are caught, false if polling
+     */
+    bool isEventDriven() const;
+
+    /**
+     * @brief Get the rate of process exits
+     * @return Exits/sec over the latest update
+     */
+    double getExitRate() const;
+
+    /**
+     * @brief Get the CPU used by processes that exited during the latest update
+     * @return CPU seconds per second (1.0 = one busy core)
+     */
+    double getExitedCpuRate() const;
+
+    /**
+     * @brief Get the most recent exits
+     * @return Exits, newest first (at most RECENT_EXIT_COUNT)
+     */
+    const std::deque<ProcessExit>& getRecentExits() const;
+
+    /**
+     * @brief Set the time spent on page walks per update
+     * @param budgetMicros Budget in microseconds (at least one walk is done;
+     *        0 disables page walks)
+     */
+    void setMemoryBudget(uint64_t budgetMicros);
+
+    /**
+     * @brief Get the processes using the most memory
+     * @return Processes by proportional memory (resident until walked)
+     */
+    const std::vector<ProcessMemoryInfo>& getTopMemory() const;
+
+    /**
+     * @brief Get number of page walks done by the latest update
+     * @return Walk count
+     */
+    int getMemoryRefreshCount() const;
+
+    /**
+     * @brief Get number of processes still due for a walk after the latest update
+     * @return Process count
+     */
+    int getMemoryBacklog() const;
+
+    /**
+     * @brief Get the registry name ("processes")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the "process.*" totals
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish I/O rates and process exits
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+    static constexpr int DEFAULT_TOP_COUNT = 5;
+    static constexpr size_t RECENT_EXIT_COUNT = 20;
+    static constexpr uint64_t DEFAULT_MEMORY_BUDGET_US = 5000;
+    static constexpr uint64_t MIN_MEMORY_INTERVAL_MS = 2000;
+    static constexpr uint64_t HEAVY_MEMORY_INTERVAL_MS = 10000;
+    static constexpr uint64_t MAX_MEMORY_INTERVAL_MS = 120000;
+    static constexpr uint64_t HEAVY_MEMORY_BYTES = 1ULL << 30;
+    static constexpr int MEMORY_CHANGE_PERCENT = 5;
+
+private:
+    // Adaptive page walk schedule of one process
+    struct MemoryState {
+        uint32_t pid;
+        ProcessMemory memory;       // Last breakdown
+        uint64_t refreshedMs;       // Time of the last walk (0 = never tried)
+        uint64_t intervalMs;        // Walk again after this long
+        uint64_t walkedResident;    // Resident set at the last walk
+        bool detailed;              // The last walk succeeded
+    };
+
+    std::unique_ptr<ProcessDataSource> m_source;    // Data source
+
+    std::vector<ProcessCounters> m_previous;    // Sample of the previous update, by PID
+    std::vector<ProcessCounters> m_current;     // Sample of the current update, by PID
+    std::vector<ProcessIoInfo> m_rates;         // Per row of m_current, then exited processes
+    std::vector<uint32_t> m_ranking;            // Rows of m_current being ranked
+    std::vector<ProcessIoInfo> m_topReaders;    // Busiest readers
+    std::vector<ProcessIoInfo> m_topWriters;    // Busiest writers
+    std::vector<MemoryState> m_memory;          // Per row of m_previous
+    std::vector<MemoryState> m_nextMemory;      // Rebuilt by each update
+    std::vector<std::pair<uint64_t, uint32_t>> m_due;   // (priority, row) of due walks
+    std::vector<ProcessMemoryInfo> m_topMemory; // Largest processes
+    std::vector<ProcessExit> m_exits;           // Exits attributed to the latest sample
+    std::vector<ProcessExit> m_drained;         // Exits taken from the source
+    std::vector<ProcessExit> m_deferredExits;   // Still live in m_current: next sample
+    std::deque<ProcessExit> m_recentExits;      // Newest first
+    double m_exitRate;                          // Exits/sec
+    double m_exitedCpuRate;                     // CPU sec/sec of exited processes
+    double m_totalReadRate;                     // Over all processes
+    double m_totalWriteRate;                    // Over all processes
+    uint64_t m_previousTime;                    // Timestamp of m_previous (us)
+    uint64_t m_memoryBudget;                    // Page walk budget per update (us)
+    int m_memoryRefreshes;                      // Walks done by the latest update
+    int m_memoryBacklog;                        // Walks left due
+    int m_topCount;                             // Processes kept per list
+    bool m_eventDriven;                         // Source follows start/exit notifications
+    bool m_initialized;                         // Initialization status
+
+    /**
+     * @brief Sample the processes and recompute rates and top lists
+     */
+    void collectData();
+
+    /**
+     * @brief Add the unseen part of the exited processes' totals to the rates
+     *
+     * An exit drained after the sample that still lists the process is
+     * deferred to the next sample, so the process is never counted live
+     * and exited in the same interval.
+     *
+     * @param elapsedSec Interval of the current sample
+     */
+    void attributeExits(double elapsedSec);
+
+    /**
+     * @brief Carry the walk schedule over to the current sample and walk
+     *        the most urgent processes within the budget
+     * @param nowMs Timestamp of the current sample
+     */
+    void refreshMemory(uint64_t nowMs);
+
+    /**
+     * @brief Rank the current sample by memory into m_topMemory
+     * @param nowMs Timestamp of the current sample
+     */
+    void rankMemory(uint64_t nowMs);
+
+    /**
+     * @brief Fill a top list with the busiest rows by one rate
+     * @param rate Rate member to rank by
+     * @param top Output list
+     */
+    void rank(double ProcessIoInfo::*rate, std::vector<ProcessIoInfo>& top);
+};
+
+#endif // PROCESSMONITOR_H
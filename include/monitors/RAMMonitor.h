@@ -1,12 +1,15 @@
 #ifndef RAMMONITOR_H
 #define RAMMONITOR_H
 
-#include <windows.h>
+#include "core/Collector.h"
+#include "monitors/DataSources.h"
+#include <memory>
 #include <cstdint>
 
 /**
  * @class RAMMonitor
- * @brief Monitors system memory usage using Windows API
+ * @brief Monitors system memory usage from a MemoryDataSource
+ *        (GlobalMemoryStatusEx by default)
  * 
  * This class provides real-time memory information including:
  * - Total physical memory
@@ -14,12 +17,18 @@
  * - Memory usage percentage
  * - Virtual memory statistics
  */
-class RAMMonitor {
+class RAMMonitor : public Collector {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor - Uses the platform's default data source
      */
     RAMMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit RAMMonitor(std::unique_ptr<MemoryDataSource> source);
     
     /**
      * @brief Destructor
@@ -30,12 +39,12 @@ public:
      * @brief Initialize the RAM monitor
      * @return true if initialization successful, false otherwise
      */
-    bool initialize();
+    bool initialize() override;
 
     /**
      * @brief Update memory usage values
      */
-    void update();
+    void update() override;
 
     /**
      * @brief Get total physical RAM in bytes
@@ -79,18 +88,36 @@ public:
      */
     uint64_t getUsedVirtualMemory() const;
 
+    /**
+     * @brief Get the registry name ("ram")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register "ram.usage_percent"
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish the latest memory usage
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
     /**
      * @brief Check if monitor is initialized
      * @return true if initialized, false otherwise
      */
-    bool isInitialized() const;
+    bool isInitialized() const override;
 
 private:
-    MEMORYSTATUSEX m_memInfo;  // Windows memory status structure
+    std::unique_ptr<MemoryDataSource> m_source;  // Data source
+    MemoryStatus m_memInfo;     // Latest memory status
     bool m_initialized;         // Initialization status
 
     /**
-     * @brief Collect memory data from Windows API
+     * @brief Collect memory data from the data source
      */
     void collectData();
 };
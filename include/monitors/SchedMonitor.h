@@ -0,0 +1,179 @@
+#ifndef SCHEDMONITOR_H
+#define SCHEDMONITOR_H
+
+#include "core/Collector.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class SchedDataSource;
+
+/**
+ * @struct SchedCounters
+ * @brief Cumulative run-queue wait time and timeslice counts per CPU
+ *
+ * Structure-of-arrays layout like CPUTimes. Sources that only know the
+ * wait time system-wide (waitPerCpu false) keep it in waitNs[0].
+ */
+struct SchedCounters {
+    std::vector<uint64_t> waitNs;       // Time runnable tasks spent waiting for the CPU
+    std::vector<uint64_t> timeslices;   // Timeslices run (tasks switched in)
+    bool waitPerCpu;                    // waitNs is per CPU (else system-wide in waitNs[0])
+
+    SchedCounters();
+
+    /**
+     * @brief Resize every column (new counters start at zero)
+     * @param cpuCount Number of CPUs
+     */
+    void resize(int cpuCount);
+
+    /**
+     * @brief Get number of CPUs
+     * @return Length of every column
+     */
+    int cpuCount() const;
+};
+
+/**
+ * @class SchedMonitor
+ * @brief Run-queue wait time and timeslice rates from a SchedDataSource
+ *        (processor queue length and context switches by default)
+ *
+ * High CPU usage with low throughput often means run-queue contention:
+ * the wait percentage is the time tasks spent runnable but not running,
+ * relative to the interval, so 100% on a CPU means one task was waiting
+ * for the whole interval on average.
+ */
+class SchedMonitor : public Collector {
+public:
+    /**
+     * @brief Constructor - Uses the platform's default data source
+     */
+    SchedMonitor();
+
+    /**
+     * @brief Constructor with an injected data source
+     * @param source Data source (e.g. fixtures for tests and benchmarks)
+     */
+    explicit SchedMonitor(std::unique_ptr<SchedDataSource> source);
+
+    /**
+     * @brief Destructor
+     */
+    ~SchedMonitor();
+
+    /**
+     * @brief Initialize the scheduler monitor
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Update wait and timeslice rates (should be called periodically)
+     */
+    void update() override;
+
+    /**
+     * @brief Get number of CPUs
+     * @return CPU count
+     */
+    int getCpuCount() const;
+
+    /**
+     * @brief Check if the wait time is known per CPU
+     * @return false if only the system-wide wait is available
+     */
+    bool hasPerCpuWait() const;
+
+    /**
+     * @brief Get the run-queue wait of one CPU
+     * @param cpu CPU index
+     * @return Waiting time as a percentage of the interval (0.0 if the
+     *         index is invalid or the wait is not known per CPU)
+     */
+    double getCpuWaitPercent(int cpu) const;
+
+    /**
+     * @brief Get the run-queue wait averaged over all CPUs
+     * @return Waiting time as a percentage of the interval per CPU
+     */
+    double getWaitPercent() const;
+
+    /**
+     * @brief Get the timeslice rate of one CPU
+     * @param cpu CPU index
+     * @return Timeslices per second
+     */
+    double getCpuTimesliceRate(int cpu) const;
+
+    /**
+     * @brief Get the timeslice rate over all CPUs
+     * @return Timeslices per second
+     */
+    double getTimesliceRate() const;
+
+    /**
+     * @brief Get the mean wait before a timeslice
+     * @return Microseconds of waiting per timeslice (0.0 without timeslices)
+     */
+    double getWaitPerTimesliceMicros() const;
+
+    /**
+     * @brief Get the registry name ("sched")
+     */
+    const char* name() const override;
+
+    /**
+     * @brief Register the "sched.*" series
+     * @param metrics Metric table
+     */
+    void registerSeries(MetricTable& metrics) override;
+
+    /**
+     * @brief Publish run-queue wait and timeslice rates
+     * @param metrics Metric table
+     */
+    void publish(MetricTable& metrics) override;
+
+    /**
+     * @brief Check if monitor is initialized
+     * @return true if initialized, false otherwise
+     */
+    bool isInitialized() const override;
+
+    /**
+     * @brief Parse a /proc/schedstat snapshot in one pass
+     *
+     * Reads the "cpu<N>" lines; their 8th and 9th fields are the wait time
+     * in nanoseconds and the timeslice count (the running time before
+     * them is covered by CPUMonitor). Domain and version lines are skipped.
+     *
+     * @param text Snapshot text
+     * @param counters Output counters; resized to the highest CPU + 1 if
+     *        they have no CPUs yet, extra CPUs are ignored otherwise
+     * @return false if the snapshot has no CPU lines
+     */
+    static bool parseSchedstat(const std::string& text, SchedCounters& counters);
+
+private:
+    std::unique_ptr<SchedDataSource> m_source;  // Data source
+
+    SchedCounters m_previous;               // Counters of the previous sample
+    SchedCounters m_current;                // Counters of the current sample
+    std::vector<double> m_waitPercents;     // Wait percentage per CPU
+    std::vector<double> m_timesliceRates;   // Timeslices per second per CPU
+    double m_waitPercent;                   // Wait percentage averaged over all CPUs
+    double m_timesliceRate;                 // Timeslices per second over all CPUs
+    double m_waitPerTimeslice;              // Mean wait per timeslice (us)
+    uint64_t m_previousTime;                // Timestamp of m_previous (us)
+    bool m_initialized;                     // Initialization status
+
+    /**
+     * @brief Sample the counters and recompute the rates
+     */
+    void collectData();
+};
+
+#endif // SCHEDMONITOR_H
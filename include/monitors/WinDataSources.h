@@ -0,0 +1,435 @@
+#ifndef WINDATASOURCES_H
+#define WINDATASOURCES_H
+
+#include "monitors/DataSources.h"
+#include <windows.h>
+#include <evntrace.h>
+#include <evntcons.h>
+#include <pdh.h>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class ProcessorGroupQuery
+ * @brief Per-processor records from NtQuerySystemInformation, one call per
+ *        processor group (NtQuerySystemInformationEx where available, so
+ *        machines with more than 64 CPUs are covered)
+ */
+class ProcessorGroupQuery {
+public:
+    ProcessorGroupQuery();
+
+    /**
+     * @brief Resolve the ntdll entry points and the processor groups
+     * @return true if NtQuerySystemInformation is available
+     */
+    bool open();
+
+    /**
+     * @brief Get number of logical processors over all groups
+     * @return Processor count
+     */
+    int processorCount() const;
+
+    /**
+     * @brief Query one processor group
+     * @param infoClass SYSTEM_INFORMATION_CLASS with one record per processor
+     * @param group Group index (0 - groupCount() - 1)
+     * @param recordSize Size of one record
+     * @param buffer Output buffer (grown to hold a full group)
+     * @param recordCount Output number of records returned
+     * @return true on success
+     */
+    bool query(ULONG infoClass, size_t group, size_t recordSize,
+               std::vector<unsigned char>& buffer, size_t& recordCount) const;
+
+    /**
+     * @brief Get number of processor groups
+     * @return Group count
+     */
+    size_t groupCount() const;
+
+private:
+    FARPROC m_query;                            // NtQuerySystemInformation
+    FARPROC m_queryEx;                          // NtQuerySystemInformationEx (nullptr before Windows 7)
+    std::vector<WORD> m_groupSizes;             // Active processors per processor group
+};
+
+/**
+ * @class WinCPUDataSource
+ * @brief Raw per-core times from SystemProcessorPerformanceInformation
+ *
+ * Fills User, System (kernel minus idle, DPC and interrupt time), Idle,
+ * Irq (interrupt time) and SoftIrq (DPC time); Windows has no nice,
+ * iowait, steal or guest accounting, so those columns stay zero.
+ */
+class WinCPUDataSource : public CPUDataSource {
+public:
+    bool open(int& coreCount) override;
+    bool sample(CPUTimes& times) override;
+
+private:
+    ProcessorGroupQuery m_processors;           // Per-group queries
+    std::vector<unsigned char> m_buffer;        // Per-processor records of one group
+};
+
+/**
+ * @class WinThermalDataSource
+ * @brief Per-core clocks from CallNtPowerInformation(ProcessorInformation)
+ *        and thermal zone temperatures from the "Thermal Zone Information"
+ *        PDH counters
+ *
+ * The PDH query and the power information buffer are set up once in
+ * open(); a sample is one power call plus one PDH collection for all
+ * cores and zones. Windows reports a frequency cap (MhzLimit) rather
+ * than throttle event counters, so throttleCount stays zero.
+ */
+class WinThermalDataSource : public ThermalDataSource {
+public:
+    WinThermalDataSource();
+    ~WinThermalDataSource() override;
+
+    bool open(int coreCount) override;
+    bool sample(CPUThermals& thermals) override;
+
+private:
+    std::vector<unsigned char> m_powerBuffer;   // PROCESSOR_POWER_INFORMATION per processor
+    PDH_HQUERY m_query;                         // Thermal zone query
+    PDH_HCOUNTER m_temperatureCounter;          // "Temperature" of all zones (wildcard)
+    std::vector<unsigned char> m_counterBuffer; // PdhGetFormattedCounterArray output
+};
+
+/**
+ * @class WinInterruptDataSource
+ * @brief Per-CPU interrupt counts (SystemProcessorPerformanceInformation)
+ *        and DPC counts (SystemInterruptInformation)
+ *
+ * Windows does not attribute interrupts to lines or devices without ETW
+ * tracing, so the matrix has two rows: "Interrupts" (hardware) and
+ * "DPC" (deferred, the softirq analog).
+ */
+class WinInterruptDataSource : public InterruptDataSource {
+public:
+    bool open(int& cpuCount) override;
+    bool sample(InterruptCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    ProcessorGroupQuery m_processors;           // Per-group queries
+    std::vector<unsigned char> m_buffer;        // Per-processor records of one group
+    std::vector<uint64_t> m_counts;             // 64-bit interrupt then DPC counts per CPU
+    std::vector<ULONG> m_lastCounts;            // Last raw 32-bit counts, same layout
+
+    /**
+     * @brief Extend a 32-bit OS counter to 64 bits so it never wraps
+     * @param index Index into m_counts
+     * @param raw Current 32-bit value
+     * @return Widened value
+     */
+    uint64_t widen(size_t index, ULONG raw);
+};
+
+/**
+ * @class WinMemoryDataSource
+ * @brief Memory status from GlobalMemoryStatusEx
+ */
+class WinMemoryDataSource : public MemoryDataSource {
+public:
+    bool sample(MemoryStatus& status) override;
+};
+
+/**
+ * @class WinDiskDataSource
+ * @brief Volumes from GetLogicalDrives, space from GetDiskFreeSpaceEx and
+ *        speeds from LogicalDisk PDH counters
+ */
+class WinDiskDataSource : public DiskDataSource {
+public:
+    WinDiskDataSource();
+    ~WinDiskDataSource() override;
+
+    bool enumerate(std::vector<DiskInfo>& disks) override;
+    void describe(DiskInfo& disk) override;
+    void sampleSpace(std::vector<DiskInfo>& disks) override;
+    void sampleSpeeds(std::vector<DiskInfo>& disks) override;
+
+private:
+    PDH_HQUERY m_query;                 // PDH query handle
+
+    struct SpeedCounters {
+        PDH_HCOUNTER readCounter;
+        PDH_HCOUNTER writeCounter;
+        std::wstring diskName;
+    };
+    std::vector<SpeedCounters> m_speedCounters; // Speed counters for each disk
+
+    /**
+     * @brief Setup PDH counters for disk I/O monitoring
+     */
+    bool setupSpeedCounters(const std::vector<DiskInfo>& disks);
+};
+
+/**
+ * @class WinNetworkDataSource
+ * @brief Interface counters from the IP Helper interface table
+ */
+class WinNetworkDataSource : public NetworkDataSource {
+public:
+    bool sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) override;
+};
+
+/**
+ * @class WinConnectionDataSource
+ * @brief IPv4 TCP connections with their owning process from one
+ *        GetExtendedTcpTable call, and per-connection bytes from
+ *        GetPerTcpConnectionEStats
+ *
+ * Byte counters need extended statistics to be enabled per connection
+ * (SetPerTcpConnectionEStats, administrator only); connections without
+ * them are listed with zero bytes. The first denied enable stops all
+ * per-connection calls for the life of the source. Otherwise the
+ * counters are read every ESTATS_INTERVAL_US rather than every tick; in
+ * between, a dump repeats the previous timestamp and only refreshes the
+ * connection list. Process names are cached by PID.
+ */
+class WinConnectionDataSource : public ConnectionDataSource {
+public:
+    WinConnectionDataSource();
+
+    bool sample(ConnectionTable& table, uint64_t& timestampUs) override;
+    NameId processName(uint32_t pid) override;
+
+private:
+    std::vector<unsigned char> m_buffer;    // MIB_TCPTABLE_OWNER_PID
+    std::vector<std::pair<uint32_t, NameId>> m_names;  // PID -> executable name
+    uint64_t m_namesTime;                   // When m_names was last flushed (ms)
+    uint64_t m_estatsTime;                  // Last byte counter read (us, 0 = never)
+    bool m_estatsDenied;                    // Enabling counters failed: never retried
+};
+
+/**
+ * @class WinProcessDataSource
+ * @brief Per-process I/O counters, working sets and CPU times of all
+ *        processes from one NtQuerySystemInformation(SystemProcessInformation)
+ *        call, memory breakdowns from QueryWorkingSet, start/exit
+ *        notifications from the Microsoft-Windows-Kernel-Process ETW provider
+ *
+ * The snapshot replaces three calls per process (GetProcessIoCounters,
+ * GetProcessMemoryInfo and GetProcessTimes on the cached handles), which
+ * remain as the fallback when the snapshot is unavailable or disabled; it
+ * also covers protected processes that cannot be opened.
+ *
+ * With openEvents() the process table follows the start and stop events
+ * of a real-time trace session (administrators and Performance Log Users
+ * only): a process is opened as soon as its start event arrives, and the
+ * held handle still reads its final CPU time and I/O totals after it
+ * exits, so drainExits() reports processes that lived for milliseconds.
+ * EnumProcesses then only runs every RECONCILE_INTERVAL_MS to repair lost
+ * events. Without the session every sample rescans with EnumProcesses and
+ * exits are only noticed for processes seen by an earlier sample.
+ *
+ * A process is opened once and its handle (which also pins the PID
+ * against reuse) is closed when it exits. Processes that cannot be opened
+ * (protected or another user's without privileges) are remembered and
+ * skipped by the fallback. The counters include all I/O of the process (files, network
+ * and devices), not only disk I/O.
+ *
+ * readMemory() lists every working set page with its share count (which
+ * Windows saturates at 7, so proportional memory of widely shared pages
+ * is overestimated) and reports private commit outside the working set
+ * as swapped.
+ */
+class WinProcessDataSource : public ProcessDataSource {
+public:
+    /**
+     * @brief Constructor
+     * @param batched Read all processes with one snapshot call (false: read
+     *        each process handle, e.g. to compare the two in benchmarks)
+     */
+    explicit WinProcessDataSource(bool batched = true);
+    ~WinProcessDataSource() override;
+
+    bool sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) override;
+    bool readMemory(uint32_t pid, ProcessMemory& memory) override;
+    bool openEvents() override;
+    void drainExits(std::vector<ProcessExit>& exits) override;
+    NameId processName(uint32_t pid) override;
+
+    static constexpr uint64_t RECONCILE_INTERVAL_MS = 30000;
+
+private:
+    // A live process
+    struct Tracked {
+        uint32_t pid;
+        uint32_t parentPid;             // 0 if it started before the session
+        HANDLE handle;                  // nullptr if it could not be opened
+        NameId name;                    // Resolved on first request
+        bool named;                     // name is valid
+    };
+
+    // A start or stop notification, queued by the trace thread
+    struct Event {
+        uint32_t pid;
+        uint32_t parentPid;             // Start only
+        HANDLE handle;                  // Start only, opened by the trace thread
+        bool start;
+    };
+
+    FARPROC m_querySystemInformation;   // NtQuerySystemInformation (nullptr: per-handle reads)
+    std::vector<unsigned char> m_snapshot;  // SYSTEM_PROCESS_INFORMATION records
+    std::vector<DWORD> m_pids;          // Sorted PIDs of the latest rescan
+    std::vector<Tracked> m_tracked;     // By PID
+    std::vector<Tracked> m_next;        // Rebuilt by each rescan
+    std::vector<ProcessExit> m_exits;   // Not yet drained
+    std::vector<ULONG_PTR> m_workingSet;    // PSAPI_WORKING_SET_INFORMATION
+    uint64_t m_pageSize;                // Bytes per working set entry
+    std::vector<unsigned char> m_traceProperties;   // EVENT_TRACE_PROPERTIES + session name
+    TRACEHANDLE m_session;              // Trace session (0 when polling)
+    TRACEHANDLE m_trace;                // Consumer of the session
+    std::thread m_traceThread;          // Runs ProcessTrace
+    std::mutex m_eventMutex;            // Guards m_events
+    std::vector<Event> m_events;        // Filled by the trace thread
+    std::vector<Event> m_applying;      // Swapped with m_events by each sample
+    uint64_t m_reconciledUs;            // Time of the last rescan (us, 0 = never)
+
+    /**
+     * @brief Read the counters of all processes with one call
+     * @param processes Output counters, sorted by PID
+     * @return false if the call failed (per-handle reads from then on)
+     */
+    bool snapshot(std::vector<ProcessCounters>& processes);
+
+    /**
+     * @brief List all PIDs with EnumProcesses into m_pids, sorted
+     * @param count Output PID count
+     * @return true if the process list could be read
+     */
+    bool enumerate(size_t& count);
+
+    /**
+     * @brief Merge the first count PIDs of m_pids into the process table,
+     *        opening new processes and finishing gone ones
+     */
+    void rescan(size_t count);
+
+    /**
+     * @brief Apply the queued start and stop events to the process table
+     */
+    void applyEvents();
+
+    /**
+     * @brief Record the final totals of an exited process and close its handle
+     */
+    void finish(Tracked& process);
+
+    /**
+     * @brief Stop the trace session and its thread
+     */
+    void stopEvents();
+
+    /**
+     * @brief ETW callback (trace thread)
+     */
+    static void WINAPI onEvent(PEVENT_RECORD record);
+};
+
+/**
+ * @class WinNetStackDataSource
+ * @brief TCP, UDP and IP counters from GetTcpStatisticsEx,
+ *        GetUdpStatisticsEx and GetIpStatisticsEx (IPv4 + IPv6)
+ *
+ * Windows has no listen queue overflow, listen drop, SYN cookie or UDP
+ * buffer error counters; those are reported unavailable.
+ */
+class WinNetStackDataSource : public NetStackDataSource {
+public:
+    WinNetStackDataSource();
+
+    bool open(NetStackCounters& counters) override;
+    bool sample(NetStackCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    uint64_t m_values[NetStackCounters::CounterCount];  // 64-bit counts
+    ULONG m_last[NetStackCounters::CounterCount];       // Last raw 32-bit sums
+};
+
+/**
+ * @class WinPerfDataSource
+ * @brief Per-CPU context switches (SystemInterruptInformation) and cycles
+ *        (SystemProcessorCycleTimeInformation), system-wide page faults
+ *        (raw "Memory\Page Faults/sec" PDH counter)
+ *
+ * Each sample is one query per processor group and counter class for all
+ * CPUs. Windows offers no migration counter, and instructions and cache
+ * misses need a PMU driver or ETW profiling, so those events are
+ * reported unavailable.
+ */
+class WinPerfDataSource : public PerfDataSource {
+public:
+    WinPerfDataSource();
+    ~WinPerfDataSource() override;
+
+    bool open(PerfCounters& counters) override;
+    bool sample(PerfCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    ProcessorGroupQuery m_processors;           // Per-group queries
+    std::vector<unsigned char> m_buffer;        // Per-processor records of one group
+    std::vector<uint64_t> m_switches;           // 64-bit context switch counts per CPU
+    std::vector<ULONG> m_lastSwitches;          // Last raw 32-bit counts
+    PDH_HQUERY m_query;                         // Page fault query
+    PDH_HCOUNTER m_pageFaultCounter;            // Raw cumulative page fault count
+};
+
+/**
+ * @class WinSchedDataSource
+ * @brief Per-CPU timeslices (context switches from SystemInterruptInformation)
+ *        and a system-wide wait time integrated from "System\Processor
+ *        Queue Length"
+ *
+ * Windows keeps no run-queue delay accounting; the number of ready
+ * threads waiting for a processor, multiplied by the time since the
+ * previous sample, estimates the time they spent waiting.
+ */
+class WinSchedDataSource : public SchedDataSource {
+public:
+    WinSchedDataSource();
+    ~WinSchedDataSource() override;
+
+    bool open(SchedCounters& counters) override;
+    bool sample(SchedCounters& counters, uint64_t& timestampUs) override;
+
+private:
+    ProcessorGroupQuery m_processors;           // Per-group queries
+    std::vector<unsigned char> m_buffer;        // Per-processor records of one group
+    std::vector<uint64_t> m_switches;           // 64-bit context switch counts per CPU
+    std::vector<ULONG> m_lastSwitches;          // Last raw 32-bit counts
+    PDH_HQUERY m_query;                         // Queue length query
+    PDH_HCOUNTER m_queueCounter;                // Ready threads waiting for a processor
+    uint64_t m_waitNs;                          // Integrated wait time
+    uint64_t m_lastTimestamp;                   // Time of the previous sample (us)
+};
+
+/**
+ * @class WinTopologyDataSource
+ * @brief Topology from GetLogicalProcessorInformationEx, available node
+ *        memory from GetNumaAvailableMemoryNodeEx and node size from the
+ *        "NUMA Node Memory" PDH counters
+ *
+ * Windows has no per-node allocation locality counters, so localPages
+ * and remotePages stay zero.
+ */
+class WinTopologyDataSource : public TopologyDataSource {
+public:
+    WinTopologyDataSource();
+    ~WinTopologyDataSource() override;
+
+    bool readTopology(CPUTopology& topology) override;
+    bool sampleNodes(std::vector<NodeMemory>& nodes) override;
+
+private:
+    std::vector<USHORT> m_nodeNumbers;          // OS node number of each dense node ID
+    PDH_HQUERY m_query;                         // "NUMA Node Memory" query
+    std::vector<PDH_HCOUNTER> m_totalCounters;  // "Total MBytes" per node (nullptr if missing)
+};
+
+#endif // WINDATASOURCES_H
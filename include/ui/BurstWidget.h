@@ -0,0 +1,59 @@
+#ifndef BURSTWIDGET_H
+#define BURSTWIDGET_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+
+struct BurstRecording;
+
+/**
+ * @class BurstWidget
+ * @brief Zoomable chart of the last burst capture (drag to zoom into a
+ *        time range, right-click or "Reset Zoom" to zoom out)
+ */
+class BurstWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit BurstWidget(QWidget *parent = nullptr);
+    ~BurstWidget();
+
+    /**
+     * @brief Show a capture
+     * @param recording Completed capture
+     * @param savedPath File the capture was saved to (empty if not saved)
+     */
+    void setRecording(const BurstRecording& recording, const QString& savedPath);
+
+    /**
+     * @brief Show that a capture is in progress
+     * @param intervalMs Sampling interval
+     * @param windowMs Capture length
+     */
+    void setCapturing(int intervalMs, int windowMs);
+
+private:
+    void setupUI();
+
+    QLabel *m_summaryLabel;
+    QLabel *m_overheadLabel;
+    QPushButton *m_resetZoomButton;
+    QChart *m_chart;
+    QChartView *m_chartView;
+    QLineSeries *m_cpuSeries;
+    QLineSeries *m_downloadSeries;
+    QLineSeries *m_uploadSeries;
+    QLineSeries *m_diskReadSeries;
+    QLineSeries *m_diskWriteSeries;
+    QValueAxis *m_axisX;
+    QValueAxis *m_axisCpu;
+    QValueAxis *m_axisRate;
+};
+
+#endif // BURSTWIDGET_H
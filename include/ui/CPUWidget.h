@@ -7,10 +7,17 @@
 #include <QtCharts/QChart>
 #include <QtCharts/QChartView>
 #include <QtCharts/QLineSeries>
+#include <QtCharts/QScatterSeries>
 #include <QtCharts/QValueAxis>
 #include <deque>
+#include <cstdint>
 
 class CPUMonitor;
+class PerfMonitor;
+class SchedMonitor;
+class ProcessMonitor;
+class AnomalyDetector;
+class CoreHeatmapWidget;
 
 /**
  * @class CPUWidget
@@ -23,23 +30,87 @@ public:
     explicit CPUWidget(CPUMonitor *monitor, QWidget *parent = nullptr);
     ~CPUWidget();
 
+    /**
+     * @brief Append the latest sample to the chart and heatmap history
+     *
+     * Cheap; called every tick, also while the tab is not shown, so the
+     * charts are complete when it is. Points are plotted against their
+     * tick time, so the 5 s idle ticks still line up on the time axis.
+     *
+     * @param timestampUs Tick timestamp (SystemUtils::monotonicMicros)
+     */
+    void recordSample(uint64_t timestampUs);
+
+    /**
+     * @brief Refresh the labels and redraw the charts from the history
+     */
     void updateData();
 
+    /**
+     * @brief Mark anomalies of a metric series on the usage chart
+     * @param detector Anomaly detector (not owned)
+     * @param seriesId Series ID of the total CPU usage metric
+     */
+    void setAnomalySource(const AnomalyDetector *detector, int seriesId);
+
+    /**
+     * @brief Show IPC and scheduler event rates next to the usage
+     * @param monitor Perf monitor (not owned, may be uninitialized)
+     */
+    void setPerfSource(const PerfMonitor *monitor);
+
+    /**
+     * @brief Chart the run-queue wait next to the usage
+     * @param monitor Scheduler monitor (not owned, may be uninitialized)
+     */
+    void setSchedSource(const SchedMonitor *monitor);
+
+    /**
+     * @brief Show process exits and the CPU of exited processes
+     * @param monitor Process monitor (not owned, may be uninitialized)
+     */
+    void setProcessSource(const ProcessMonitor *monitor);
+
 private:
     void setupUI();
     
     CPUMonitor *m_monitor;
     QLabel *m_usageLabel;
     QLabel *m_coreCountLabel;
+    QLabel *m_thermalLabel;
+    QLabel *m_perfLabel;
+    QLabel *m_schedLabel;
+    QLabel *m_exitLabel;
     
     QChartView *m_chartView;
     QChart *m_chart;
     QLineSeries *m_series;
+    QLineSeries *m_frequencySeries;
+    QLineSeries *m_temperatureSeries;
+    QLineSeries *m_waitSeries;
+    QScatterSeries *m_anomalySeries;
     QValueAxis *m_axisX;
     QValueAxis *m_axisY;
+    QValueAxis *m_axisTemperature;
+    
+    QLabel *m_heatmapLabel;
+    CoreHeatmapWidget *m_heatmap;
     
     std::deque<double> m_dataPoints;
-    int m_maxDataPoints;
+    std::deque<double> m_frequencyPoints;
+    std::deque<double> m_temperaturePoints;
+    std::deque<double> m_waitPoints;
+    std::deque<bool> m_anomalyFlags;
+    std::deque<uint64_t> m_timestamps;  // Tick time of each point (us)
+    uint64_t m_lastColumnUs;            // Tick time of the last heatmap column
+    int m_historySeconds;
+    
+    const AnomalyDetector *m_anomalyDetector;
+    int m_anomalySeriesId;
+    
+    const PerfMonitor *m_perfMonitor;
+    const SchedMonitor *m_schedMonitor;
+    const ProcessMonitor *m_processMonitor;
 };
 
 #endif // CPUWIDGET_H
@@ -0,0 +1,37 @@
+#ifndef CONNECTIONWIDGET_H
+#define CONNECTIONWIDGET_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QVBoxLayout>
+#include <QTableWidget>
+
+class ConnectionMonitor;
+
+/**
+ * @class ConnectionWidget
+ * @brief Widget listing the busiest TCP connections with their process
+ */
+class ConnectionWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructor
+     * @param monitor Connection monitor (not owned)
+     * @param parent Parent widget
+     */
+    explicit ConnectionWidget(ConnectionMonitor *monitor, QWidget *parent = nullptr);
+    ~ConnectionWidget();
+
+    void updateData();
+
+private:
+    void setupUI();
+    
+    ConnectionMonitor *m_monitor;
+    QLabel *m_summaryLabel;
+    QTableWidget *m_tableWidget;
+};
+
+#endif // CONNECTIONWIDGET_H
@@ -0,0 +1,47 @@
+#ifndef COREHEATMAPWIDGET_H
+#define COREHEATMAPWIDGET_H
+
+#include <QWidget>
+#include <QImage>
+#include <QRgb>
+#include <vector>
+
+/**
+ * @class CoreHeatmapWidget
+ * @brief Per-core CPU usage history rendered as a heatmap strip chart
+ *
+ * History is kept in a single QImage with one row per core and one column
+ * per tick, used as a ring buffer: a tick writes one column and a repaint
+ * blits the image (in two slices) scaled to the widget. Paint cost depends
+ * on the widget size, not on the number of cores.
+ */
+class CoreHeatmapWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit CoreHeatmapWidget(int historyLength, QWidget *parent = nullptr);
+    ~CoreHeatmapWidget();
+
+    /**
+     * @brief Append one tick of per-core usage
+     * @param usages Usage per core (0.0 - 100.0)
+     * @param count Number of cores
+     */
+    void appendColumn(const double *usages, int count);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    QImage m_image;                 // coreCount x historyLength ring buffer
+    std::vector<QRgb> m_palette;    // Usage percent (0 - 100) -> color
+    int m_historyLength;            // Columns of history
+    int m_nextColumn;               // Ring buffer write position
+
+    /**
+     * @brief Build the blue -> green -> yellow -> red usage palette
+     */
+    void buildPalette();
+};
+
+#endif // COREHEATMAPWIDGET_H
@@ -5,8 +5,12 @@
 #include <QLabel>
 #include <QVBoxLayout>
 #include <QTableWidget>
+#include <vector>
+
+struct ProcessIoInfo;
 
 class DiskMonitor;
+class ProcessMonitor;
 
 /**
  * @class DiskWidget
@@ -21,11 +25,29 @@ public:
 
     void updateData();
 
+    /**
+     * @brief Show the top reading and writing processes under the drives
+     * @param monitor Process monitor (not owned, may be uninitialized)
+     */
+    void setProcessSource(const ProcessMonitor *monitor);
+
 private:
     void setupUI();
     
+    /**
+     * @brief Fill a top list table
+     * @param table Table to fill
+     * @param processes Processes, busiest first
+     * @param writes Show write rates instead of read rates
+     */
+    static void fillProcessTable(QTableWidget *table, const std::vector<ProcessIoInfo>& processes, bool writes);
+    
     DiskMonitor *m_monitor;
     QTableWidget *m_tableWidget;
+    QTableWidget *m_writersTable;
+    QTableWidget *m_readersTable;
+    
+    const ProcessMonitor *m_processMonitor;
 };
 
 #endif // DISKWIDGET_H
@@ -0,0 +1,45 @@
+#ifndef INTERRUPTWIDGET_H
+#define INTERRUPTWIDGET_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QVBoxLayout>
+#include <QTableWidget>
+
+class InterruptMonitor;
+class CPUMonitor;
+
+/**
+ * @class InterruptWidget
+ * @brief Widget for displaying per-core interrupt and softirq/DPC load
+ *        with the busiest interrupt sources of each core
+ *
+ * Hotspot cores (see InterruptMonitor::isHotspot) are highlighted.
+ */
+class InterruptWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructor
+     * @param monitor Interrupt monitor (not owned)
+     * @param cpuMonitor CPU monitor for the time spent in interrupts (not owned, may be nullptr)
+     * @param parent Parent widget
+     */
+    InterruptWidget(InterruptMonitor *monitor, CPUMonitor *cpuMonitor, QWidget *parent = nullptr);
+    ~InterruptWidget();
+
+    void updateData();
+
+private:
+    void setupUI();
+    
+    InterruptMonitor *m_monitor;
+    CPUMonitor *m_cpuMonitor;
+    QLabel *m_summaryLabel;
+    QTableWidget *m_tableWidget;
+    
+    static constexpr int TOP_SOURCES = 3;   // Sources listed per core
+};
+
+#endif // INTERRUPTWIDGET_H
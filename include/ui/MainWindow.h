@@ -6,28 +6,73 @@
 #include <QSystemTrayIcon>
 #include <QMenu>
 #include <QTabWidget>
+#include "core/TickClock.h"
+#include "core/CollectorStartup.h"
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
 
 // Forward declarations of monitor classes
 class CPUMonitor;
 class RAMMonitor;
 class DiskMonitor;
 class NetworkMonitor;
+class InterruptMonitor;
+class NumaMonitor;
+class PerfMonitor;
+class SchedMonitor;
+class NetStackMonitor;
+class ConnectionMonitor;
+class ProcessMonitor;
+class BurstSampler;
+class BurstAlertSink;
+
+// Forward declarations of core classes
+class Collector;
+class CollectorRegistry;
+class MetricTable;
+class AlertEngine;
+class AnomalyDetector;
+class TrayAlertSink;
+class StreamAlertSink;
 
 // Forward declarations of widget classes
 class CPUWidget;
 class RAMWidget;
 class DiskWidget;
 class NetworkWidget;
+class SelfWidget;
+class BurstWidget;
+class InterruptWidget;
+class NumaWidget;
+class ConnectionWidget;
 
 /**
  * @class MainWindow
  * @brief Main application window with tabbed monitoring widgets
  * 
  * This is the main window that contains:
- * - Tab widget with CPU, RAM, Disk, and Network monitors
- * - Menu bar with File and Help menus
+ * - Tab widget with one tab per enabled collector (CPU, RAM, Disk,
+ *   Network, Connections, Interrupts, NUMA)
+ * - Hidden "Self" tab with the monitor's own collection cost (View menu)
+ * - "Burst" tab with the last high-frequency capture, started from the
+ *   Tools menu, an alert rule marked "burst" or a signal
+ * - Menu bar with File, View, Tools and Help menus
  * - System tray icon for minimizing
  * - Auto-refresh timer
+ *
+ * The window shows before the collectors are ready: they initialize on
+ * worker threads while their tabs are disabled placeholders, and the
+ * update loop starts once all of them have finished. The NUMA and
+ * Connections collectors are only initialized when their tab is first
+ * opened. Time to first frame and to first data are published as
+ * "startup.*" metrics and shown in the status bar.
+ *
+ * While the window is hidden or minimized nothing is redrawn and the
+ * collectors are sampled every IDLE_UPDATE_INTERVAL_MS; alerts, anomaly
+ * detection and the chart history keep running. Only the current tab is
+ * redrawn; a tab catches up from the history in one redraw when shown.
  */
 class MainWindow : public QMainWindow {
     Q_OBJECT
@@ -36,8 +81,13 @@ public:
     /**
      * @brief Constructor
      * @param parent Parent widget
+     * @param fixtureRoot Replay monitor data from this fixture directory
+     *        instead of the OS (empty = live data)
+     * @param alertLog Append alert transitions to this file (empty = none)
+     * @param startUs Process start, SystemUtils::monotonicMicros() (0 = now)
      */
-    explicit MainWindow(QWidget *parent = nullptr);
+    explicit MainWindow(QWidget *parent = nullptr, const QString& fixtureRoot = QString(),
+                        const QString& alertLog = QString(), uint64_t startUs = 0);
     
     /**
      * @brief Destructor
@@ -51,17 +101,75 @@ protected:
      */
     void closeEvent(QCloseEvent *event) override;
 
+    /**
+     * @brief Record the first frame
+     * @param event Paint event
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+    /**
+     * @brief Resume rendering when the window is shown
+     * @param event Show event
+     */
+    void showEvent(QShowEvent *event) override;
+
+    /**
+     * @brief Throttle updates when the window is hidden
+     * @param event Hide event
+     */
+    void hideEvent(QHideEvent *event) override;
+
+    /**
+     * @brief Throttle updates while the window is minimized
+     * @param event Change event
+     */
+    void changeEvent(QEvent *event) override;
+
 private slots:
     /**
      * @brief Update all monitors and widgets
      */
     void updateMonitors();
+
+    /**
+     * @brief Take collectors that finished initializing; start the update
+     *        loop once the startup set is ready
+     */
+    void checkStartup();
+
+    /**
+     * @brief Initialize the collector of a deferred tab when first shown
+     * @param index Tab index
+     */
+    void tabChanged(int index);
+
+    /**
+     * @brief Switch between the visible and idle update rate, redrawing
+     *        the current tab when the window becomes visible
+     */
+    void updateVisibility();
     
     /**
      * @brief Show/hide main window from system tray
      */
     void toggleWindowVisibility();
     
+    /**
+     * @brief Show/hide the self-instrumentation tab
+     * @param visible true to show the tab
+     */
+    void setSelfTabVisible(bool visible);
+
+    /**
+     * @brief Start a burst capture with the default settings
+     */
+    void startBurst();
+
+    /**
+     * @brief Collect, save and show a finished burst capture
+     */
+    void checkBurst();
+    
     /**
      * @brief System tray icon activated
      * @param reason Activation reason
@@ -90,10 +198,80 @@ private:
     void setupSystemTray();
     
     /**
-     * @brief Initialize monitoring components
+     * @brief Create and initialize the enabled collectors (built in and
+     *        plugins, filtered by collectors.conf)
      */
     void initializeMonitors();
 
+    /**
+     * @brief Register series, start the update loop and take the first sample
+     */
+    void finishStartup();
+
+    /**
+     * @brief Get the collector initialized when a tab is first opened
+     * @param page Tab page
+     * @return Deferred collector, or nullptr if the tab has none
+     */
+    Collector* deferredCollector(QWidget *page) const;
+
+    /**
+     * @brief Start deferred collectors whose series an alert rule watches
+     */
+    void startWatchedCollectors();
+
+    /**
+     * @brief Enable the tabs whose collectors are ready
+     */
+    void updatePlaceholders();
+
+    /**
+     * @brief Publish and show the startup times once both are known
+     */
+    void reportStartup();
+
+    /**
+     * @brief Find an enabled collector by registry name
+     * @param name Registry name
+     * @return Collector, or nullptr if disabled or not a T
+     */
+    template<typename T>
+    T* findCollector(const char* name) const;
+
+    /**
+     * @brief Check if the window is shown and not minimized
+     */
+    bool isRendering() const;
+
+    /**
+     * @brief Redraw the widget of a tab from the latest sample
+     * @param page Tab page (nullptr or a page without data is ignored)
+     */
+    void renderPage(QWidget *page);
+
+    /**
+     * @brief Get the update interval for the current visibility
+     * @return Interval in milliseconds
+     */
+    int updateInterval() const;
+
+    /**
+     * @brief Setup metric table, alert engine, default alert rules and
+     *        anomaly detection
+     */
+    void setupAlerts();
+
+    /**
+     * @brief Publish the latest monitor values into the metric table
+     */
+    void publishMetrics();
+
+    /**
+     * @brief Start polling for the end of a capture started elsewhere
+     *        (alert sink), if one is running
+     */
+    void watchBurst();
+
     // UI Components
     QTabWidget *m_tabWidget;
     
@@ -102,22 +280,69 @@ private:
     RAMWidget *m_ramWidget;
     DiskWidget *m_diskWidget;
     NetworkWidget *m_networkWidget;
+    SelfWidget *m_selfWidget;
+    BurstWidget *m_burstWidget;
+    InterruptWidget *m_interruptWidget;
+    NumaWidget *m_numaWidget;
+    ConnectionWidget *m_connectionWidget;
     
-    // Monitor backends
+    // Collectors, in update order, and typed views of the built-in ones
+    // for the widgets (nullptr if disabled)
+    CollectorRegistry *m_collectorRegistry;
+    std::vector<std::unique_ptr<Collector>> m_collectors;
     CPUMonitor *m_cpuMonitor;
     RAMMonitor *m_ramMonitor;
     DiskMonitor *m_diskMonitor;
     NetworkMonitor *m_networkMonitor;
+    InterruptMonitor *m_interruptMonitor;
+    NumaMonitor *m_numaMonitor;
+    PerfMonitor *m_perfMonitor;
+    SchedMonitor *m_schedMonitor;
+    NetStackMonitor *m_netStackMonitor;
+    ConnectionMonitor *m_connectionMonitor;
+    ProcessMonitor *m_processMonitor;
+    CollectorStartup m_startup; // Initializes collectors off the UI thread
     
+    // Metrics and alerting
+    MetricTable *m_metrics;
+    AlertEngine *m_alertEngine;
+    AnomalyDetector *m_anomalyDetector;
+    TrayAlertSink *m_trayAlertSink;
+    std::ofstream *m_alertLog;          // Alert log file (nullptr if none)
+    StreamAlertSink *m_alertLogSink;    // Writes alerts to m_alertLog
+    TickClock m_tickClock;      // One timestamp per update, missed/late ticks
+
+    // High-frequency burst capture
+    BurstSampler *m_burstSampler;
+    BurstAlertSink *m_burstAlertSink;
+    QTimer *m_burstTimer;       // Polls for the end of a capture
+
     // System tray
     QSystemTrayIcon *m_trayIcon;
     QMenu *m_trayMenu;
     
     // Update timer
     QTimer *m_updateTimer;
+    QTimer *m_startupTimer;     // Polls collector initialization
+    bool m_rendering;           // Window visible, widgets redrawn each tick
+
+    // Startup times (SystemUtils::monotonicMicros, 0 = not yet)
+    uint64_t m_startUs;
+    uint64_t m_firstFrameUs;
+    uint64_t m_firstDataUs;
+    
+    // Fixture directory replayed instead of live data (empty = live)
+    QString m_fixtureRoot;
+    QString m_alertLogPath;     // Alert log file (empty = none)
     
     // Constants
     static constexpr int UPDATE_INTERVAL_MS = 1000;  // 1 second
+    static constexpr int IDLE_UPDATE_INTERVAL_MS = 5000; // Hidden or minimized
+    static constexpr int BURST_INTERVAL_MS = 1;      // Burst sampling interval
+    static constexpr int BURST_WINDOW_MS = 2000;     // Burst capture length
+    static constexpr int BURST_POLL_MS = 100;        // Capture completion polling
+    static constexpr int STARTUP_POLL_MS = 10;       // Collector initialization polling
+    static constexpr int STATUS_TIMEOUT_MS = 10000;  // Status bar message lifetime
 };
 
 #endif // MAINWINDOW_H
@@ -0,0 +1,25 @@
+#ifndef NAMETEXT_H
+#define NAMETEXT_H
+
+#include "core/NameTable.h"
+#include <QString>
+
+/**
+ * @class NameText
+ * @brief QString forms of interned names, converted once per name
+ *
+ * QString is implicitly shared, so the returned copies only bump a
+ * reference count. UI thread only.
+ */
+class NameText {
+public:
+    /**
+     * @brief Get the display form of a name
+     * @param id Name id
+     * @param empty Text shown for NameTable::EMPTY
+     * @return Name text
+     */
+    static QString get(NameId id, const QString& empty = QString());
+};
+
+#endif // NAMETEXT_H
@@ -7,10 +7,15 @@
 #include <QtCharts/QChart>
 #include <QtCharts/QChartView>
 #include <QtCharts/QLineSeries>
+#include <QtCharts/QScatterSeries>
 #include <QtCharts/QValueAxis>
 #include <deque>
+#include <cstdint>
 
 class NetworkMonitor;
+class AnomalyDetector;
+class InterruptMonitor;
+class NetStackMonitor;
 
 /**
  * @class NetworkWidget
@@ -23,25 +28,73 @@ public:
     explicit NetworkWidget(NetworkMonitor *monitor, QWidget *parent = nullptr);
     ~NetworkWidget();
 
+    /**
+     * @brief Append the latest sample to the chart history
+     *
+     * Cheap; called every tick, also while the tab is not shown, so the
+     * chart is complete when it is. Points are plotted against their
+     * tick time, so the 5 s idle ticks still line up on the time axis.
+     *
+     * @param timestampUs Tick timestamp (SystemUtils::monotonicMicros)
+     */
+    void recordSample(uint64_t timestampUs);
+
+    /**
+     * @brief Refresh the labels and redraw the chart from the history
+     */
     void updateData();
 
+    /**
+     * @brief Mark anomalies of the traffic metric series on the chart
+     * @param detector Anomaly detector (not owned)
+     * @param downloadSeriesId Series ID of the total download speed metric
+     * @param uploadSeriesId Series ID of the total upload speed metric
+     */
+    void setAnomalySource(const AnomalyDetector *detector, int downloadSeriesId, int uploadSeriesId);
+
+    /**
+     * @brief Show NET_RX/NET_TX softirq rates (DPC rate on Windows) next to
+     *        the traffic
+     * @param monitor Interrupt monitor (not owned)
+     */
+    void setInterruptSource(const InterruptMonitor *monitor);
+
+    /**
+     * @brief Show TCP/IP stack health next to the traffic
+     * @param monitor Stack monitor (not owned, may be uninitialized)
+     */
+    void setNetStackSource(const NetStackMonitor *monitor);
+
 private:
     void setupUI();
     
     NetworkMonitor *m_monitor;
     QLabel *m_downloadLabel;
     QLabel *m_uploadLabel;
+    QLabel *m_softirqLabel;
+    QLabel *m_stackLabel;
     
     QChartView *m_chartView;
     QChart *m_chart;
     QLineSeries *m_downloadSeries;
     QLineSeries *m_uploadSeries;
+    QScatterSeries *m_anomalySeries;
     QValueAxis *m_axisX;
     QValueAxis *m_axisY;
     
     std::deque<double> m_downloadPoints;
     std::deque<double> m_uploadPoints;
-    int m_maxDataPoints;
+    std::deque<bool> m_downloadAnomalies;
+    std::deque<bool> m_uploadAnomalies;
+    std::deque<uint64_t> m_timestamps;  // Tick time of each point (us)
+    int m_historySeconds;
+    
+    const AnomalyDetector *m_anomalyDetector;
+    int m_downloadSeriesId;
+    int m_uploadSeriesId;
+    
+    const InterruptMonitor *m_interruptMonitor;
+    const NetStackMonitor *m_netStackMonitor;
 };
 
 #endif // NETWORKWIDGET_H
@@ -0,0 +1,38 @@
+#ifndef NUMAWIDGET_H
+#define NUMAWIDGET_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QVBoxLayout>
+#include <QTableWidget>
+
+class NumaMonitor;
+
+/**
+ * @class NumaWidget
+ * @brief Widget for displaying CPU and memory usage per NUMA node and socket
+ *
+ * Nodes whose CPU or memory usage reaches SATURATED_PERCENT are
+ * highlighted, since the machine-wide totals can stay low while they do.
+ */
+class NumaWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit NumaWidget(NumaMonitor *monitor, QWidget *parent = nullptr);
+    ~NumaWidget();
+
+    void updateData();
+
+private:
+    void setupUI();
+    
+    NumaMonitor *m_monitor;
+    QLabel *m_topologyLabel;
+    QLabel *m_packageLabel;
+    QTableWidget *m_tableWidget;
+    
+    static constexpr double SATURATED_PERCENT = 90.0;
+};
+
+#endif // NUMAWIDGET_H
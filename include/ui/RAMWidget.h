@@ -5,8 +5,10 @@
 #include <QLabel>
 #include <QProgressBar>
 #include <QVBoxLayout>
+#include <QTableWidget>
 
 class RAMMonitor;
+class ProcessMonitor;
 
 /**
  * @class RAMWidget
@@ -21,6 +23,12 @@ public:
 
     void updateData();
 
+    /**
+     * @brief Show memory by process under the totals
+     * @param monitor Process monitor (not owned, may be uninitialized)
+     */
+    void setProcessSource(const ProcessMonitor *monitor);
+
 private:
     void setupUI();
     
@@ -28,6 +36,10 @@ private:
     QLabel *m_usageLabel;
     QLabel *m_detailsLabel;
     QProgressBar *m_progressBar;
+    QLabel *m_processLabel;
+    QTableWidget *m_processTable;
+    
+    const ProcessMonitor *m_processMonitor;
 };
 
 #endif // RAMWIDGET_H
@@ -0,0 +1,27 @@
+#ifndef SELFWIDGET_H
+#define SELFWIDGET_H
+
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QTableWidget>
+
+/**
+ * @class SelfWidget
+ * @brief Widget for displaying the monitor's own collection cost per probe
+ */
+class SelfWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit SelfWidget(QWidget *parent = nullptr);
+    ~SelfWidget();
+
+    void updateData();
+
+private:
+    void setupUI();
+    
+    QTableWidget *m_tableWidget;
+};
+
+#endif // SELFWIDGET_H
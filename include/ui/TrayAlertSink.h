@@ -0,0 +1,22 @@
+#ifndef TRAYALERTSINK_H
+#define TRAYALERTSINK_H
+
+#include "core/AlertEngine.h"
+
+class QSystemTrayIcon;
+
+/**
+ * @class TrayAlertSink
+ * @brief Shows raised alerts as system tray balloon messages
+ */
+class TrayAlertSink : public AlertSink {
+public:
+    explicit TrayAlertSink(QSystemTrayIcon *trayIcon);
+
+    void onAlert(const AlertEvent& event) override;
+
+private:
+    QSystemTrayIcon *m_trayIcon;
+};
+
+#endif // TRAYALERTSINK_H
@@ -12,6 +12,8 @@
  * - Data formatting (bytes to KB/MB/GB)
  * - Percentage formatting
  * - Time formatting
+ * - Counter rate calculation
+ * - Monotonic sample timestamps
  */
 class SystemUtils {
 public:
@@ -39,6 +41,20 @@ public:
      */
     static std::wstring formatPercent(double percent, int precision = 1);
 
+    /**
+     * @brief Calculate the per-second rate of a monotonically increasing counter
+     * @param current Current counter value
+     * @param previous Counter value at the previous sample
+     * @param elapsedSec Seconds between the two samples
+     * @return Rate per second (0.0 if the counter went backwards or no time elapsed)
+     */
+    static double calculateRate(uint64_t current, uint64_t previous, double elapsedSec) {
+        if (elapsedSec <= 0.0 || current < previous) {
+            return 0.0;
+        }
+        return static_cast<double>(current - previous) / elapsedSec;
+    }
+
     /**
      * @brief Clamp value between min and max
      * @param value Value to clamp
@@ -66,6 +82,16 @@ public:
      * @return Wide string
      */
     static std::wstring stringToWstring(const std::string& str);
+
+    /**
+     * @brief Read the monotonic clock used to timestamp samples
+     *
+     * QueryPerformanceCounter on Windows (sub-microsecond, unlike the
+     * 10-16 ms steps of GetTickCount64), steady_clock elsewhere.
+     *
+     * @return Microseconds since an arbitrary epoch (always > 0)
+     */
+    static uint64_t monotonicMicros();
 };
 
 #endif // SYSTEMUTILS_H
@@ -0,0 +1,252 @@
+#include "core/AlertEngine.h"
+#include "core/MetricTable.h"
+#include "utils/SystemUtils.h"
+#include <sstream>
+#include <cstdlib>
+
+StreamAlertSink::StreamAlertSink(std::ostream& stream)
+    : m_stream(stream)
+{
+}
+
+void StreamAlertSink::onAlert(const AlertEvent& event) {
+    m_stream << (event.raised ? "ALERT " : "CLEAR ")
+             << event.ruleName << " (" << event.series << " = "
+             << SystemUtils::wstringToString(MetricSchema::format(event.unit, event.value))
+             << ", threshold " << SystemUtils::wstringToString(MetricSchema::format(event.unit, event.threshold))
+             << ")" << std::endl;
+}
+
+AlertEngine::AlertEngine()
+    : m_boundSeriesCount(-1)
+    , m_activeCount(0)
+{
+}
+
+void AlertEngine::addRule(const AlertRule& rule) {
+    m_rules.push_back(rule);
+
+    RuleState state;
+    state.seriesId = -1;
+    state.unit = MetricUnit::None;
+    state.active = false;
+    state.hasPrevious = false;
+    state.violatingSince = -1.0;
+    state.previousValue = 0.0;
+    state.trendBase = 0.0;
+    m_states.push_back(state);
+
+    // Force name resolution on next evaluation
+    m_boundSeriesCount = -1;
+}
+
+bool AlertEngine::addRule(const std::string& expression) {
+    AlertRule rule;
+    if (!parseRule(expression, rule)) {
+        return false;
+    }
+    addRule(rule);
+    return true;
+}
+
+int AlertEngine::loadRules(std::istream& input) {
+    int added = 0;
+    std::string line;
+
+    while (std::getline(input, line)) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        if (addRule(line)) {
+            added++;
+        }
+    }
+
+    return added;
+}
+
+bool AlertEngine::parseRule(const std::string& expression, AlertRule& rule) {
+    std::istringstream tokens(expression);
+    std::string op;
+    std::string value;
+
+    rule.name = expression;
+    rule.comparison = AlertComparison::Greater;
+    rule.threshold = 0.0;
+    rule.hysteresis = 0.0;
+    rule.durationSec = 0.0;
+    rule.trend = AlertTrend::Any;
+    rule.burst = false;
+
+    if (!(tokens >> rule.series >> op >> value)) {
+        return false;
+    }
+
+    if (op == ">") {
+        rule.comparison = AlertComparison::Greater;
+    } else if (op == "<") {
+        rule.comparison = AlertComparison::Less;
+    } else {
+        return false;
+    }
+
+    // Accept "90%" as well as "90"
+    if (!value.empty() && value.back() == '%') {
+        value.pop_back();
+    }
+    char* end = nullptr;
+    rule.threshold = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0') {
+        return false;
+    }
+
+    std::string keyword;
+    while (tokens >> keyword) {
+        if (keyword == "for") {
+            std::string duration;
+            if (!(tokens >> duration)) {
+                return false;
+            }
+            double scale = 1.0;
+            if (!duration.empty() && duration.back() == 's') {
+                duration.pop_back();
+            } else if (!duration.empty() && duration.back() == 'm') {
+                duration.pop_back();
+                scale = 60.0;
+            }
+            rule.durationSec = std::strtod(duration.c_str(), &end) * scale;
+            if (duration.empty() || *end != '\0') {
+                return false;
+            }
+        } else if (keyword == "rising") {
+            rule.trend = AlertTrend::Rising;
+        } else if (keyword == "falling") {
+            rule.trend = AlertTrend::Falling;
+        } else if (keyword == "hysteresis") {
+            if (!(tokens >> rule.hysteresis)) {
+                return false;
+            }
+        } else if (keyword == "burst") {
+            rule.burst = true;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void AlertEngine::addSink(AlertSink* sink) {
+    if (sink) {
+        m_sinks.push_back(sink);
+    }
+}
+
+void AlertEngine::evaluate(const MetricTable& metrics, double nowSec) {
+    if (metrics.seriesCount() != m_boundSeriesCount) {
+        bindSeries(metrics);
+    }
+
+    const double* values = metrics.values();
+
+    for (size_t i = 0; i < m_rules.size(); i++) {
+        const AlertRule& rule = m_rules[i];
+        RuleState& state = m_states[i];
+
+        if (state.seriesId < 0) {
+            continue;
+        }
+
+        double value = values[state.seriesId];
+
+        if (!state.active) {
+            bool beyond = (rule.comparison == AlertComparison::Greater)
+                ? value > rule.threshold
+                : value < rule.threshold;
+
+            if (beyond && state.violatingSince < 0.0) {
+                // Trends are measured from the last value before the
+                // violation, so a flat series keeps a violation going
+                state.violatingSince = nowSec;
+                state.trendBase = state.hasPrevious ? state.previousValue : value;
+            }
+
+            bool trendOk = true;
+            if (rule.trend == AlertTrend::Rising) {
+                trendOk = value > state.trendBase;
+            } else if (rule.trend == AlertTrend::Falling) {
+                trendOk = value < state.trendBase;
+            }
+
+            if (beyond) {
+                if (trendOk && nowSec - state.violatingSince >= rule.durationSec) {
+                    state.active = true;
+                    m_activeCount++;
+                    notify(rule, state, value, true, nowSec);
+                }
+            } else {
+                state.violatingSince = -1.0;
+            }
+        } else {
+            // Clear only once the value is back past the hysteresis band
+            bool cleared = (rule.comparison == AlertComparison::Greater)
+                ? value <= rule.threshold - rule.hysteresis
+                : value >= rule.threshold + rule.hysteresis;
+
+            if (cleared) {
+                state.active = false;
+                state.violatingSince = -1.0;
+                m_activeCount--;
+                notify(rule, state, value, false, nowSec);
+            }
+        }
+
+        state.previousValue = value;
+        state.hasPrevious = true;
+    }
+}
+
+int AlertEngine::ruleCount() const {
+    return static_cast<int>(m_rules.size());
+}
+
+bool AlertEngine::referencesSeries(const std::string& prefix) const {
+    for (const AlertRule& rule : m_rules) {
+        if (rule.series.compare(0, prefix.size(), prefix) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int AlertEngine::activeCount() const {
+    return m_activeCount;
+}
+
+void AlertEngine::bindSeries(const MetricTable& metrics) {
+    for (size_t i = 0; i < m_rules.size(); i++) {
+        m_states[i].seriesId = metrics.findSeries(m_rules[i].series);
+        m_states[i].unit = metrics.seriesUnit(m_states[i].seriesId);
+    }
+    m_boundSeriesCount = metrics.seriesCount();
+}
+
+void AlertEngine::notify(const AlertRule& rule, const RuleState& state, double value, bool raised, double nowSec) {
+    AlertEvent event;
+    event.ruleName = rule.name;
+    event.series = rule.series;
+    event.value = value;
+    event.unit = state.unit;
+    event.threshold = rule.threshold;
+    event.raised = raised;
+    event.timestamp = nowSec;
+    event.burst = rule.burst;
+
+    for (AlertSink* sink : m_sinks) {
+        sink->onAlert(event);
+    }
+}
@@ -0,0 +1,151 @@
+#include "core/AnomalyDetector.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ANOMALY_USE_SSE2 1
+#endif
+
+namespace {
+    // Standard deviation floor, so near-constant series don't divide by ~0
+    constexpr double RELATIVE_STDDEV_FLOOR = 0.05;  // 5% of the mean
+    constexpr double ABSOLUTE_STDDEV_FLOOR = 0.5;
+}
+
+AnomalyDetector::AnomalyDetector(double alpha, double threshold, int warmupSamples)
+    : m_alpha(alpha)
+    , m_threshold(threshold)
+    , m_warmupSamples(warmupSamples)
+    , m_anomalyCount(0)
+    , m_maxScore(0.0)
+    , m_countSeries(-1)
+    , m_maxScoreSeries(-1)
+{
+}
+
+void AnomalyDetector::update(const MetricTable& metrics) {
+    if (metrics.seriesCount() != static_cast<int>(m_mean.size())) {
+        resize(metrics);
+    }
+
+    int count = metrics.seriesCount();
+    scoreBatch(metrics.values(), count);
+
+    // The detector's own output would feed back into the next tick
+    if (m_countSeries >= 0 && m_countSeries < count) {
+        m_scores[m_countSeries] = 0.0;
+    }
+    if (m_maxScoreSeries >= 0 && m_maxScoreSeries < count) {
+        m_scores[m_maxScoreSeries] = 0.0;
+    }
+
+    // Flag pass (kept separate so the kernel stays branch-free)
+    m_anomalyCount = 0;
+    m_maxScore = 0.0;
+    for (int i = 0; i < count; i++) {
+        bool warm = m_samples[i] >= m_warmupSamples;
+        double magnitude = warm ? std::fabs(m_scores[i]) : 0.0;
+        bool anomalous = magnitude > m_threshold;
+        m_flags[i] = anomalous ? 1 : 0;
+        m_anomalyCount += m_flags[i];
+        if (magnitude > m_maxScore) {
+            m_maxScore = magnitude;
+        }
+        if (!warm) {
+            m_samples[i]++;
+        }
+    }
+}
+
+double AnomalyDetector::score(int seriesId) const {
+    if (seriesId < 0 || seriesId >= static_cast<int>(m_scores.size())) {
+        return 0.0;
+    }
+    return m_scores[seriesId];
+}
+
+bool AnomalyDetector::isAnomalous(int seriesId) const {
+    if (seriesId < 0 || seriesId >= static_cast<int>(m_flags.size())) {
+        return false;
+    }
+    return m_flags[seriesId] != 0;
+}
+
+int AnomalyDetector::anomalyCount() const {
+    return m_anomalyCount;
+}
+
+double AnomalyDetector::maxScore() const {
+    return m_maxScore;
+}
+
+void AnomalyDetector::registerSeries(MetricTable& metrics) {
+    m_countSeries = metrics.addSeries(MetricId::AnomalyCount);
+    m_maxScoreSeries = metrics.addSeries(MetricId::AnomalyMaxScore);
+}
+
+void AnomalyDetector::publish(MetricTable& metrics) const {
+    metrics.set(m_countSeries, static_cast<double>(m_anomalyCount));
+    metrics.set(m_maxScoreSeries, m_maxScore);
+}
+
+void AnomalyDetector::resize(const MetricTable& metrics) {
+    int oldCount = static_cast<int>(m_mean.size());
+    int count = metrics.seriesCount();
+    const double* values = metrics.values();
+
+    m_mean.resize(count);
+    m_variance.resize(count, 0.0);
+    m_scores.resize(count, 0.0);
+    m_samples.resize(count, 0);
+    m_flags.resize(count, 0);
+
+    // Seed new series with their current value so the first score is 0
+    for (int i = oldCount; i < count; i++) {
+        m_mean[i] = values[i];
+    }
+}
+
+void AnomalyDetector::scoreBatch(const double* values, int count) {
+    double* mean = m_mean.data();
+    double* variance = m_variance.data();
+    double* scores = m_scores.data();
+    const double alpha = m_alpha;
+    const double decay = 1.0 - m_alpha;
+
+    int i = 0;
+
+#ifdef ANOMALY_USE_SSE2
+    const __m128d vAlpha = _mm_set1_pd(alpha);
+    const __m128d vDecay = _mm_set1_pd(decay);
+    const __m128d vRelFloor = _mm_set1_pd(RELATIVE_STDDEV_FLOOR);
+    const __m128d vAbsFloor = _mm_set1_pd(ABSOLUTE_STDDEV_FLOOR);
+    const __m128d vSignMask = _mm_set1_pd(-0.0);
+
+    for (; i + 2 <= count; i += 2) {
+        __m128d x = _mm_loadu_pd(values + i);
+        __m128d m = _mm_loadu_pd(mean + i);
+        __m128d var = _mm_loadu_pd(variance + i);
+
+        __m128d delta = _mm_sub_pd(x, m);
+        __m128d absMean = _mm_andnot_pd(vSignMask, m);
+        __m128d stddev = _mm_add_pd(_mm_sqrt_pd(var),
+            _mm_add_pd(_mm_mul_pd(vRelFloor, absMean), vAbsFloor));
+
+        _mm_storeu_pd(scores + i, _mm_div_pd(delta, stddev));
+        _mm_storeu_pd(mean + i, _mm_add_pd(m, _mm_mul_pd(vAlpha, delta)));
+        _mm_storeu_pd(variance + i, _mm_mul_pd(vDecay,
+            _mm_add_pd(var, _mm_mul_pd(vAlpha, _mm_mul_pd(delta, delta)))));
+    }
+#endif
+
+    for (; i < count; i++) {
+        double delta = values[i] - mean[i];
+        double stddev = std::sqrt(variance[i])
+            + RELATIVE_STDDEV_FLOOR * std::fabs(mean[i]) + ABSOLUTE_STDDEV_FLOOR;
+
+        scores[i] = delta / stddev;
+        mean[i] += alpha * delta;
+        variance[i] = decay * (variance[i] + alpha * delta * delta);
+    }
+}
@@ -0,0 +1,78 @@
+#include "core/BurstRing.h"
+#include <algorithm>
+
+BurstRing::BurstRing()
+    : m_capacity(0)
+    , m_coreCount(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_dropped(0)
+{
+}
+
+void BurstRing::reset(size_t capacity, int coreCount) {
+    // One slot stays empty to tell a full ring from an empty one
+    m_capacity = capacity + 1;
+    m_coreCount = coreCount > 0 ? coreCount : 0;
+    m_samples.assign(m_capacity, BurstSample());
+    m_coreUsages.assign(m_capacity * static_cast<size_t>(m_coreCount), 0.0);
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    m_dropped.store(0, std::memory_order_relaxed);
+}
+
+bool BurstRing::push(const BurstSample& sample, const double* coreUsages) {
+    if (m_capacity == 0) {
+        return false;
+    }
+
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t next = (head + 1 == m_capacity) ? 0 : head + 1;
+    if (next == m_tail.load(std::memory_order_acquire)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_samples[head] = sample;
+    if (coreUsages && m_coreCount > 0) {
+        std::copy_n(coreUsages, m_coreCount, m_coreUsages.begin() + head * m_coreCount);
+    }
+
+    // Publish the slot to the consumer
+    m_head.store(next, std::memory_order_release);
+    return true;
+}
+
+bool BurstRing::pop(BurstSample& sample, double* coreUsages) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    sample = m_samples[tail];
+    if (coreUsages && m_coreCount > 0) {
+        std::copy_n(m_coreUsages.begin() + tail * m_coreCount, m_coreCount, coreUsages);
+    }
+
+    // Hand the slot back to the producer
+    m_tail.store((tail + 1 == m_capacity) ? 0 : tail + 1, std::memory_order_release);
+    return true;
+}
+
+size_t BurstRing::size() const {
+    size_t head = m_head.load(std::memory_order_acquire);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    return head >= tail ? head - tail : head + m_capacity - tail;
+}
+
+size_t BurstRing::capacity() const {
+    return m_capacity > 0 ? m_capacity - 1 : 0;
+}
+
+int BurstRing::coreCount() const {
+    return m_coreCount;
+}
+
+uint64_t BurstRing::droppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,144 @@
+#include "core/CollectorRegistry.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+    bool sameHost(const std::string& a, const std::string& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+}
+
+CollectorRegistry::CollectorRegistry()
+    : m_defaultEnabled(true)
+{
+}
+
+void CollectorRegistry::add(const std::string& name, CollectorFactory factory) {
+    for (Entry& entry : m_entries) {
+        if (entry.name == name) {
+            entry.factory = std::move(factory);
+            return;
+        }
+    }
+    m_entries.push_back(Entry{name, std::move(factory)});
+}
+
+std::vector<std::string> CollectorRegistry::names() const {
+    std::vector<std::string> result;
+    for (const Entry& entry : m_entries) {
+        result.push_back(entry.name);
+    }
+    return result;
+}
+
+void CollectorRegistry::setEnabled(const std::string& name, bool enabled) {
+    if (name == "*") {
+        m_defaultEnabled = enabled;
+        m_overrides.clear();
+        return;
+    }
+    for (auto& entry : m_overrides) {
+        if (entry.first == name) {
+            entry.second = enabled;
+            return;
+        }
+    }
+    m_overrides.emplace_back(name, enabled);
+}
+
+bool CollectorRegistry::isEnabled(const std::string& name) const {
+    for (const auto& entry : m_overrides) {
+        if (entry.first == name) {
+            return entry.second;
+        }
+    }
+    return m_defaultEnabled;
+}
+
+int CollectorRegistry::loadConfig(std::istream& config, const std::string& host) {
+    int applied = 0;
+    std::string line;
+
+    while (std::getline(config, line)) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream tokens(line);
+        std::string name;
+        std::string state;
+        std::string lineHost;
+        if (!(tokens >> name)) {
+            continue;
+        }
+        if (!(tokens >> state) || (state != "on" && state != "off")) {
+            std::cerr << "Invalid collector config line: " << line << std::endl;
+            continue;
+        }
+        if (tokens >> lineHost && !sameHost(lineHost, host)) {
+            continue;
+        }
+        setEnabled(name, state == "on");
+        applied++;
+    }
+
+    return applied;
+}
+
+int CollectorRegistry::loadPlugins(const std::filesystem::path& directory) {
+    int loaded = 0;
+#ifdef _WIN32
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(directory, error)) {
+        if (file.path().extension() != L".dll") {
+            continue;
+        }
+        HMODULE module = LoadLibraryW(file.path().c_str());
+        if (!module) {
+            std::cerr << "Failed to load collector plugin " << file.path().string() << std::endl;
+            continue;
+        }
+        auto entry = reinterpret_cast<CollectorPluginEntry>(GetProcAddress(module, PLUGIN_ENTRY));
+        if (!entry) {
+            std::cerr << "Not a collector plugin: " << file.path().string() << std::endl;
+            FreeLibrary(module);
+            continue;
+        }
+        entry(*this);
+        loaded++;
+    }
+#else
+    (void)directory;    // Plugins are Windows DLLs
+#endif
+    return loaded;
+}
+
+std::unique_ptr<Collector> CollectorRegistry::create(const std::string& name, const CollectorContext& context) const {
+    for (const Entry& entry : m_entries) {
+        if (entry.name == name) {
+            return entry.factory(context);
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::unique_ptr<Collector>> CollectorRegistry::createEnabled(const CollectorContext& context) const {
+    std::vector<std::unique_ptr<Collector>> collectors;
+    for (const Entry& entry : m_entries) {
+        if (!isEnabled(entry.name)) {
+            continue;
+        }
+        std::unique_ptr<Collector> collector = entry.factory(context);
+        if (collector) {
+            collectors.push_back(std::move(collector));
+        }
+    }
+    return collectors;
+}
@@ -0,0 +1,99 @@
+#include "core/CollectorStartup.h"
+#include <chrono>
+
+CollectorStartup::~CollectorStartup() {
+    wait();
+}
+
+void CollectorStartup::add(Collector *collector, bool deferred) {
+    m_entries.push_back(Entry{collector, deferred, deferred ? State::Deferred : State::Queued, std::future<bool>()});
+}
+
+void CollectorStartup::start() {
+    for (Entry& entry : m_entries) {
+        if (entry.state == State::Queued) {
+            launch(entry);
+        }
+    }
+}
+
+bool CollectorStartup::start(Collector *collector) {
+    for (Entry& entry : m_entries) {
+        if (entry.collector == collector && entry.state == State::Deferred) {
+            launch(entry);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<Collector*> CollectorStartup::poll() {
+    std::vector<Collector*> finished;
+    for (Entry& entry : m_entries) {
+        if (entry.state != State::Starting ||
+            entry.result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+        // A failed collector is ready too; it publishes nothing
+        entry.result.get();
+        entry.state = State::Ready;
+        finished.push_back(entry.collector);
+    }
+
+    if (!finished.empty()) {
+        m_ready.clear();
+        for (const Entry& entry : m_entries) {
+            if (entry.state == State::Ready) {
+                m_ready.push_back(entry.collector);
+            }
+        }
+    }
+    return finished;
+}
+
+void CollectorStartup::wait() {
+    for (Entry& entry : m_entries) {
+        if (entry.result.valid()) {
+            entry.result.wait();
+        }
+    }
+}
+
+bool CollectorStartup::isReady(const Collector *collector) const {
+    for (const Entry& entry : m_entries) {
+        if (entry.collector == collector) {
+            return entry.state == State::Ready;
+        }
+    }
+    return false;
+}
+
+bool CollectorStartup::isStarting() const {
+    for (const Entry& entry : m_entries) {
+        if (!entry.deferred && entry.state != State::Ready) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CollectorStartup::isBusy() const {
+    for (const Entry& entry : m_entries) {
+        if (entry.state == State::Starting) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<Collector*>& CollectorStartup::ready() const {
+    return m_ready;
+}
+
+void CollectorStartup::launch(Entry& entry) {
+    Collector *collector = entry.collector;
+    entry.result = std::async(std::launch::async, [collector] {
+        return collector->initialize();
+    });
+    entry.state = State::Starting;
+}
@@ -0,0 +1,72 @@
+#include "core/MetricSchema.h"
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    bool isLabelChar(unsigned char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+            || c == '.' || c == ':' || c == '_' || c == '-';
+    }
+
+    std::string safeLabel(const std::string& label) {
+        std::string safe;
+        safe.reserve(label.size());
+        for (unsigned char c : label) {
+            if (isLabelChar(c)) {
+                safe += static_cast<char>(c);
+            } else if (!safe.empty() && safe.back() != '_') {
+                safe += '_';
+            }
+        }
+        while (!safe.empty() && safe.back() == '_') {
+            safe.pop_back();
+        }
+        return safe.empty() ? "_" : safe;
+    }
+}
+
+std::string MetricSchema::seriesName(MetricId family, const std::string& label) {
+    std::string name = def(family).name;
+    size_t slot = name.find("{}");
+    if (slot != std::string::npos) {
+        name.replace(slot, 2, safeLabel(label));
+    }
+    return name;
+}
+
+std::wstring MetricSchema::format(MetricUnit unit, double value) {
+    switch (unit) {
+    case MetricUnit::Percent:
+        return formatUnit<MetricUnit::Percent>(value);
+    case MetricUnit::Bytes:
+        return formatUnit<MetricUnit::Bytes>(value);
+    case MetricUnit::BytesPerSec:
+        return formatUnit<MetricUnit::BytesPerSec>(value);
+    case MetricUnit::PerSec:
+        return formatUnit<MetricUnit::PerSec>(value);
+    case MetricUnit::Count:
+        return formatUnit<MetricUnit::Count>(value);
+    case MetricUnit::Celsius:
+        return formatUnit<MetricUnit::Celsius>(value);
+    case MetricUnit::Micros:
+        return formatUnit<MetricUnit::Micros>(value);
+    case MetricUnit::Millis:
+        return formatUnit<MetricUnit::Millis>(value);
+    case MetricUnit::Ratio:
+        return formatUnit<MetricUnit::Ratio>(value);
+    default:
+        return formatPlain(value);
+    }
+}
+
+std::wstring MetricSchema::formatFixed(double value, int precision, const wchar_t* suffix) {
+    std::wostringstream oss;
+    oss << std::fixed << std::setprecision(precision) << value << suffix;
+    return oss.str();
+}
+
+std::wstring MetricSchema::formatPlain(double value) {
+    std::wostringstream oss;
+    oss << value;
+    return oss.str();
+}
@@ -0,0 +1,89 @@
+#include "core/MetricTable.h"
+#include <algorithm>
+
+MetricTable::MetricTable()
+    : m_schemaSeries(METRIC_COUNT, -1)
+{
+}
+
+int MetricTable::addSeries(const std::string& name, MetricUnit unit) {
+    auto it = m_index.find(name);
+    if (it != m_index.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(m_values.size());
+    m_values.push_back(0.0);
+    m_names.push_back(name);
+    m_units.push_back(unit);
+    m_index.emplace(name, id);
+
+    // Registered by name: still reachable through its MetricId
+    MetricId metric = MetricSchema::find(name);
+    if (metric != MetricId::Count) {
+        m_schemaSeries[static_cast<int>(metric)] = id;
+        m_units[id] = MetricSchema::def(metric).unit;
+    }
+    return id;
+}
+
+int MetricTable::addSeries(MetricId metric) {
+    const MetricDef& def = MetricSchema::def(metric);
+    if (def.label) {
+        return -1;  // A family needs a label
+    }
+    int& id = m_schemaSeries[static_cast<int>(metric)];
+    if (id < 0) {
+        id = addSeries(def.name, def.unit);
+    }
+    return id;
+}
+
+int MetricTable::addSeries(MetricId family, const std::string& label) {
+    return addSeries(MetricSchema::seriesName(family, label), MetricSchema::def(family).unit);
+}
+
+int MetricTable::findSeries(const std::string& name) const {
+    auto it = m_index.find(name);
+    return it != m_index.end() ? it->second : -1;
+}
+
+void MetricTable::set(int id, double value) {
+    if (id < 0 || id >= static_cast<int>(m_values.size())) {
+        return;
+    }
+    m_values[id] = value;
+}
+
+void MetricTable::setValues(const double* values, int count) {
+    count = std::min(count, static_cast<int>(m_values.size()));
+    if (count > 0) {
+        std::copy(values, values + count, m_values.begin());
+    }
+}
+
+double MetricTable::value(int id) const {
+    if (id < 0 || id >= static_cast<int>(m_values.size())) {
+        return 0.0;
+    }
+    return m_values[id];
+}
+
+const double* MetricTable::values() const {
+    return m_values.data();
+}
+
+int MetricTable::seriesCount() const {
+    return static_cast<int>(m_values.size());
+}
+
+const std::string& MetricTable::seriesName(int id) const {
+    return m_names[id];
+}
+
+MetricUnit MetricTable::seriesUnit(int id) const {
+    if (id < 0 || id >= static_cast<int>(m_units.size())) {
+        return MetricUnit::None;
+    }
+    return m_units[id];
+}
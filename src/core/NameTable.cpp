@@ -0,0 +1,113 @@
+#include "core/NameTable.h"
+#include "utils/SystemUtils.h"
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+    struct Entry {
+        std::wstring wide;
+        std::string utf8;
+    };
+
+    // Keys view the strings of the entries, so a lookup of a known name
+    // builds no string
+    struct Table {
+        std::mutex mutex;
+        std::deque<Entry> entries;
+        std::unordered_map<std::wstring_view, NameId> byWide;
+        std::unordered_map<std::string_view, NameId> byUtf8;
+
+        Table() {
+            entries.push_back(Entry());
+            byWide.emplace(entries[0].wide, NameTable::EMPTY);
+            byUtf8.emplace(entries[0].utf8, NameTable::EMPTY);
+        }
+
+        NameId add(std::wstring wide, std::string utf8) {
+            NameId id = static_cast<NameId>(entries.size());
+            entries.push_back({std::move(wide), std::move(utf8)});
+            const Entry& entry = entries.back();
+
+            // Two spellings can meet in one form (e.g. invalid UTF-8)
+            byWide.emplace(entry.wide, id);
+            byUtf8.emplace(entry.utf8, id);
+            return id;
+        }
+    };
+
+    Table& table() {
+        static Table instance;
+        return instance;
+    }
+}
+
+NameId NameTable::intern(const std::wstring& name) {
+    return intern(name.data(), name.size());
+}
+
+NameId NameTable::intern(const wchar_t* name, size_t length) {
+    Table& names = table();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    auto it = names.byWide.find(std::wstring_view(name, length));
+    if (it != names.byWide.end()) {
+        return it->second;
+    }
+
+    std::wstring wide(name, length);
+    std::string utf8;
+    try {
+        utf8 = SystemUtils::wstringToString(wide);
+    } catch (const std::range_error&) {
+        // Not a valid code point sequence: keep what is ASCII
+        for (wchar_t c : wide) {
+            utf8 += c < 0x80 ? static_cast<char>(c) : '?';
+        }
+    }
+    return names.add(std::move(wide), std::move(utf8));
+}
+
+NameId NameTable::intern(const char* name, size_t length) {
+    Table& names = table();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    auto it = names.byUtf8.find(std::string_view(name, length));
+    if (it != names.byUtf8.end()) {
+        return it->second;
+    }
+
+    std::string utf8(name, length);
+    std::wstring wide;
+    try {
+        wide = SystemUtils::stringToWstring(utf8);
+    } catch (const std::range_error&) {
+        // Not UTF-8 (e.g. an ANSI code page description): read it as Latin-1
+        for (char c : utf8) {
+            wide += static_cast<wchar_t>(static_cast<unsigned char>(c));
+        }
+    }
+    return names.add(std::move(wide), std::move(utf8));
+}
+
+NameId NameTable::intern(const std::string& name) {
+    return intern(name.data(), name.size());
+}
+
+const std::wstring& NameTable::wide(NameId id) {
+    Table& names = table();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    return id < names.entries.size() ? names.entries[id].wide : names.entries[EMPTY].wide;
+}
+
+const std::string& NameTable::utf8(NameId id) {
+    Table& names = table();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    return id < names.entries.size() ? names.entries[id].utf8 : names.entries[EMPTY].utf8;
+}
+
+size_t NameTable::size() {
+    Table& names = table();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    return names.entries.size();
+}
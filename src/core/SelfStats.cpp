@@ -0,0 +1,171 @@
+#include "core/SelfStats.h"
+#include "core/MetricTable.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+namespace {
+    // Collectors initialize on worker threads, so probes may be created
+    // concurrently; the deque keeps their addresses stable
+    struct Registry {
+        std::mutex mutex;
+        std::deque<CollectorStats> probes;
+    };
+
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    // Series IDs of published probes, cached per target table
+    struct PublishedSeries {
+        int calls;
+        int meanMicros;
+        int p99Micros;
+        int syscalls;
+        int bytesRead;
+    };
+    const MetricTable* s_publishedTable = nullptr;
+    std::vector<PublishedSeries> s_publishedSeries;
+}
+
+CollectorStats::CollectorStats(const std::string& name)
+    : m_name(name)
+    , m_calls(0)
+    , m_totalNanos(0)
+    , m_maxNanos(0)
+    , m_syscalls(0)
+    , m_bytesRead(0)
+{
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void CollectorStats::record(uint64_t nanos) {
+    uint64_t micros = nanos / 1000;
+    int bucket = 0;
+    while (micros > 0 && bucket < BUCKET_COUNT - 1) {
+        micros >>= 1;
+        bucket++;
+    }
+
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_calls.fetch_add(1, std::memory_order_relaxed);
+    m_totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+
+    uint64_t longest = m_maxNanos.load(std::memory_order_relaxed);
+    while (nanos > longest && !m_maxNanos.compare_exchange_weak(longest, nanos, std::memory_order_relaxed)) {
+        // A failed exchange reloaded longest; retry while we are still larger
+    }
+}
+
+void CollectorStats::addSyscalls(uint64_t count) {
+    m_syscalls.fetch_add(count, std::memory_order_relaxed);
+}
+
+void CollectorStats::addBytesRead(uint64_t bytes) {
+    m_bytesRead.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+const std::string& CollectorStats::name() const {
+    return m_name;
+}
+
+uint64_t CollectorStats::callCount() const {
+    return m_calls.load(std::memory_order_relaxed);
+}
+
+uint64_t CollectorStats::syscallCount() const {
+    return m_syscalls.load(std::memory_order_relaxed);
+}
+
+uint64_t CollectorStats::bytesRead() const {
+    return m_bytesRead.load(std::memory_order_relaxed);
+}
+
+double CollectorStats::meanMicros() const {
+    uint64_t calls = callCount();
+    if (calls == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(m_totalNanos.load(std::memory_order_relaxed))
+        / static_cast<double>(calls) / 1000.0;
+}
+
+double CollectorStats::maxMicros() const {
+    return static_cast<double>(m_maxNanos.load(std::memory_order_relaxed)) / 1000.0;
+}
+
+double CollectorStats::percentileMicros(double percentile) const {
+    uint64_t calls = callCount();
+    if (calls == 0) {
+        return 0.0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(calls));
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen > rank) {
+            // Upper bound of bucket i, never above the observed maximum
+            double upper = (i == 0) ? 1.0 : static_cast<double>(uint64_t(1) << i);
+            return std::min(upper, maxMicros());
+        }
+    }
+    return maxMicros();
+}
+
+CollectorStats& SelfStats::probe(const std::string& name) {
+    Registry& state = registry();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto& stats : state.probes) {
+        if (stats.name() == name) {
+            return stats;
+        }
+    }
+    state.probes.emplace_back(name);
+    return state.probes.back();
+}
+
+std::vector<const CollectorStats*> SelfStats::probes() {
+    Registry& state = registry();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::vector<const CollectorStats*> result;
+    result.reserve(state.probes.size());
+    for (const auto& stats : state.probes) {
+        result.push_back(&stats);
+    }
+    return result;
+}
+
+void SelfStats::publish(MetricTable& metrics) {
+    const std::vector<const CollectorStats*> probes = SelfStats::probes();
+
+    if (s_publishedTable != &metrics) {
+        s_publishedTable = &metrics;
+        s_publishedSeries.clear();
+    }
+
+    // Register series for probes created since the last publish
+    while (s_publishedSeries.size() < probes.size()) {
+        const std::string& probe = probes[s_publishedSeries.size()]->name();
+        PublishedSeries series;
+        series.calls = metrics.addSeries(MetricId::SelfCalls, probe);
+        series.meanMicros = metrics.addSeries(MetricId::SelfMean, probe);
+        series.p99Micros = metrics.addSeries(MetricId::SelfP99, probe);
+        series.syscalls = metrics.addSeries(MetricId::SelfSyscalls, probe);
+        series.bytesRead = metrics.addSeries(MetricId::SelfBytesRead, probe);
+        s_publishedSeries.push_back(series);
+    }
+
+    for (size_t i = 0; i < probes.size(); i++) {
+        const CollectorStats& stats = *probes[i];
+        const PublishedSeries& series = s_publishedSeries[i];
+        metrics.set(series.calls, static_cast<double>(stats.callCount()));
+        metrics.set(series.meanMicros, stats.meanMicros());
+        metrics.set(series.p99Micros, stats.percentileMicros(99.0));
+        metrics.set(series.syscalls, static_cast<double>(stats.syscallCount()));
+        metrics.set(series.bytesRead, static_cast<double>(stats.bytesRead()));
+    }
+}
@@ -0,0 +1,78 @@
+#include "core/TickClock.h"
+#include "utils/SystemUtils.h"
+
+TickClock::TickClock(uint64_t periodUs)
+    : m_periodUs(periodUs > 0 ? periodUs : 1)
+    , m_firstUs(0)
+    , m_lateCount(0)
+    , m_missedCount(0)
+    , m_periodChanged(false)
+    , m_tick{0, 0, 0, 0, 0, false}
+{
+}
+
+const Tick& TickClock::begin() {
+    return begin(SystemUtils::monotonicMicros());
+}
+
+const Tick& TickClock::begin(uint64_t nowUs) {
+    uint64_t previous = m_tick.timestampUs;
+    if (m_firstUs == 0) {
+        m_firstUs = nowUs;
+        previous = nowUs;
+    } else if (nowUs < previous) {
+        nowUs = previous;   // Clock must not go backwards
+    }
+
+    m_tick.sequence++;
+    m_tick.timestampUs = nowUs;
+    m_tick.intervalUs = nowUs - previous;
+    m_tick.late = !m_periodChanged && m_tick.intervalUs * 100 > m_periodUs * (100 + LATE_PERCENT);
+    m_periodChanged = false;
+    m_tick.missed = 0;
+    m_tick.spanUs = 0;
+    if (m_tick.late) {
+        // Round to whole periods: 2.4 periods = one tick skipped
+        uint64_t periods = (m_tick.intervalUs + m_periodUs / 2) / m_periodUs;
+        m_tick.missed = periods > 1 ? periods - 1 : 0;
+        m_lateCount++;
+        m_missedCount += m_tick.missed;
+    }
+    return m_tick;
+}
+
+void TickClock::end() {
+    end(SystemUtils::monotonicMicros());
+}
+
+void TickClock::end(uint64_t nowUs) {
+    m_tick.spanUs = nowUs > m_tick.timestampUs ? nowUs - m_tick.timestampUs : 0;
+}
+
+const Tick& TickClock::current() const {
+    return m_tick;
+}
+
+double TickClock::elapsedSeconds() const {
+    return m_firstUs == 0 ? 0.0 : static_cast<double>(m_tick.timestampUs - m_firstUs) / 1e6;
+}
+
+uint64_t TickClock::lateCount() const {
+    return m_lateCount;
+}
+
+uint64_t TickClock::missedCount() const {
+    return m_missedCount;
+}
+
+void TickClock::setPeriod(uint64_t periodUs) {
+    periodUs = periodUs > 0 ? periodUs : 1;
+    if (periodUs != m_periodUs) {
+        m_periodUs = periodUs;
+        m_periodChanged = true;
+    }
+}
+
+uint64_t TickClock::period() const {
+    return m_periodUs;
+}
@@ -1,14 +1,33 @@
 #include "ui/MainWindow.h"
+#include "monitors/BurstSampler.h"
+#include "utils/SystemUtils.h"
 #include <QApplication>
+#include <QCommandLineParser>
 
 int main(int argc, char *argv[]) {
+    // Startup times are measured from here
+    uint64_t startUs = SystemUtils::monotonicMicros();
     QApplication app(argc, argv);
     
     app.setApplicationName("System Monitor");
     app.setOrganizationName("KmaNghia18");
     app.setApplicationVersion("1.0.0");
     
-    MainWindow window;
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption fixturesOption("fixtures",
+        "Replay monitor data from fixture files in <dir> instead of the OS.", "dir");
+    parser.addOption(fixturesOption);
+    QCommandLineOption alertLogOption("alert-log",
+        "Append raised and cleared alerts as text lines to <file>.", "file");
+    parser.addOption(alertLogOption);
+    parser.process(app);
+    
+    // Ctrl+Break (SIGUSR1 elsewhere) starts a burst capture
+    BurstSampler::installSignalTrigger();
+    
+    MainWindow window(nullptr, parser.value(fixturesOption), parser.value(alertLogOption), startUs);
     window.show();
     
     return app.exec();
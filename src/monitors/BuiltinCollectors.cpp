@@ -0,0 +1,49 @@
+#include "monitors/BuiltinCollectors.h"
+#include "monitors/CPUMonitor.h"
+#include "monitors/RAMMonitor.h"
+#include "monitors/DiskMonitor.h"
+#include "monitors/NetworkMonitor.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/NumaMonitor.h"
+#include "monitors/PerfMonitor.h"
+#include "monitors/SchedMonitor.h"
+#include "monitors/NetStackMonitor.h"
+#include "monitors/ConnectionMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "monitors/FixtureDataSources.h"
+#include "core/CollectorRegistry.h"
+
+namespace {
+    /**
+     * @brief Factory of a monitor with one data source
+     */
+    template<typename Monitor, typename FixtureSource>
+    CollectorFactory monitorFactory() {
+        return [](const CollectorContext& context) -> std::unique_ptr<Collector> {
+            if (context.fixtureRoot.empty()) {
+                return std::make_unique<Monitor>();
+            }
+            return std::make_unique<Monitor>(std::make_unique<FixtureSource>(context.fixtureRoot));
+        };
+    }
+}
+
+void registerBuiltinCollectors(CollectorRegistry& registry) {
+    registry.add("cpu", [](const CollectorContext& context) -> std::unique_ptr<Collector> {
+        if (context.fixtureRoot.empty()) {
+            return std::make_unique<CPUMonitor>();
+        }
+        return std::make_unique<CPUMonitor>(std::make_unique<FixtureCPUDataSource>(context.fixtureRoot),
+                                            std::make_unique<FixtureThermalDataSource>(context.fixtureRoot));
+    });
+    registry.add("ram", monitorFactory<RAMMonitor, FixtureMemoryDataSource>());
+    registry.add("disk", monitorFactory<DiskMonitor, FixtureDiskDataSource>());
+    registry.add("network", monitorFactory<NetworkMonitor, FixtureNetworkDataSource>());
+    registry.add("interrupts", monitorFactory<InterruptMonitor, FixtureInterruptDataSource>());
+    registry.add("numa", monitorFactory<NumaMonitor, FixtureTopologyDataSource>());
+    registry.add("perf", monitorFactory<PerfMonitor, FixturePerfDataSource>());
+    registry.add("sched", monitorFactory<SchedMonitor, FixtureSchedDataSource>());
+    registry.add("netstack", monitorFactory<NetStackMonitor, FixtureNetStackDataSource>());
+    registry.add("connections", monitorFactory<ConnectionMonitor, FixtureConnectionDataSource>());
+    registry.add("processes", monitorFactory<ProcessMonitor, FixtureProcessDataSource>());
+}
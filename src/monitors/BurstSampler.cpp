@@ -0,0 +1,336 @@
+#include "monitors/BurstSampler.h"
+#include "monitors/DataSources.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace {
+    volatile std::sig_atomic_t s_signalRequested = 0;
+
+    void onBurstSignal(int signal) {
+        s_signalRequested = 1;
+        // Some platforms reset the handler after delivery
+        std::signal(signal, onBurstSignal);
+    }
+
+    uint64_t nanosSince(std::chrono::steady_clock::time_point start) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BurstRecording
+// ---------------------------------------------------------------------------
+
+size_t BurstRecording::sampleCount() const {
+    return timeMs.size();
+}
+
+double BurstRecording::costPercentileMicros(double percentile) const {
+    if (costMicros.empty()) {
+        return 0.0;
+    }
+
+    std::vector<double> sorted(costMicros);
+    size_t rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1));
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return sorted[rank];
+}
+
+bool BurstRecording::save(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+
+    double meanCost = 0.0;
+    for (double cost : costMicros) {
+        meanCost += cost;
+    }
+    meanCost = costMicros.empty() ? 0.0 : meanCost / static_cast<double>(costMicros.size());
+
+    out << "# burst interval_ms=" << intervalMs << " window_ms=" << windowMs
+        << " samples=" << sampleCount() << " dropped=" << droppedCount << "\n";
+    out << "# cost_us mean=" << meanCost << " p99=" << costPercentileMicros(99.0)
+        << " max=" << costPercentileMicros(100.0) << "\n";
+
+    out << "time_ms,cpu_total,net_download_bps,net_upload_bps,disk_read_bps,disk_write_bps,cost_us";
+    for (int core = 0; core < coreCount; core++) {
+        out << ",cpu_core_" << core;
+    }
+    out << "\n";
+
+    for (size_t i = 0; i < sampleCount(); i++) {
+        out << timeMs[i] << ',' << cpuTotal[i] << ',' << netDownloadBps[i] << ','
+            << netUploadBps[i] << ',' << diskReadBps[i] << ',' << diskWriteBps[i] << ','
+            << costMicros[i];
+        for (int core = 0; core < coreCount; core++) {
+            out << ',' << coreUsages[i * coreCount + core];
+        }
+        out << "\n";
+    }
+
+    return static_cast<bool>(out);
+}
+
+// ---------------------------------------------------------------------------
+// BurstSampler
+// ---------------------------------------------------------------------------
+
+BurstSampler::BurstSampler(std::unique_ptr<CPUDataSource> cpuSource,
+                           std::unique_ptr<NetworkDataSource> networkSource,
+                           std::unique_ptr<DiskDataSource> diskSource)
+    : m_cpuSource(std::move(cpuSource))
+    , m_networkSource(std::move(networkSource))
+    , m_diskSource(std::move(diskSource))
+    , m_opened(false)
+    , m_config{1, 1000}
+    , m_running(false)
+    , m_stopRequested(false)
+    , m_stats(&SelfStats::probe("burst.sample"))
+    , m_baselineReceived(0)
+    , m_baselineSent(0)
+{
+}
+
+BurstSampler::~BurstSampler() {
+    stop();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool BurstSampler::start(const BurstConfig& config) {
+    if (m_running.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (!open()) {
+        return false;
+    }
+
+    m_config.intervalMs = SystemUtils::clamp(config.intervalMs, 1, 10);
+    m_config.windowMs = SystemUtils::clamp(config.windowMs, 100, 60000);
+
+    // Everything the capture thread touches is sized here
+    m_ring.reset(static_cast<size_t>(m_config.windowMs / m_config.intervalMs) + 1,
+                 m_previousTimes.coreCount());
+
+    // Baselines, so the first sample covers one interval
+    m_cpuSource->sample(m_previousTimes);
+    m_baselineReceived = 0;
+    m_baselineSent = 0;
+    uint64_t timestampUs = 0;
+    if (m_networkSource && m_networkSource->sample(m_interfaces, timestampUs)) {
+        for (const auto& iface : m_interfaces) {
+            if (iface.isActive) {
+                m_baselineReceived += iface.bytesReceived;
+                m_baselineSent += iface.bytesSent;
+            }
+        }
+    }
+
+    m_stopRequested.store(false, std::memory_order_relaxed);
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&BurstSampler::run, this);
+    return true;
+}
+
+void BurstSampler::stop() {
+    m_stopRequested.store(true, std::memory_order_relaxed);
+}
+
+bool BurstSampler::isRunning() const {
+    return m_running.load(std::memory_order_acquire);
+}
+
+bool BurstSampler::takeRecording(BurstRecording& recording) {
+    if (m_running.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_ring.size() == 0) {
+        return false;
+    }
+
+    const int coreCount = m_ring.coreCount();
+    const size_t count = m_ring.size();
+
+    recording.intervalMs = m_config.intervalMs;
+    recording.windowMs = m_config.windowMs;
+    recording.coreCount = coreCount;
+    recording.droppedCount = m_ring.droppedCount();
+    recording.timeMs.clear();
+    recording.cpuTotal.clear();
+    recording.coreUsages.assign(count * coreCount, 0.0);
+    recording.netDownloadBps.clear();
+    recording.netUploadBps.clear();
+    recording.diskReadBps.clear();
+    recording.diskWriteBps.clear();
+    recording.costMicros.clear();
+
+    uint64_t previousTimeNs = 0;
+    uint64_t previousReceived = m_baselineReceived;
+    uint64_t previousSent = m_baselineSent;
+
+    BurstSample sample;
+    size_t index = 0;
+    while (index < count && m_ring.pop(sample, recording.coreUsages.data() + index * coreCount)) {
+        double elapsedSec = static_cast<double>(sample.timeNs - previousTimeNs) / 1e9;
+
+        recording.timeMs.push_back(static_cast<double>(sample.timeNs) / 1e6);
+        recording.cpuTotal.push_back(sample.cpuTotal);
+        recording.netDownloadBps.push_back(
+            SystemUtils::calculateRate(sample.bytesReceived, previousReceived, elapsedSec));
+        recording.netUploadBps.push_back(
+            SystemUtils::calculateRate(sample.bytesSent, previousSent, elapsedSec));
+        recording.diskReadBps.push_back(sample.diskReadBps);
+        recording.diskWriteBps.push_back(sample.diskWriteBps);
+        recording.costMicros.push_back(static_cast<double>(sample.costNs) / 1000.0);
+
+        previousTimeNs = sample.timeNs;
+        previousReceived = sample.bytesReceived;
+        previousSent = sample.bytesSent;
+        index++;
+    }
+
+    recording.coreUsages.resize(index * coreCount);
+    return index > 0;
+}
+
+void BurstSampler::sampleOnce(uint64_t timeNs) {
+    auto begin = std::chrono::steady_clock::now();
+
+    BurstSample sample = {};
+    sample.timeNs = timeNs;
+
+    if (m_cpuSource->sample(m_currentTimes)) {
+        CPUMonitor::computeBreakdown(m_previousTimes, m_currentTimes, m_breakdown);
+        std::swap(m_previousTimes, m_currentTimes);
+    }
+    sample.cpuTotal = m_breakdown.totalBusy;
+
+    uint64_t timestampUs = 0;
+    if (m_networkSource && m_networkSource->sample(m_interfaces, timestampUs)) {
+        for (const auto& iface : m_interfaces) {
+            if (iface.isActive) {
+                sample.bytesReceived += iface.bytesReceived;
+                sample.bytesSent += iface.bytesSent;
+            }
+        }
+    }
+
+    if (m_diskSource && !m_disks.empty()) {
+        m_diskSource->sampleSpeeds(m_disks);
+        for (const auto& disk : m_disks) {
+            sample.diskReadBps += disk.readSpeed;
+            sample.diskWriteBps += disk.writeSpeed;
+        }
+    }
+
+    sample.costNs = nanosSince(begin);
+    m_stats->record(sample.costNs);
+    m_ring.push(sample, m_breakdown.busy.data());
+}
+
+void BurstSampler::installSignalTrigger() {
+#if defined(SIGBREAK)
+    std::signal(SIGBREAK, onBurstSignal);
+#elif defined(SIGUSR1)
+    std::signal(SIGUSR1, onBurstSignal);
+#endif
+}
+
+bool BurstSampler::takeSignalRequest() {
+    if (!s_signalRequested) {
+        return false;
+    }
+    s_signalRequested = 0;
+    return true;
+}
+
+bool BurstSampler::open() {
+    if (m_opened) {
+        return true;
+    }
+
+    int coreCount = 0;
+    if (!m_cpuSource || !m_cpuSource->open(coreCount)) {
+        return false;
+    }
+
+    m_previousTimes.resize(coreCount);
+    m_currentTimes.resize(coreCount);
+    m_breakdown.resize(coreCount);
+
+    if (m_diskSource && !m_diskSource->enumerate(m_disks)) {
+        m_disks.clear();
+    }
+
+    m_opened = true;
+    return true;
+}
+
+void BurstSampler::run() {
+#ifdef _WIN32
+    // Default timer resolution is ~15.6 ms, too coarse for 1 ms sleeps
+    timeBeginPeriod(1);
+#endif
+
+    const auto interval = std::chrono::milliseconds(m_config.intervalMs);
+    const auto start = std::chrono::steady_clock::now();
+    const auto end = start + std::chrono::milliseconds(m_config.windowMs);
+    auto next = start;
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        next += interval;
+        if (next > end) {
+            break;
+        }
+        std::this_thread::sleep_until(next);
+
+        // Skip missed ticks instead of sampling back-to-back to catch up
+        auto now = std::chrono::steady_clock::now();
+        if (now - next > interval) {
+            next = now;
+        }
+
+        sampleOnce(nanosSince(start));
+    }
+
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+
+    m_running.store(false, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// BurstAlertSink
+// ---------------------------------------------------------------------------
+
+BurstAlertSink::BurstAlertSink(BurstSampler *sampler, const BurstConfig& config)
+    : m_sampler(sampler)
+    , m_config(config)
+{
+}
+
+void BurstAlertSink::onAlert(const AlertEvent& event) {
+    if (event.raised && event.burst && m_sampler) {
+        m_sampler->start(m_config);
+    }
+}
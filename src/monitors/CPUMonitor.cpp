@@ -1,32 +1,151 @@
 #include "monitors/CPUMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include <algorithm>
 #include <iostream>
 
-#pragma comment(lib, "pdh.lib")
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPU_USE_SSE2 1
+#endif
+
+namespace {
+    /**
+     * @brief delta[i] = current[i] - previous[i] as double (0 if the counter
+     *        went backwards), added into elapsed[i] unless elapsed is nullptr
+     * @return Sum of the deltas
+     *
+     * Deltas below 2^52 are converted exactly by OR-ing them into the
+     * mantissa of 2^52 (SSE2 has no 64-bit integer to double conversion).
+     */
+    double counterDeltas(const uint64_t* previous, const uint64_t* current,
+                         double* delta, double* elapsed, int count) {
+        double total = 0.0;
+        int i = 0;
+
+#ifdef CPU_USE_SSE2
+        const __m128i vExponent = _mm_set1_epi64x(0x4330000000000000LL);
+        const __m128d vTwo52 = _mm_set1_pd(4503599627370496.0);
+        __m128d vTotal = _mm_setzero_pd();
+
+        for (; i + 2 <= count; i += 2) {
+            __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + i));
+            __m128i curr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i));
+            __m128i diff = _mm_sub_epi64(curr, prev);
+
+            // Broadcast each lane's sign bit over the whole lane and drop negatives
+            __m128i negative = _mm_shuffle_epi32(_mm_srai_epi32(diff, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            diff = _mm_andnot_si128(negative, diff);
+
+            __m128d value = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(diff, vExponent)), vTwo52);
+            _mm_storeu_pd(delta + i, value);
+            vTotal = _mm_add_pd(vTotal, value);
+            if (elapsed) {
+                _mm_storeu_pd(elapsed + i, _mm_add_pd(_mm_loadu_pd(elapsed + i), value));
+            }
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, vTotal);
+        total = lanes[0] + lanes[1];
+#endif
+
+        for (; i < count; i++) {
+            delta[i] = current[i] >= previous[i] ? static_cast<double>(current[i] - previous[i]) : 0.0;
+            total += delta[i];
+            if (elapsed) {
+                elapsed[i] += delta[i];
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief values[i] *= scale[i]
+     */
+    void scaleInPlace(double* values, const double* scale, int count) {
+        int i = 0;
+
+#ifdef CPU_USE_SSE2
+        for (; i + 2 <= count; i += 2) {
+            _mm_storeu_pd(values + i, _mm_mul_pd(_mm_loadu_pd(values + i), _mm_loadu_pd(scale + i)));
+        }
+#endif
+
+        for (; i < count; i++) {
+            values[i] *= scale[i];
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// CPUTimes / CPUBreakdown
+// ---------------------------------------------------------------------------
+
+void CPUTimes::resize(int coreCount) {
+    for (auto& column : columns) {
+        column.assign(coreCount, 0);
+    }
+}
+
+int CPUTimes::coreCount() const {
+    return static_cast<int>(columns[0].size());
+}
+
+const char* CPUTimes::columnName(Column column) {
+    static const char* const NAMES[ColumnCount] = {
+        "user", "nice", "system", "idle", "iowait", "irq", "softirq", "steal", "guest"
+    };
+    if (column < 0 || column >= ColumnCount) {
+        return "";
+    }
+    return NAMES[column];
+}
+
+void CPUBreakdown::resize(int coreCount) {
+    for (auto& column : percent) {
+        column.assign(coreCount, 0.0);
+    }
+    busy.assign(coreCount, 0.0);
+    elapsed.assign(coreCount, 0.0);
+    for (double& total : totalPercent) {
+        total = 0.0;
+    }
+    totalBusy = 0.0;
+}
+
+void CPUThermals::resize(int coreCount) {
+    currentMhz.assign(coreCount, 0.0);
+    maxMhz.assign(coreCount, 0.0);
+    limitMhz.assign(coreCount, 0.0);
+    throttleCount.assign(coreCount, 0);
+}
+
+// ---------------------------------------------------------------------------
+// CPUMonitor
+// ---------------------------------------------------------------------------
 
 CPUMonitor::CPUMonitor()
-    : m_query(nullptr)
-    , m_totalCounter(nullptr)
-    , m_totalUsage(0.0)
+    : CPUMonitor(createDefaultCPUDataSource(), createDefaultThermalDataSource())
+{
+}
+
+CPUMonitor::CPUMonitor(std::unique_ptr<CPUDataSource> source)
+    : CPUMonitor(std::move(source), nullptr)
+{
+}
+
+CPUMonitor::CPUMonitor(std::unique_ptr<CPUDataSource> source, std::unique_ptr<ThermalDataSource> thermalSource)
+    : m_source(std::move(source))
+    , m_thermalSource(std::move(thermalSource))
+    , m_hasThermals(false)
     , m_coreCount(0)
     , m_initialized(false)
 {
 }
 
 CPUMonitor::~CPUMonitor() {
-    // Clean up PDH resources
-    if (m_totalCounter) {
-        PdhRemoveCounter(m_totalCounter);
-    }
-    
-    for (auto& counter : m_coreCounters) {
-        if (counter) {
-            PdhRemoveCounter(counter);
-        }
-    }
-    
-    if (m_query) {
-        PdhCloseQuery(m_query);
-    }
 }
 
 bool CPUMonitor::initialize() {
@@ -34,46 +153,30 @@ bool CPUMonitor::initialize() {
         return true;
     }
 
-    // Get number of processors
-    SYSTEM_INFO sysInfo;
-    GetSystemInfo(&sysInfo);
-    m_coreCount = sysInfo.dwNumberOfProcessors;
-
-    // Create PDH query
-    PDH_STATUS status = PdhOpenQuery(nullptr, 0, &m_query);
-    if (status != ERROR_SUCCESS) {
-        std::cerr << "Failed to open PDH query. Error: " << status << std::endl;
+    if (!m_source) {
+        std::cerr << "No CPU data source available" << std::endl;
         return false;
     }
 
-    // Add total CPU usage counter
-    status = PdhAddCounter(m_query, L"\\Processor(_Total)\\% Processor Time", 0, &m_totalCounter);
-    if (status != ERROR_SUCCESS) {
-        std::cerr << "Failed to add total CPU counter. Error: " << status << std::endl;
-        PdhCloseQuery(m_query);
-        m_query = nullptr;
+    if (!m_source->open(m_coreCount)) {
         return false;
     }
 
-    // Add per-core counters
-    m_coreCounters.resize(m_coreCount);
-    m_coreUsages.resize(m_coreCount, 0.0);
+    m_previousTimes.resize(m_coreCount);
+    m_currentTimes.resize(m_coreCount);
+    m_breakdown.resize(m_coreCount);
 
-    for (int i = 0; i < m_coreCount; i++) {
-        std::wstring counterPath = L"\\Processor(" + std::to_wstring(i) + L")\\% Processor Time";
-        status = PdhAddCounter(m_query, counterPath.c_str(), 0, &m_coreCounters[i]);
-        
-        if (status != ERROR_SUCCESS) {
-            std::cerr << "Failed to add CPU core " << i << " counter. Error: " << status << std::endl;
-            // Continue even if one core fails
-        }
-    }
+    // Baseline sample: the first update() reports usage since now
+    m_source->sample(m_previousTimes);
 
-    // Collect initial sample (required for percentage calculation)
-    status = PdhCollectQueryData(m_query);
-    if (status != ERROR_SUCCESS) {
-        std::cerr << "Failed to collect initial PDH data. Error: " << status << std::endl;
-        return false;
+    // Frequencies and temperatures are optional
+    m_thermals.resize(m_coreCount);
+    m_previousThrottleCount.assign(m_coreCount, 0);
+    m_throttleEvents.assign(m_coreCount, 0);
+    m_hasThermals = m_thermalSource && m_thermalSource->open(m_coreCount);
+    if (m_hasThermals) {
+        m_thermalSource->sample(m_thermals);
+        m_previousThrottleCount = m_thermals.throttleCount;
     }
 
     m_initialized = true;
@@ -85,18 +188,122 @@ void CPUMonitor::update() {
         return;
     }
 
+    static CollectorStats& stats = SelfStats::probe("cpu.update");
+    ScopedTimer timer(stats);
+
     collectData();
 }
 
 double CPUMonitor::getTotalUsage() const {
-    return m_totalUsage;
+    return m_breakdown.totalBusy;
 }
 
 double CPUMonitor::getCoreUsage(int coreIndex) const {
     if (coreIndex < 0 || coreIndex >= m_coreCount) {
         return 0.0;
     }
-    return m_coreUsages[coreIndex];
+    return m_breakdown.busy[coreIndex];
+}
+
+const std::vector<double>& CPUMonitor::getCoreUsages() const {
+    return m_breakdown.busy;
+}
+
+double CPUMonitor::getCoreBreakdown(int coreIndex, CPUTimes::Column column) const {
+    if (coreIndex < 0 || coreIndex >= m_coreCount || column < 0 || column >= CPUTimes::ColumnCount) {
+        return 0.0;
+    }
+    return m_breakdown.percent[column][coreIndex];
+}
+
+double CPUMonitor::getTotalBreakdown(CPUTimes::Column column) const {
+    if (column < 0 || column >= CPUTimes::ColumnCount) {
+        return 0.0;
+    }
+    return m_breakdown.totalPercent[column];
+}
+
+const CPUBreakdown& CPUMonitor::getBreakdown() const {
+    return m_breakdown;
+}
+
+bool CPUMonitor::hasThermalData() const {
+    return m_hasThermals;
+}
+
+double CPUMonitor::getCoreFrequency(int coreIndex) const {
+    if (coreIndex < 0 || coreIndex >= m_coreCount) {
+        return 0.0;
+    }
+    return m_thermals.currentMhz[coreIndex];
+}
+
+double CPUMonitor::getCoreMaxFrequency(int coreIndex) const {
+    if (coreIndex < 0 || coreIndex >= m_coreCount) {
+        return 0.0;
+    }
+    return m_thermals.maxMhz[coreIndex];
+}
+
+double CPUMonitor::getAverageFrequencyPercent() const {
+    double current = 0.0;
+    double max = 0.0;
+    for (int i = 0; i < m_coreCount; i++) {
+        current += m_thermals.currentMhz[i];
+        max += m_thermals.maxMhz[i];
+    }
+    return max > 0.0 ? current / max * 100.0 : 0.0;
+}
+
+bool CPUMonitor::isCoreThrottled(int coreIndex) const {
+    if (coreIndex < 0 || coreIndex >= m_coreCount) {
+        return false;
+    }
+    double limit = m_thermals.limitMhz[coreIndex];
+    bool capped = limit > 0.0 && limit < m_thermals.maxMhz[coreIndex];
+    return capped || m_throttleEvents[coreIndex] > 0;
+}
+
+int CPUMonitor::getThrottledCoreCount() const {
+    int count = 0;
+    for (int i = 0; i < m_coreCount; i++) {
+        if (isCoreThrottled(i)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint64_t CPUMonitor::getCoreThrottleEvents(int coreIndex) const {
+    if (coreIndex < 0 || coreIndex >= m_coreCount) {
+        return 0;
+    }
+    return m_throttleEvents[coreIndex];
+}
+
+int CPUMonitor::getSensorCount() const {
+    return static_cast<int>(m_thermals.sensorCelsius.size());
+}
+
+std::string CPUMonitor::getSensorName(int sensor) const {
+    if (sensor < 0 || sensor >= static_cast<int>(m_thermals.sensorNames.size())) {
+        return std::string();
+    }
+    return m_thermals.sensorNames[sensor];
+}
+
+double CPUMonitor::getSensorTemperature(int sensor) const {
+    if (sensor < 0 || sensor >= getSensorCount()) {
+        return 0.0;
+    }
+    return m_thermals.sensorCelsius[sensor];
+}
+
+double CPUMonitor::getMaxTemperature() const {
+    if (m_thermals.sensorCelsius.empty()) {
+        return 0.0;
+    }
+    return *std::max_element(m_thermals.sensorCelsius.begin(), m_thermals.sensorCelsius.end());
 }
 
 int CPUMonitor::getCoreCount() const {
@@ -107,34 +314,125 @@ bool CPUMonitor::isInitialized() const {
     return m_initialized;
 }
 
+const char* CPUMonitor::name() const {
+    return "cpu";
+}
+
+void CPUMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::CpuTotal);
+    metrics.addSeries(MetricId::CpuFrequency);
+    metrics.addSeries(MetricId::CpuThrottled);
+    metrics.addSeries(MetricId::CpuTemperature);
+
+    m_coreSeries.clear();
+    for (int i = 0; i < m_coreCount; i++) {
+        m_coreSeries.push_back(metrics.addSeries(MetricId::CpuCore, std::to_string(i)));
+    }
+
+    m_breakdownSeries.clear();
+    for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+        std::string column = CPUTimes::columnName(static_cast<CPUTimes::Column>(c));
+        m_breakdownSeries.push_back(metrics.addSeries(MetricId::CpuColumn, column));
+    }
+}
+
+void CPUMonitor::publish(MetricTable& metrics) {
+    metrics.set(MetricId::CpuTotal, getTotalUsage());
+    if (hasThermalData()) {
+        metrics.set(MetricId::CpuFrequency, getAverageFrequencyPercent());
+        metrics.set(MetricId::CpuThrottled, getThrottledCoreCount());
+        metrics.set(MetricId::CpuTemperature, getMaxTemperature());
+    }
+    for (size_t i = 0; i < m_coreSeries.size(); i++) {
+        metrics.set(m_coreSeries[i], getCoreUsage(static_cast<int>(i)));
+    }
+    for (size_t c = 0; c < m_breakdownSeries.size(); c++) {
+        metrics.set(m_breakdownSeries[c], getTotalBreakdown(static_cast<CPUTimes::Column>(c)));
+    }
+}
+
+void CPUMonitor::computeBreakdown(const CPUTimes& previous, const CPUTimes& current, CPUBreakdown& result) {
+    const int count = current.coreCount();
+    if (previous.coreCount() != count) {
+        result.resize(count);
+        return;
+    }
+    if (static_cast<int>(result.busy.size()) != count) {
+        result.resize(count);
+    }
+
+    double* elapsed = result.elapsed.data();
+    double* busy = result.busy.data();
+    double totalDelta[CPUTimes::ColumnCount];
+
+    // Pass 1: raw deltas per column, and the elapsed time of every core
+    std::fill(result.elapsed.begin(), result.elapsed.end(), 0.0);
+    double totalElapsed = 0.0;
+    for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+        bool counted = (c != CPUTimes::Guest);
+        totalDelta[c] = counterDeltas(previous.columns[c].data(), current.columns[c].data(),
+                                      result.percent[c].data(), counted ? elapsed : nullptr, count);
+        if (counted) {
+            totalElapsed += totalDelta[c];
+        }
+    }
+
+    // Pass 2: scale[i] = 100 / elapsed[i] (0 for zero-length intervals),
+    // kept in busy[] until the busy figures are written
+    for (int i = 0; i < count; i++) {
+        busy[i] = elapsed[i] > 0.0 ? 100.0 / elapsed[i] : 0.0;
+    }
+    for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+        scaleInPlace(result.percent[c].data(), busy, count);
+    }
+
+    const double* idle = result.percent[CPUTimes::Idle].data();
+    const double* ioWait = result.percent[CPUTimes::IOWait].data();
+    for (int i = 0; i < count; i++) {
+        double value = elapsed[i] > 0.0 ? 100.0 - idle[i] - ioWait[i] : 0.0;
+        busy[i] = value < 0.0 ? 0.0 : (value > 100.0 ? 100.0 : value);
+    }
+
+    // Totals across all cores
+    double totalScale = totalElapsed > 0.0 ? 100.0 / totalElapsed : 0.0;
+    for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+        result.totalPercent[c] = totalDelta[c] * totalScale;
+    }
+
+    double totalBusy = totalElapsed > 0.0
+        ? 100.0 - result.totalPercent[CPUTimes::Idle] - result.totalPercent[CPUTimes::IOWait]
+        : 0.0;
+    result.totalBusy = totalBusy < 0.0 ? 0.0 : (totalBusy > 100.0 ? 100.0 : totalBusy);
+}
+
 void CPUMonitor::collectData() {
-    // Collect query data
-    PDH_STATUS status = PdhCollectQueryData(m_query);
-    if (status != ERROR_SUCCESS) {
-        std::cerr << "Failed to collect PDH data. Error: " << status << std::endl;
+    static CollectorStats& stats = SelfStats::probe("cpu.collect_data");
+    ScopedTimer timer(stats);
+
+    if (!m_source->sample(m_currentTimes)) {
         return;
     }
 
-    // Get total CPU usage
-    PDH_FMT_COUNTERVALUE counterValue;
-    status = PdhGetFormattedCounterValue(m_totalCounter, PDH_FMT_DOUBLE, nullptr, &counterValue);
-    if (status == ERROR_SUCCESS) {
-        m_totalUsage = counterValue.doubleValue;
-        // Clamp to valid range
-        if (m_totalUsage < 0.0) m_totalUsage = 0.0;
-        if (m_totalUsage > 100.0) m_totalUsage = 100.0;
+    computeBreakdown(m_previousTimes, m_currentTimes, m_breakdown);
+    std::swap(m_previousTimes, m_currentTimes);
+
+    if (m_hasThermals) {
+        collectThermals();
+    }
+}
+
+void CPUMonitor::collectThermals() {
+    static CollectorStats& stats = SelfStats::probe("cpu.collect_thermals");
+    ScopedTimer timer(stats);
+
+    if (!m_thermalSource->sample(m_thermals)) {
+        return;
     }
 
-    // Get per-core CPU usage
     for (int i = 0; i < m_coreCount; i++) {
-        if (m_coreCounters[i]) {
-            status = PdhGetFormattedCounterValue(m_coreCounters[i], PDH_FMT_DOUBLE, nullptr, &counterValue);
-            if (status == ERROR_SUCCESS) {
-                m_coreUsages[i] = counterValue.doubleValue;
-                // Clamp to valid range
-                if (m_coreUsages[i] < 0.0) m_coreUsages[i] = 0.0;
-                if (m_coreUsages[i] > 100.0) m_coreUsages[i] = 100.0;
-            }
-        }
+        uint64_t current = m_thermals.throttleCount[i];
+        uint64_t previous = m_previousThrottleCount[i];
+        m_throttleEvents[i] = current >= previous ? current - previous : 0;
+        m_previousThrottleCount[i] = current;
     }
 }
@@ -0,0 +1,229 @@
+#include "monitors/ConnectionMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+// ---------------------------------------------------------------------------
+// ConnectionTable
+// ---------------------------------------------------------------------------
+
+void ConnectionTable::clear() {
+    ids.clear();
+    pids.clear();
+    local.clear();
+    remote.clear();
+    bytesReceived.clear();
+    bytesAcked.clear();
+}
+
+size_t ConnectionTable::size() const {
+    return ids.size();
+}
+
+void ConnectionTable::add(uint64_t id, uint32_t pid, const ConnectionEndpoint& localEndpoint,
+                          const ConnectionEndpoint& remoteEndpoint, uint64_t received, uint64_t acked) {
+    ids.push_back(id);
+    pids.push_back(pid);
+    local.push_back(localEndpoint);
+    remote.push_back(remoteEndpoint);
+    bytesReceived.push_back(received);
+    bytesAcked.push_back(acked);
+}
+
+// ---------------------------------------------------------------------------
+// ConnectionMonitor
+// ---------------------------------------------------------------------------
+
+ConnectionMonitor::ConnectionMonitor()
+    : ConnectionMonitor(createDefaultConnectionDataSource())
+{
+}
+
+ConnectionMonitor::ConnectionMonitor(std::unique_ptr<ConnectionDataSource> source)
+    : m_source(std::move(source))
+    , m_totalReceiveRate(0.0)
+    , m_totalSendRate(0.0)
+    , m_previousTime(0)
+    , m_connectionCount(0)
+    , m_topCount(DEFAULT_TOP_COUNT)
+    , m_initialized(false)
+{
+}
+
+ConnectionMonitor::~ConnectionMonitor() {
+}
+
+bool ConnectionMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No connection data source available" << std::endl;
+        return false;
+    }
+
+    // Baseline dump: the first update() reports rates since now
+    if (!m_source->sample(m_previous, m_previousTime)) {
+        return false;
+    }
+    sortById(m_previous, m_previousOrder);
+    m_connectionCount = m_previous.size();
+
+    m_initialized = true;
+    return true;
+}
+
+void ConnectionMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("conn.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+void ConnectionMonitor::setTopCount(int count) {
+    m_topCount = count > 0 ? count : 0;
+}
+
+size_t ConnectionMonitor::getConnectionCount() const {
+    return m_connectionCount;
+}
+
+const std::vector<FlowInfo>& ConnectionMonitor::getTopFlows() const {
+    return m_topFlows;
+}
+
+double ConnectionMonitor::getTotalReceiveRate() const {
+    return m_totalReceiveRate;
+}
+
+double ConnectionMonitor::getTotalSendRate() const {
+    return m_totalSendRate;
+}
+
+bool ConnectionMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* ConnectionMonitor::name() const {
+    return "connections";
+}
+
+void ConnectionMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::NetConnections);
+}
+
+void ConnectionMonitor::publish(MetricTable& metrics) {
+    if (m_initialized) {
+        metrics.set(MetricId::NetConnections, static_cast<double>(getConnectionCount()));
+    }
+}
+
+std::string ConnectionMonitor::formatEndpoint(const ConnectionEndpoint& endpoint) {
+    char buffer[64];
+    const uint8_t* a = endpoint.address;
+    if (endpoint.family == 6) {
+        std::snprintf(buffer, sizeof(buffer), "[%x:%x:%x:%x:%x:%x:%x:%x]:%u",
+                      a[0] << 8 | a[1], a[2] << 8 | a[3], a[4] << 8 | a[5], a[6] << 8 | a[7],
+                      a[8] << 8 | a[9], a[10] << 8 | a[11], a[12] << 8 | a[13], a[14] << 8 | a[15],
+                      static_cast<unsigned>(endpoint.port));
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u:%u",
+                      a[0], a[1], a[2], a[3], static_cast<unsigned>(endpoint.port));
+    }
+    return buffer;
+}
+
+void ConnectionMonitor::sortById(const ConnectionTable& table, std::vector<uint32_t>& order) {
+    order.resize(table.size());
+    for (uint32_t row = 0; row < order.size(); row++) {
+        order[row] = row;
+    }
+    const uint64_t* ids = table.ids.data();
+    std::sort(order.begin(), order.end(), [ids](uint32_t a, uint32_t b) {
+        return ids[a] < ids[b];
+    });
+}
+
+void ConnectionMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("conn.collect_data");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = 0;
+    m_current.clear();
+    if (!m_source->sample(m_current, currentTime) || currentTime < m_previousTime) {
+        return;
+    }
+    m_connectionCount = m_current.size();
+    if (currentTime == m_previousTime) {
+        // Byte counters not re-read since the previous dump: keep the rates
+        return;
+    }
+    double elapsedSec = static_cast<double>(currentTime - m_previousTime) / 1e6;
+    sortById(m_current, m_currentOrder);
+
+    const size_t rows = m_current.size();
+    m_receiveRates.assign(rows, 0.0);
+    m_sendRates.assign(rows, 0.0);
+    m_totalReceiveRate = 0.0;
+    m_totalSendRate = 0.0;
+
+    // Merge the two id-sorted dumps; a new socket counts from zero
+    size_t p = 0;
+    for (uint32_t row : m_currentOrder) {
+        uint64_t id = m_current.ids[row];
+        while (p < m_previousOrder.size() && m_previous.ids[m_previousOrder[p]] < id) {
+            p++;
+        }
+        uint64_t received = 0;
+        uint64_t acked = 0;
+        if (p < m_previousOrder.size() && m_previous.ids[m_previousOrder[p]] == id) {
+            received = m_previous.bytesReceived[m_previousOrder[p]];
+            acked = m_previous.bytesAcked[m_previousOrder[p]];
+        }
+
+        uint64_t receivedDelta = m_current.bytesReceived[row] >= received ? m_current.bytesReceived[row] - received : 0;
+        uint64_t ackedDelta = m_current.bytesAcked[row] >= acked ? m_current.bytesAcked[row] - acked : 0;
+        m_receiveRates[row] = static_cast<double>(receivedDelta) / elapsedSec;
+        m_sendRates[row] = static_cast<double>(ackedDelta) / elapsedSec;
+        m_totalReceiveRate += m_receiveRates[row];
+        m_totalSendRate += m_sendRates[row];
+    }
+
+    // Busiest flows; only these are formatted and named
+    m_ranking.resize(rows);
+    for (uint32_t row = 0; row < rows; row++) {
+        m_ranking[row] = row;
+    }
+    size_t keep = std::min(rows, static_cast<size_t>(m_topCount));
+    std::partial_sort(m_ranking.begin(), m_ranking.begin() + keep, m_ranking.end(), [this](uint32_t a, uint32_t b) {
+        return m_receiveRates[a] + m_sendRates[a] > m_receiveRates[b] + m_sendRates[b];
+    });
+
+    m_topFlows.clear();
+    for (size_t i = 0; i < keep; i++) {
+        uint32_t row = m_ranking[i];
+        if (m_receiveRates[row] + m_sendRates[row] <= 0.0) {
+            break;  // Idle connections are not flows
+        }
+        FlowInfo flow;
+        flow.local = formatEndpoint(m_current.local[row]);
+        flow.remote = formatEndpoint(m_current.remote[row]);
+        flow.pid = m_current.pids[row];
+        flow.process = m_source->processName(flow.pid);
+        flow.receiveRate = m_receiveRates[row];
+        flow.sendRate = m_sendRates[row];
+        m_topFlows.push_back(flow);
+    }
+
+    std::swap(m_previous, m_current);
+    std::swap(m_previousOrder, m_currentOrder);
+    m_previousTime = currentTime;
+}
@@ -0,0 +1,113 @@
+#include "monitors/DataSources.h"
+
+#ifdef _WIN32
+#include "monitors/WinDataSources.h"
+#endif
+
+CPUTopology::CPUTopology()
+    : nodeCount(0)
+    , packageCount(0)
+    , dieCount(0)
+    , coreCount(0)
+{
+}
+
+int CPUTopology::cpuCount() const {
+    return static_cast<int>(node.size());
+}
+
+std::unique_ptr<CPUDataSource> createDefaultCPUDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinCPUDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<ThermalDataSource> createDefaultThermalDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinThermalDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<MemoryDataSource> createDefaultMemoryDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinMemoryDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<DiskDataSource> createDefaultDiskDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinDiskDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<NetworkDataSource> createDefaultNetworkDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinNetworkDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<InterruptDataSource> createDefaultInterruptDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinInterruptDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<TopologyDataSource> createDefaultTopologyDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinTopologyDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<PerfDataSource> createDefaultPerfDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinPerfDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<SchedDataSource> createDefaultSchedDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinSchedDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<NetStackDataSource> createDefaultNetStackDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinNetStackDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<ConnectionDataSource> createDefaultConnectionDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinConnectionDataSource>();
+#else
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<ProcessDataSource> createDefaultProcessDataSource() {
+#ifdef _WIN32
+    return std::make_unique<WinProcessDataSource>();
+#else
+    return nullptr;
+#endif
+}
@@ -0,0 +1,784 @@
+#include "monitors/FixtureDataSources.h"
+#include "core/SelfStats.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+// ---------------------------------------------------------------------------
+// FixtureFile
+// ---------------------------------------------------------------------------
+
+FixtureFile::FixtureFile(const std::filesystem::path& path)
+    : m_path(path)
+    , m_cursor(0)
+    , m_loaded(false)
+{
+}
+
+bool FixtureFile::next(std::string& line) {
+    refresh();
+    if (m_lines.empty()) {
+        return false;
+    }
+
+    if (m_cursor >= m_lines.size()) {
+        m_cursor = 0;
+    }
+    line = m_lines[m_cursor++];
+    return true;
+}
+
+bool FixtureFile::nextBlock(std::string& block) {
+    refresh();
+    block.clear();
+    if (m_lines.empty()) {
+        return false;
+    }
+
+    if (m_cursor >= m_lines.size()) {
+        m_cursor = 0;
+    }
+    while (m_cursor < m_lines.size()) {
+        const std::string& line = m_lines[m_cursor++];
+        if (line.compare(0, 3, "---") == 0) {
+            if (block.empty()) {
+                continue;   // Leading or repeated separator
+            }
+            break;
+        }
+        block.append(line).append("\n");
+    }
+    return !block.empty();
+}
+
+bool FixtureFile::firstBlock(std::string& block) {
+    refresh();
+    block.clear();
+    for (const std::string& line : m_lines) {
+        if (line.compare(0, 3, "---") == 0) {
+            if (block.empty()) {
+                continue;
+            }
+            break;
+        }
+        block.append(line).append("\n");
+    }
+    return !block.empty();
+}
+
+const std::vector<std::string>& FixtureFile::lines() {
+    refresh();
+    return m_lines;
+}
+
+void FixtureFile::parseNumbers(const std::string& line, std::vector<double>& values) {
+    values.clear();
+
+    const char* cursor = line.c_str();
+    while (*cursor) {
+        char* end = nullptr;
+        double value = std::strtod(cursor, &end);
+        if (end == cursor) {
+            // Skip a non-numeric character
+            cursor++;
+            continue;
+        }
+        values.push_back(value);
+        cursor = end;
+    }
+}
+
+void FixtureFile::refresh() {
+    std::error_code error;
+    auto modified = std::filesystem::last_write_time(m_path, error);
+    if (error) {
+        m_lines.clear();
+        m_loaded = false;
+        return;
+    }
+
+    if (m_loaded && modified == m_loadedTime) {
+        return;
+    }
+
+    std::ifstream input(m_path);
+    std::string line;
+    m_lines.clear();
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        m_lines.push_back(line);
+    }
+
+    m_loadedTime = modified;
+    m_loaded = true;
+    if (m_cursor > m_lines.size()) {
+        m_cursor = 0;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("fixture.load");
+    stats.addSyscalls(1);
+    stats.addBytesRead(static_cast<uint64_t>(std::filesystem::file_size(m_path, error)));
+}
+
+// ---------------------------------------------------------------------------
+// CPU
+// ---------------------------------------------------------------------------
+
+FixtureCPUDataSource::FixtureCPUDataSource(const std::filesystem::path& root)
+    : m_file(root / "cpu")
+{
+}
+
+bool FixtureCPUDataSource::open(int& coreCount) {
+    const auto& lines = m_file.lines();
+    if (lines.empty()) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(lines.front(), m_values);
+    coreCount = static_cast<int>(m_values.size()) / CPUTimes::ColumnCount;
+    if (coreCount == 0) {
+        return false;
+    }
+
+    m_counters.resize(coreCount);
+    return true;
+}
+
+bool FixtureCPUDataSource::sample(CPUTimes& times) {
+    std::string line;
+    if (!m_file.next(line)) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    if (m_values.empty()) {
+        return false;
+    }
+
+    const int coreCount = m_counters.coreCount();
+    for (int core = 0; core < coreCount; core++) {
+        for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+            size_t index = static_cast<size_t>(core) * CPUTimes::ColumnCount + c;
+            if (index < m_values.size() && m_values[index] > 0.0) {
+                m_counters.columns[c][core] += static_cast<uint64_t>(m_values[index]);
+            }
+        }
+    }
+
+    for (int c = 0; c < CPUTimes::ColumnCount; c++) {
+        std::copy_n(m_counters.columns[c].begin(),
+                    std::min(coreCount, times.coreCount()), times.columns[c].begin());
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Thermals
+// ---------------------------------------------------------------------------
+
+FixtureThermalDataSource::FixtureThermalDataSource(const std::filesystem::path& root)
+    : m_frequencies(root / "cpufreq")
+    , m_sensors(root / "sensors")
+    , m_temperatures(root / "thermal")
+{
+}
+
+bool FixtureThermalDataSource::open(int coreCount) {
+    return coreCount > 0 && !m_frequencies.lines().empty();
+}
+
+bool FixtureThermalDataSource::sample(CPUThermals& thermals) {
+    std::string line;
+    if (!m_frequencies.next(line)) {
+        return false;
+    }
+
+    // <currentMhz> <maxMhz> <limitMhz> <throttleCount> per core
+    FixtureFile::parseNumbers(line, m_values);
+    for (size_t i = 0; i < thermals.currentMhz.size() && i * 4 + 3 < m_values.size(); i++) {
+        thermals.currentMhz[i] = m_values[i * 4];
+        thermals.maxMhz[i] = m_values[i * 4 + 1];
+        thermals.limitMhz[i] = m_values[i * 4 + 2];
+        thermals.throttleCount[i] = static_cast<uint64_t>(m_values[i * 4 + 3]);
+    }
+
+    thermals.sensorNames.clear();
+    thermals.sensorCelsius.clear();
+    if (m_temperatures.next(line)) {
+        FixtureFile::parseNumbers(line, m_values);
+        const auto& names = m_sensors.lines();
+        for (size_t i = 0; i < m_values.size(); i++) {
+            thermals.sensorNames.push_back(i < names.size() ? names[i] : "Sensor " + std::to_string(i));
+            thermals.sensorCelsius.push_back(m_values[i]);
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Memory
+// ---------------------------------------------------------------------------
+
+FixtureMemoryDataSource::FixtureMemoryDataSource(const std::filesystem::path& root)
+    : m_file(root / "memory")
+{
+}
+
+bool FixtureMemoryDataSource::sample(MemoryStatus& status) {
+    std::string line;
+    if (!m_file.next(line)) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    if (m_values.size() < 5) {
+        return false;
+    }
+
+    status.totalPhys = static_cast<uint64_t>(m_values[0]);
+    status.availPhys = static_cast<uint64_t>(m_values[1]);
+    status.totalPageFile = static_cast<uint64_t>(m_values[2]);
+    status.availPageFile = static_cast<uint64_t>(m_values[3]);
+    status.memoryLoad = static_cast<uint32_t>(m_values[4]);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Disk
+// ---------------------------------------------------------------------------
+
+FixtureDiskDataSource::FixtureDiskDataSource(const std::filesystem::path& root)
+    : m_volumes(root / "volumes")
+    , m_file(root / "disks")
+{
+}
+
+bool FixtureDiskDataSource::enumerate(std::vector<DiskInfo>& disks) {
+    disks.clear();
+
+    for (const auto& line : m_volumes.lines()) {
+        // <drive>\t<volumeName>\t<fileSystem>; names are read by describe()
+        DiskInfo info;
+        info.driveLetter = NameTable::intern(line.substr(0, line.find('\t')));
+        info.volumeName = NameTable::EMPTY;
+        info.fileSystem = NameTable::EMPTY;
+        info.described = false;
+        info.totalSpace = 0;
+        info.freeSpace = 0;
+        info.usedSpace = 0;
+        info.usagePercent = 0.0;
+        info.readSpeed = 0.0;
+        info.writeSpeed = 0.0;
+
+        disks.push_back(info);
+    }
+
+    return !disks.empty();
+}
+
+void FixtureDiskDataSource::describe(DiskInfo& disk) {
+    const std::string& drive = NameTable::utf8(disk.driveLetter);
+    for (const auto& line : m_volumes.lines()) {
+        size_t first = line.find('\t');
+        if (line.compare(0, first, drive) != 0 || first == std::string::npos) {
+            continue;
+        }
+        size_t second = line.find('\t', first + 1);
+        disk.volumeName = NameTable::intern(line.substr(first + 1, second - first - 1));
+        if (second != std::string::npos) {
+            disk.fileSystem = NameTable::intern(line.substr(second + 1));
+        }
+        return;
+    }
+}
+
+void FixtureDiskDataSource::sampleSpace(std::vector<DiskInfo>& disks) {
+    // Advances to the next sample; sampleSpeeds() reuses it
+    std::string line;
+    if (!m_file.next(line)) {
+        m_values.clear();
+        return;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    for (size_t i = 0; i < disks.size() && i * 4 + 1 < m_values.size(); i++) {
+        disks[i].totalSpace = static_cast<uint64_t>(m_values[i * 4]);
+        disks[i].freeSpace = static_cast<uint64_t>(m_values[i * 4 + 1]);
+    }
+}
+
+void FixtureDiskDataSource::sampleSpeeds(std::vector<DiskInfo>& disks) {
+    for (size_t i = 0; i < disks.size() && i * 4 + 3 < m_values.size(); i++) {
+        disks[i].readSpeed = m_values[i * 4 + 2];
+        disks[i].writeSpeed = m_values[i * 4 + 3];
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Network
+// ---------------------------------------------------------------------------
+
+FixtureNetworkDataSource::FixtureNetworkDataSource(const std::filesystem::path& root)
+    : m_interfaces(root / "interfaces")
+    , m_file(root / "network")
+    , m_lastTimestamp(0)
+    , m_timeOffset(0)
+{
+}
+
+bool FixtureNetworkDataSource::sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) {
+    interfaces.clear();
+
+    std::string line;
+    if (!m_file.next(line)) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    if (m_values.empty()) {
+        return false;
+    }
+
+    // Keep time monotonic when the fixture wraps around
+    // The file is in milliseconds
+    uint64_t timestamp = static_cast<uint64_t>(m_values[0]) * 1000 + m_timeOffset;
+    if (m_lastTimestamp > 0 && timestamp <= m_lastTimestamp) {
+        m_timeOffset += m_lastTimestamp + 1000000 - timestamp;
+        timestamp = m_lastTimestamp + 1000000;
+    }
+    m_lastTimestamp = timestamp;
+    timestampUs = timestamp;
+
+    // Two columns per interface, or eight with packet, error and drop counts
+    const auto& names = m_interfaces.lines();
+    const size_t stride = !names.empty() && (m_values.size() - 1) / names.size() >= 8 ? 8 : 2;
+    for (size_t i = 0; i < names.size() && (i + 1) * stride < m_values.size(); i++) {
+        // <name>\t<active 0|1>
+        size_t tab = names[i].find('\t');
+        const double* values = m_values.data() + 1 + i * stride;
+
+        NetworkInterfaceInfo info;
+        info.name = NameTable::intern(names[i].data(), tab == std::string::npos ? names[i].size() : tab);
+        info.description = info.name;
+        info.bytesReceived = static_cast<uint64_t>(values[0]);
+        info.bytesSent = static_cast<uint64_t>(values[1]);
+        info.packetsReceived = stride == 8 ? static_cast<uint64_t>(values[2]) : 0;
+        info.packetsSent = stride == 8 ? static_cast<uint64_t>(values[3]) : 0;
+        info.errors = stride == 8 ? static_cast<uint64_t>(values[4] + values[5]) : 0;
+        info.drops = stride == 8 ? static_cast<uint64_t>(values[6] + values[7]) : 0;
+        info.downloadSpeed = 0.0;
+        info.uploadSpeed = 0.0;
+        info.packetReceiveRate = 0.0;
+        info.packetSendRate = 0.0;
+        info.errorRate = 0.0;
+        info.dropRate = 0.0;
+        info.isActive = (tab == std::string::npos) || names[i].compare(tab + 1, 1, "0") != 0;
+
+        interfaces.push_back(info);
+    }
+
+    return true;
+}
+
+namespace {
+    /**
+     * @brief Find a process in a "<pid>\t<name>" file
+     * @return Name, or NameTable::EMPTY if the PID is not listed
+     */
+    NameId lookupProcessName(FixtureFile& processes, uint32_t pid) {
+        for (const auto& line : processes.lines()) {
+            size_t tab = line.find('\t');
+            if (tab != std::string::npos && std::strtoul(line.c_str(), nullptr, 10) == pid) {
+                return NameTable::intern(line.data() + tab + 1, line.size() - tab - 1);
+            }
+        }
+        return NameTable::EMPTY;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Connections
+// ---------------------------------------------------------------------------
+
+FixtureConnectionDataSource::FixtureConnectionDataSource(const std::filesystem::path& root)
+    : m_connections(root / "connections")
+    , m_processes(root / "processes")
+    , m_timestamp(0)
+{
+}
+
+bool FixtureConnectionDataSource::parseEndpoint(const std::string& text, ConnectionEndpoint& endpoint) {
+    unsigned a, b, c, d, port;
+    char tail;
+    if (std::sscanf(text.c_str(), "%u.%u.%u.%u:%u%c", &a, &b, &c, &d, &port, &tail) != 5
+        || a > 255 || b > 255 || c > 255 || d > 255 || port > 65535) {
+        return false;
+    }
+    endpoint = ConnectionEndpoint{};
+    endpoint.address[0] = static_cast<uint8_t>(a);
+    endpoint.address[1] = static_cast<uint8_t>(b);
+    endpoint.address[2] = static_cast<uint8_t>(c);
+    endpoint.address[3] = static_cast<uint8_t>(d);
+    endpoint.port = static_cast<uint16_t>(port);
+    endpoint.family = 4;
+    return true;
+}
+
+bool FixtureConnectionDataSource::sample(ConnectionTable& table, uint64_t& timestampUs) {
+    if (!m_connections.nextBlock(m_block)) {
+        return false;
+    }
+
+    std::istringstream lines(m_block);
+    std::string line;
+    while (std::getline(lines, line)) {
+        // <id> <pid> <local> <remote> <bytesReceived> <bytesAcked>
+        std::istringstream fields(line);
+        uint64_t id = 0;
+        uint32_t pid = 0;
+        std::string local;
+        std::string remote;
+        uint64_t received = 0;
+        uint64_t acked = 0;
+        ConnectionEndpoint localEndpoint;
+        ConnectionEndpoint remoteEndpoint;
+        if (fields >> id >> pid >> local >> remote >> received >> acked
+            && parseEndpoint(local, localEndpoint) && parseEndpoint(remote, remoteEndpoint)) {
+            table.add(id, pid, localEndpoint, remoteEndpoint, received, acked);
+        }
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+NameId FixtureConnectionDataSource::processName(uint32_t pid) {
+    return lookupProcessName(m_processes, pid);
+}
+
+// ---------------------------------------------------------------------------
+// Processes
+// ---------------------------------------------------------------------------
+
+FixtureProcessDataSource::FixtureProcessDataSource(const std::filesystem::path& root)
+    : m_io(root / "process_io")
+    , m_memory(root / "process_memory")
+    , m_exitFile(root / "process_exits")
+    , m_processes(root / "processes")
+    , m_timestamp(0)
+{
+}
+
+bool FixtureProcessDataSource::sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) {
+    if (!m_io.nextBlock(m_block)) {
+        return false;
+    }
+
+    processes.clear();
+    std::istringstream lines(m_block);
+    std::string line;
+    while (std::getline(lines, line)) {
+        // <pid> <readBytes> <writeBytes> <readOps> <writeOps> [<cpuMicros>]
+        std::istringstream fields(line);
+        ProcessCounters counters;
+        if (fields >> counters.pid >> counters.readBytes >> counters.writeBytes >> counters.readOps >> counters.writeOps) {
+            if (!(fields >> counters.cpuMicros)) {
+                counters.cpuMicros = 0;
+            }
+            counters.residentBytes = 0;
+            processes.push_back(counters);
+        }
+    }
+    std::sort(processes.begin(), processes.end(), [](const ProcessCounters& a, const ProcessCounters& b) {
+        return a.pid < b.pid;
+    });
+
+    // <pid> <resident> <proportional> <unique> <swapped>
+    m_breakdowns.clear();
+    if (m_memory.nextBlock(m_block)) {
+        std::istringstream memoryLines(m_block);
+        while (std::getline(memoryLines, line)) {
+            std::istringstream fields(line);
+            uint32_t pid = 0;
+            ProcessMemory memory;
+            if (fields >> pid >> memory.resident >> memory.proportional >> memory.unique >> memory.swapped) {
+                m_breakdowns.emplace_back(pid, memory);
+            }
+        }
+    }
+    for (ProcessCounters& counters : processes) {
+        for (const auto& breakdown : m_breakdowns) {
+            if (breakdown.first == counters.pid) {
+                counters.residentBytes = breakdown.second.resident;
+            }
+        }
+    }
+
+    // <pid> <parentPid> <lifetimeMs> <cpuMicros> <readBytes> <writeBytes> <name>
+    if (m_exitFile.nextBlock(m_block)) {
+        std::istringstream exitLines(m_block);
+        while (std::getline(exitLines, line)) {
+            std::istringstream fields(line);
+            ProcessExit exit;
+            std::string name;
+            if (fields >> exit.pid >> exit.parentPid >> exit.lifetimeMs >> exit.cpuMicros
+                       >> exit.readBytes >> exit.writeBytes >> name) {
+                exit.name = NameTable::intern(name);
+                m_exits.push_back(exit);
+            }
+        }
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+bool FixtureProcessDataSource::readMemory(uint32_t pid, ProcessMemory& memory) {
+    for (const auto& breakdown : m_breakdowns) {
+        if (breakdown.first == pid) {
+            memory = breakdown.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FixtureProcessDataSource::openEvents() {
+    return m_exitFile.firstBlock(m_block);
+}
+
+void FixtureProcessDataSource::drainExits(std::vector<ProcessExit>& exits) {
+    exits.clear();
+    std::swap(exits, m_exits);
+}
+
+NameId FixtureProcessDataSource::processName(uint32_t pid) {
+    return lookupProcessName(m_processes, pid);
+}
+
+// ---------------------------------------------------------------------------
+// Network stack
+// ---------------------------------------------------------------------------
+
+FixtureNetStackDataSource::FixtureNetStackDataSource(const std::filesystem::path& root)
+    : m_snmp(root / "snmp")
+    , m_netstat(root / "netstat")
+    , m_snmpParser(SnmpTableParser::SNMP_COLUMNS)
+    , m_netstatParser(SnmpTableParser::NETSTAT_COLUMNS)
+    , m_timestamp(0)
+{
+}
+
+bool FixtureNetStackDataSource::open(NetStackCounters& counters) {
+    if (!m_snmp.firstBlock(m_block) || !m_snmpParser.bind(m_block, counters)) {
+        return false;
+    }
+
+    // netstat is optional
+    if (m_netstat.firstBlock(m_block)) {
+        m_netstatParser.bind(m_block, counters);
+    }
+    return true;
+}
+
+bool FixtureNetStackDataSource::sample(NetStackCounters& counters, uint64_t& timestampUs) {
+    // Rebind when a snapshot changes the table layout
+    if (!m_snmp.nextBlock(m_block)) {
+        return false;
+    }
+    if (!m_snmpParser.parse(m_block, counters)
+        && !(m_snmpParser.bind(m_block, counters) && m_snmpParser.parse(m_block, counters))) {
+        return false;
+    }
+
+    if (m_netstatParser.isBound() && m_netstat.nextBlock(m_block)
+        && !m_netstatParser.parse(m_block, counters)
+        && m_netstatParser.bind(m_block, counters)) {
+        m_netstatParser.parse(m_block, counters);
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Interrupts
+// ---------------------------------------------------------------------------
+
+FixtureInterruptDataSource::FixtureInterruptDataSource(const std::filesystem::path& root)
+    : m_interrupts(root / "interrupts")
+    , m_softirqs(root / "softirqs")
+    , m_timestamp(0)
+{
+}
+
+bool FixtureInterruptDataSource::open(int& cpuCount) {
+    // The CPU count comes from the header of the first snapshot
+    InterruptCounters counters;
+    const auto& lines = m_interrupts.lines();
+    if (lines.empty() || !InterruptMonitor::parseProcTable(lines.front(), false, counters)) {
+        return false;
+    }
+    cpuCount = counters.cpuCount;
+    return cpuCount > 0;
+}
+
+bool FixtureInterruptDataSource::sample(InterruptCounters& counters, uint64_t& timestampUs) {
+    if (!m_interrupts.nextBlock(m_block)
+        || !InterruptMonitor::parseProcTable(m_block, false, counters)) {
+        return false;
+    }
+
+    // softirqs is optional
+    if (m_softirqs.nextBlock(m_block)) {
+        InterruptMonitor::parseProcTable(m_block, true, counters);
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Scheduler
+// ---------------------------------------------------------------------------
+
+FixtureSchedDataSource::FixtureSchedDataSource(const std::filesystem::path& root)
+    : m_file(root / "schedstat")
+    , m_timestamp(0)
+{
+}
+
+bool FixtureSchedDataSource::open(SchedCounters& counters) {
+    // The CPU count comes from the first snapshot
+    SchedCounters first;
+    if (!m_file.firstBlock(m_block) || !SchedMonitor::parseSchedstat(m_block, first)) {
+        return false;
+    }
+    counters.resize(first.cpuCount());
+    counters.waitPerCpu = true;
+    return true;
+}
+
+bool FixtureSchedDataSource::sample(SchedCounters& counters, uint64_t& timestampUs) {
+    if (!m_file.nextBlock(m_block) || !SchedMonitor::parseSchedstat(m_block, counters)) {
+        return false;
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Perf
+// ---------------------------------------------------------------------------
+
+FixturePerfDataSource::FixturePerfDataSource(const std::filesystem::path& root)
+    : m_file(root / "perf")
+    , m_timestamp(0)
+{
+}
+
+bool FixturePerfDataSource::open(PerfCounters& counters) {
+    const auto& lines = m_file.lines();
+    if (lines.empty()) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(lines.front(), m_values);
+    int cpuCount = static_cast<int>(m_values.size()) / PerfCounters::EventCount;
+    if (cpuCount == 0) {
+        return false;
+    }
+
+    counters.resize(cpuCount);
+    for (int e = 0; e < PerfCounters::EventCount; e++) {
+        counters.available[e] = true;
+        counters.perCpu[e] = true;
+    }
+    m_counters = counters;
+    return true;
+}
+
+bool FixturePerfDataSource::sample(PerfCounters& counters, uint64_t& timestampUs) {
+    std::string line;
+    if (!m_file.next(line)) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    const int cpuCount = std::min(m_counters.cpuCount(), counters.cpuCount());
+    for (int cpu = 0; cpu < cpuCount; cpu++) {
+        for (int e = 0; e < PerfCounters::EventCount; e++) {
+            size_t index = static_cast<size_t>(cpu) * PerfCounters::EventCount + e;
+            if (index < m_values.size() && m_values[index] > 0.0) {
+                m_counters.values[e][cpu] += static_cast<uint64_t>(m_values[index]);
+            }
+            counters.values[e][cpu] = m_counters.values[e][cpu];
+        }
+    }
+
+    m_timestamp += 1000000;
+    timestampUs = m_timestamp;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Topology
+// ---------------------------------------------------------------------------
+
+FixtureTopologyDataSource::FixtureTopologyDataSource(const std::filesystem::path& root)
+    : m_topology(root / "topology")
+    , m_file(root / "numa")
+{
+}
+
+bool FixtureTopologyDataSource::readTopology(CPUTopology& topology) {
+    topology = CPUTopology();
+
+    // <node> <package> <die> <core>
+    for (const auto& line : m_topology.lines()) {
+        FixtureFile::parseNumbers(line, m_values);
+        if (m_values.size() < 4) {
+            continue;
+        }
+        topology.node.push_back(static_cast<int>(m_values[0]));
+        topology.package.push_back(static_cast<int>(m_values[1]));
+        topology.die.push_back(static_cast<int>(m_values[2]));
+        topology.core.push_back(static_cast<int>(m_values[3]));
+        topology.nodeCount = std::max(topology.nodeCount, topology.node.back() + 1);
+        topology.packageCount = std::max(topology.packageCount, topology.package.back() + 1);
+        topology.dieCount = std::max(topology.dieCount, topology.die.back() + 1);
+        topology.coreCount = std::max(topology.coreCount, topology.core.back() + 1);
+    }
+
+    return topology.cpuCount() > 0;
+}
+
+bool FixtureTopologyDataSource::sampleNodes(std::vector<NodeMemory>& nodes) {
+    std::string line;
+    if (!m_file.next(line)) {
+        return false;
+    }
+
+    FixtureFile::parseNumbers(line, m_values);
+    for (size_t i = 0; i < nodes.size() && i * 4 + 3 < m_values.size(); i++) {
+        nodes[i].totalPhys = static_cast<uint64_t>(m_values[i * 4]);
+        nodes[i].availPhys = static_cast<uint64_t>(m_values[i * 4 + 1]);
+        nodes[i].localPages = static_cast<uint64_t>(m_values[i * 4 + 2]);
+        nodes[i].remotePages = static_cast<uint64_t>(m_values[i * 4 + 3]);
+    }
+    return true;
+}
@@ -0,0 +1,341 @@
+#include "monitors/InterruptMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+}
+
+// ---------------------------------------------------------------------------
+// InterruptCounters
+// ---------------------------------------------------------------------------
+
+InterruptCounters::InterruptCounters()
+    : cpuCount(0)
+{
+}
+
+void InterruptCounters::reset(int cpus) {
+    cpuCount = cpus;
+    names.clear();
+    deferred.clear();
+    counts.clear();
+}
+
+int InterruptCounters::sourceCount() const {
+    return static_cast<int>(names.size());
+}
+
+uint64_t* InterruptCounters::addSource(const std::string& name, bool isDeferred) {
+    names.push_back(name);
+    deferred.push_back(isDeferred ? 1 : 0);
+    counts.resize(counts.size() + cpuCount, 0);
+    return counts.data() + counts.size() - cpuCount;
+}
+
+// ---------------------------------------------------------------------------
+// InterruptMonitor
+// ---------------------------------------------------------------------------
+
+InterruptMonitor::InterruptMonitor()
+    : InterruptMonitor(createDefaultInterruptDataSource())
+{
+}
+
+InterruptMonitor::InterruptMonitor(std::unique_ptr<InterruptDataSource> source)
+    : m_source(std::move(source))
+    , m_previousTime(0)
+    , m_currentTime(0)
+    , m_initialized(false)
+{
+}
+
+InterruptMonitor::~InterruptMonitor() {
+}
+
+bool InterruptMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No interrupt data source available" << std::endl;
+        return false;
+    }
+
+    int cpuCount = 0;
+    if (!m_source->open(cpuCount)) {
+        return false;
+    }
+
+    m_cpuRates.assign(cpuCount, 0.0);
+    m_cpuDeferredRates.assign(cpuCount, 0.0);
+
+    // Baseline sample: the first update() reports rates since now
+    m_previous.reset(cpuCount);
+    m_source->sample(m_previous, m_previousTime);
+
+    m_initialized = true;
+    return true;
+}
+
+void InterruptMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("irq.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+int InterruptMonitor::getCpuCount() const {
+    return static_cast<int>(m_cpuRates.size());
+}
+
+int InterruptMonitor::getSourceCount() const {
+    return m_previous.sourceCount();
+}
+
+std::string InterruptMonitor::getSourceName(int source) const {
+    if (source < 0 || source >= m_previous.sourceCount()) {
+        return std::string();
+    }
+    return m_previous.names[source];
+}
+
+bool InterruptMonitor::isDeferred(int source) const {
+    if (source < 0 || source >= m_previous.sourceCount()) {
+        return false;
+    }
+    return m_previous.deferred[source] != 0;
+}
+
+int InterruptMonitor::findSource(const std::string& name) const {
+    for (int source = 0; source < m_previous.sourceCount(); source++) {
+        if (m_previous.names[source] == name) {
+            return source;
+        }
+    }
+    return -1;
+}
+
+double InterruptMonitor::getRate(int source, int cpu) const {
+    int cpuCount = getCpuCount();
+    size_t index = static_cast<size_t>(source) * cpuCount + cpu;
+    if (source < 0 || cpu < 0 || cpu >= cpuCount || index >= m_rates.size()) {
+        return 0.0;
+    }
+    return m_rates[index];
+}
+
+double InterruptMonitor::getSourceRate(int source) const {
+    double rate = 0.0;
+    for (int cpu = 0; cpu < getCpuCount(); cpu++) {
+        rate += getRate(source, cpu);
+    }
+    return rate;
+}
+
+double InterruptMonitor::getCpuRate(int cpu) const {
+    if (cpu < 0 || cpu >= getCpuCount()) {
+        return 0.0;
+    }
+    return m_cpuRates[cpu];
+}
+
+double InterruptMonitor::getCpuDeferredRate(int cpu) const {
+    if (cpu < 0 || cpu >= getCpuCount()) {
+        return 0.0;
+    }
+    return m_cpuDeferredRates[cpu];
+}
+
+std::vector<int> InterruptMonitor::getTopSources(int cpu, int count) const {
+    std::vector<int> sources;
+    for (int source = 0; source < getSourceCount(); source++) {
+        if (!isDeferred(source) && getRate(source, cpu) > 0.0) {
+            sources.push_back(source);
+        }
+    }
+
+    size_t keep = std::min(sources.size(), static_cast<size_t>(std::max(count, 0)));
+    std::partial_sort(sources.begin(), sources.begin() + keep, sources.end(), [&](int a, int b) {
+        return getRate(a, cpu) > getRate(b, cpu);
+    });
+    sources.resize(keep);
+    return sources;
+}
+
+bool InterruptMonitor::isHotspot(int cpu) const {
+    int cpuCount = getCpuCount();
+    if (cpu < 0 || cpu >= cpuCount || cpuCount < 2) {
+        return false;
+    }
+
+    // Compare against the other CPUs so a single hot core on a small
+    // machine does not raise the baseline it is measured against
+    double rate = m_cpuRates[cpu] + m_cpuDeferredRates[cpu];
+    double others = 0.0;
+    for (int i = 0; i < cpuCount; i++) {
+        others += m_cpuRates[i] + m_cpuDeferredRates[i];
+    }
+    double mean = (others - rate) / (cpuCount - 1);
+    return rate >= HOTSPOT_MIN_RATE && rate > HOTSPOT_FACTOR * mean;
+}
+
+bool InterruptMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* InterruptMonitor::name() const {
+    return "interrupts";
+}
+
+void InterruptMonitor::registerSeries(MetricTable& metrics) {
+    m_cpuSeries.clear();
+    for (int i = 0; i < getCpuCount(); i++) {
+        m_cpuSeries.push_back(metrics.addSeries(MetricId::IrqCore, std::to_string(i)));
+    }
+}
+
+void InterruptMonitor::publish(MetricTable& metrics) {
+    for (size_t i = 0; i < m_cpuSeries.size(); i++) {
+        int cpu = static_cast<int>(i);
+        metrics.set(m_cpuSeries[i], getCpuRate(cpu) + getCpuDeferredRate(cpu));
+    }
+}
+
+bool InterruptMonitor::parseProcTable(const std::string& text, bool isDeferred, InterruptCounters& counters) {
+    const char* cursor = text.c_str();
+    const char* end = cursor + text.size();
+
+    // Header: "           CPU0       CPU1 ..."
+    int cpus = 0;
+    while (cursor < end && *cursor != '\n') {
+        if (cursor[0] == 'C' && end - cursor > 3 && cursor[1] == 'P' && cursor[2] == 'U') {
+            cpus++;
+            cursor += 3;
+        } else {
+            cursor++;
+        }
+    }
+    if (cpus == 0) {
+        return false;
+    }
+    if (counters.sourceCount() == 0) {
+        counters.reset(cpus);
+    }
+    const int columns = std::min(cpus, counters.cpuCount);
+
+    std::string name;
+    while (cursor < end) {
+        // Next row: "<label>: <n> <n> ... [description]"
+        if (*cursor == '\n') {
+            cursor++;
+        }
+        while (cursor < end && isSpace(*cursor)) {
+            cursor++;
+        }
+        const char* labelStart = cursor;
+        while (cursor < end && *cursor != ':' && *cursor != '\n') {
+            cursor++;
+        }
+        if (cursor >= end || *cursor != ':') {
+            continue;   // Blank or malformed row
+        }
+        name.assign(labelStart, cursor);
+        bool numericLabel = !name.empty() && std::all_of(name.begin(), name.end(), isDigit);
+        cursor++;
+
+        uint64_t* row = counters.addSource(name, isDeferred);
+        for (int column = 0; column < cpus; column++) {
+            while (cursor < end && isSpace(*cursor)) {
+                cursor++;
+            }
+            if (cursor >= end || !isDigit(*cursor)) {
+                break;  // Short row; remaining CPUs stay zero
+            }
+            uint64_t value = 0;
+            while (cursor < end && isDigit(*cursor)) {
+                value = value * 10 + static_cast<uint64_t>(*cursor - '0');
+                cursor++;
+            }
+            if (column < columns) {
+                row[column] = value;
+            }
+        }
+
+        // Description: the device name is its last token
+        const char* lastToken = nullptr;
+        const char* lastTokenEnd = nullptr;
+        while (cursor < end && *cursor != '\n') {
+            if (isSpace(*cursor)) {
+                cursor++;
+                continue;
+            }
+            lastToken = cursor;
+            while (cursor < end && *cursor != '\n' && !isSpace(*cursor)) {
+                cursor++;
+            }
+            lastTokenEnd = cursor;
+        }
+        if (numericLabel && lastToken) {
+            counters.names.back().append(" ").append(lastToken, lastTokenEnd);
+        }
+    }
+
+    return true;
+}
+
+void InterruptMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("irq.collect_data");
+    ScopedTimer timer(stats);
+
+    m_current.reset(getCpuCount());
+    if (!m_source->sample(m_current, m_currentTime)) {
+        return;
+    }
+
+    const int cpuCount = getCpuCount();
+    const int sourceCount = m_current.sourceCount();
+    double elapsedSec = static_cast<double>(m_currentTime - m_previousTime) / 1e6;
+
+    // Rates are only defined when both samples have the same rows
+    bool sameRows = m_currentTime > m_previousTime
+        && m_current.cpuCount == m_previous.cpuCount
+        && m_current.names == m_previous.names;
+
+    m_rates.assign(static_cast<size_t>(sourceCount) * cpuCount, 0.0);
+    std::fill(m_cpuRates.begin(), m_cpuRates.end(), 0.0);
+    std::fill(m_cpuDeferredRates.begin(), m_cpuDeferredRates.end(), 0.0);
+
+    if (sameRows) {
+        for (int source = 0; source < sourceCount; source++) {
+            const uint64_t* current = m_current.counts.data() + static_cast<size_t>(source) * cpuCount;
+            const uint64_t* previous = m_previous.counts.data() + static_cast<size_t>(source) * cpuCount;
+            double* rates = m_rates.data() + static_cast<size_t>(source) * cpuCount;
+            std::vector<double>& cpuRates = m_current.deferred[source] ? m_cpuDeferredRates : m_cpuRates;
+
+            for (int cpu = 0; cpu < cpuCount; cpu++) {
+                double rate = SystemUtils::calculateRate(current[cpu], previous[cpu], elapsedSec);
+                rates[cpu] = rate;
+                cpuRates[cpu] += rate;
+            }
+        }
+    }
+
+    std::swap(m_previous, m_current);
+    m_previousTime = m_currentTime;
+}
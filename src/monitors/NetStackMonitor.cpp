@@ -0,0 +1,330 @@
+#include "monitors/NetStackMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <cstring>
+#include <iostream>
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    /**
+     * @brief Find the end of the line starting at cursor
+     */
+    const char* lineEnd(const char* cursor, const char* end) {
+        const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        return newline ? newline : end;
+    }
+
+    /**
+     * @brief Find the ':' ending the table prefix of a line
+     * @return Pointer to the ':' or nullptr
+     */
+    const char* prefixEnd(const char* cursor, const char* end) {
+        while (cursor < end && *cursor != ':' && !isSpace(*cursor)) {
+            cursor++;
+        }
+        return cursor < end && *cursor == ':' ? cursor : nullptr;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// NetStackCounters
+// ---------------------------------------------------------------------------
+
+NetStackCounters::NetStackCounters() {
+    for (int c = 0; c < CounterCount; c++) {
+        values[c] = 0;
+        available[c] = false;
+    }
+}
+
+const char* NetStackCounters::counterName(Counter counter) {
+    static const char* const NAMES[CounterCount] = {
+        "tcp.out_segments", "tcp.retransmits", "tcp.resets", "tcp.established_resets",
+        "tcp.listen_overflows", "tcp.listen_drops", "tcp.syn_cookies",
+        "udp.receive_errors", "udp.buffer_errors", "ip.reassembly_failures"
+    };
+    if (counter < 0 || counter >= CounterCount) {
+        return "";
+    }
+    return NAMES[counter];
+}
+
+// ---------------------------------------------------------------------------
+// SnmpTableParser
+// ---------------------------------------------------------------------------
+
+const std::vector<SnmpTableParser::Column> SnmpTableParser::SNMP_COLUMNS = {
+    {"Ip", "ReasmFails", NetStackCounters::IpReassemblyFailures},
+    {"Tcp", "OutSegs", NetStackCounters::TcpOutSegments},
+    {"Tcp", "RetransSegs", NetStackCounters::TcpRetransmits},
+    {"Tcp", "OutRsts", NetStackCounters::TcpResets},
+    {"Tcp", "EstabResets", NetStackCounters::TcpEstablishedResets},
+    {"Udp", "InErrors", NetStackCounters::UdpReceiveErrors},
+    {"Udp", "RcvbufErrors", NetStackCounters::UdpBufferErrors},
+};
+
+const std::vector<SnmpTableParser::Column> SnmpTableParser::NETSTAT_COLUMNS = {
+    {"TcpExt", "ListenOverflows", NetStackCounters::TcpListenOverflows},
+    {"TcpExt", "ListenDrops", NetStackCounters::TcpListenDrops},
+    {"TcpExt", "SyncookiesSent", NetStackCounters::TcpSynCookies},
+};
+
+SnmpTableParser::SnmpTableParser(std::vector<Column> columns)
+    : m_columns(std::move(columns))
+{
+}
+
+bool SnmpTableParser::bind(const std::string& text, NetStackCounters& counters) {
+    m_tables.clear();
+    const char* cursor = text.c_str();
+    const char* end = cursor + text.size();
+    bool found = false;
+
+    // Header lines are the even lines; their value lines follow them
+    bool header = true;
+    while (cursor < end) {
+        const char* eol = lineEnd(cursor, end);
+        const char* colon = prefixEnd(cursor, eol);
+        if (!colon) {
+            cursor = eol < end ? eol + 1 : end;
+            continue;   // Blank or foreign line
+        }
+
+        if (header) {
+            Table table;
+            table.prefix.assign(cursor, colon);
+
+            const char* name = colon + 1;
+            while (name < eol) {
+                while (name < eol && isSpace(*name)) {
+                    name++;
+                }
+                if (name >= eol) {
+                    break;
+                }
+                const char* nameEnd = name;
+                while (nameEnd < eol && !isSpace(*nameEnd)) {
+                    nameEnd++;
+                }
+
+                int counter = -1;
+                for (const Column& column : m_columns) {
+                    if (table.prefix == column.prefix
+                        && static_cast<size_t>(nameEnd - name) == std::strlen(column.name)
+                        && std::memcmp(name, column.name, nameEnd - name) == 0) {
+                        counter = column.counter;
+                        counters.available[counter] = true;
+                        found = true;
+                    }
+                }
+                table.counters.push_back(counter);
+                name = nameEnd;
+            }
+            m_tables.push_back(std::move(table));
+        }
+
+        header = !header;
+        cursor = eol < end ? eol + 1 : end;
+    }
+
+    if (!found) {
+        m_tables.clear();
+    }
+    return found;
+}
+
+bool SnmpTableParser::parse(const std::string& text, NetStackCounters& counters) const {
+    if (m_tables.empty()) {
+        return false;
+    }
+
+    const char* cursor = text.c_str();
+    const char* end = cursor + text.size();
+    size_t line = 0;
+
+    while (cursor < end) {
+        const char* eol = lineEnd(cursor, end);
+        const char* colon = prefixEnd(cursor, eol);
+        if (!colon) {
+            cursor = eol < end ? eol + 1 : end;
+            continue;
+        }
+
+        size_t tableIndex = line / 2;
+        if (tableIndex >= m_tables.size()) {
+            return false;   // More tables than at bind time
+        }
+        const Table& table = m_tables[tableIndex];
+        if (static_cast<size_t>(colon - cursor) != table.prefix.size()
+            || std::memcmp(cursor, table.prefix.data(), table.prefix.size()) != 0) {
+            return false;   // Layout changed
+        }
+
+        // Value line: convert the bound columns only
+        if (line % 2 == 1) {
+            const char* value = colon + 1;
+            for (size_t column = 0; column < table.counters.size() && value < eol; column++) {
+                while (value < eol && isSpace(*value)) {
+                    value++;
+                }
+                int counter = table.counters[column];
+                if (counter < 0) {
+                    while (value < eol && !isSpace(*value)) {
+                        value++;
+                    }
+                    continue;
+                }
+                uint64_t number = 0;
+                while (value < eol && isDigit(*value)) {
+                    number = number * 10 + static_cast<uint64_t>(*value - '0');
+                    value++;
+                }
+                while (value < eol && !isSpace(*value)) {
+                    value++;    // Sign or garbage: keep the columns aligned
+                }
+                counters.values[counter] = number;
+            }
+        }
+
+        line++;
+        cursor = eol < end ? eol + 1 : end;
+    }
+
+    return line == m_tables.size() * 2;
+}
+
+bool SnmpTableParser::isBound() const {
+    return !m_tables.empty();
+}
+
+// ---------------------------------------------------------------------------
+// NetStackMonitor
+// ---------------------------------------------------------------------------
+
+NetStackMonitor::NetStackMonitor()
+    : NetStackMonitor(createDefaultNetStackDataSource())
+{
+}
+
+NetStackMonitor::NetStackMonitor(std::unique_ptr<NetStackDataSource> source)
+    : m_source(std::move(source))
+    , m_previousTime(0)
+    , m_initialized(false)
+{
+    for (double& rate : m_rates) {
+        rate = 0.0;
+    }
+}
+
+NetStackMonitor::~NetStackMonitor() {
+}
+
+bool NetStackMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No network stack data source available" << std::endl;
+        return false;
+    }
+
+    if (!m_source->open(m_previous)) {
+        return false;
+    }
+    m_current = m_previous;
+
+    // Baseline sample: the first update() reports rates since now
+    m_source->sample(m_previous, m_previousTime);
+
+    m_initialized = true;
+    return true;
+}
+
+void NetStackMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("netstack.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+bool NetStackMonitor::isAvailable(NetStackCounters::Counter counter) const {
+    if (!m_initialized || counter < 0 || counter >= NetStackCounters::CounterCount) {
+        return false;
+    }
+    return m_previous.available[counter];
+}
+
+double NetStackMonitor::getRate(NetStackCounters::Counter counter) const {
+    if (!isAvailable(counter)) {
+        return 0.0;
+    }
+    return m_rates[counter];
+}
+
+double NetStackMonitor::getRetransmitPercent() const {
+    double sent = getRate(NetStackCounters::TcpOutSegments);
+    return sent > 0.0 ? getRate(NetStackCounters::TcpRetransmits) / sent * 100.0 : 0.0;
+}
+
+bool NetStackMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* NetStackMonitor::name() const {
+    return "netstack";
+}
+
+void NetStackMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::NetRetransmit);
+    m_counterSeries.clear();
+    for (int c = 0; c < NetStackCounters::CounterCount; c++) {
+        auto counter = static_cast<NetStackCounters::Counter>(c);
+        m_counterSeries.push_back(isAvailable(counter)
+            ? metrics.addSeries(MetricId::NetStackCounter, NetStackCounters::counterName(counter))
+            : -1);
+    }
+}
+
+void NetStackMonitor::publish(MetricTable& metrics) {
+    if (!m_initialized) {
+        return;
+    }
+    metrics.set(MetricId::NetRetransmit, getRetransmitPercent());
+    for (size_t c = 0; c < m_counterSeries.size(); c++) {
+        metrics.set(m_counterSeries[c], m_rates[c]);
+    }
+}
+
+void NetStackMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("netstack.collect_data");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = 0;
+    if (!m_source->sample(m_current, currentTime)) {
+        return;
+    }
+
+    double elapsedSec = currentTime > m_previousTime
+        ? static_cast<double>(currentTime - m_previousTime) / 1e6
+        : 0.0;
+    for (int c = 0; c < NetStackCounters::CounterCount; c++) {
+        m_rates[c] = SystemUtils::calculateRate(m_current.values[c], m_previous.values[c], elapsedSec);
+    }
+
+    std::swap(m_previous, m_current);
+    m_previousTime = currentTime;
+}
@@ -1,9 +1,19 @@
 #include "monitors/NetworkMonitor.h"
+#include "monitors/DataSources.h"
 #include "utils/SystemUtils.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
 #include <iostream>
 
 NetworkMonitor::NetworkMonitor()
-    : m_initialized(false)
+    : NetworkMonitor(createDefaultNetworkDataSource())
+{
+}
+
+NetworkMonitor::NetworkMonitor(std::unique_ptr<NetworkDataSource> source)
+    : m_source(std::move(source))
+    , m_initialized(false)
+    , m_sampleTime(0)
     , m_lastUpdateTime(0)
 {
 }
@@ -17,18 +27,21 @@ bool NetworkMonitor::initialize() {
         return true;
     }
 
+    if (!m_source) {
+        std::cerr << "No network data source available" << std::endl;
+        return false;
+    }
+
     // Collect initial data
     collectData();
     
     // Initialize previous stats
     m_previousStats.resize(m_interfaces.size());
     for (size_t i = 0; i < m_interfaces.size(); i++) {
-        m_previousStats[i].bytesReceived = m_interfaces[i].bytesReceived;
-        m_previousStats[i].bytesSent = m_interfaces[i].bytesSent;
-        m_previousStats[i].timestamp = GetTickCount();
+        storePrevious(i, m_sampleTime);
     }
     
-    m_lastUpdateTime = GetTickCount();
+    m_lastUpdateTime = m_sampleTime;
     m_initialized = true;
     return true;
 }
@@ -38,6 +51,9 @@ void NetworkMonitor::update() {
         return;
     }
 
+    static CollectorStats& stats = SelfStats::probe("net.update");
+    ScopedTimer timer(stats);
+
     collectData();
     calculateSpeeds();
 }
@@ -66,6 +82,26 @@ double NetworkMonitor::getTotalUploadSpeed() const {
     return total;
 }
 
+double NetworkMonitor::getTotalErrorRate() const {
+    double total = 0.0;
+    for (const auto& iface : m_interfaces) {
+        if (iface.isActive) {
+            total += iface.errorRate;
+        }
+    }
+    return total;
+}
+
+double NetworkMonitor::getTotalDropRate() const {
+    double total = 0.0;
+    for (const auto& iface : m_interfaces) {
+        if (iface.isActive) {
+            total += iface.dropRate;
+        }
+    }
+    return total;
+}
+
 uint64_t NetworkMonitor::getTotalBytesDownloaded() const {
     uint64_t total = 0;
     for (const auto& iface : m_interfaces) {
@@ -86,70 +122,64 @@ bool NetworkMonitor::isInitialized() const {
     return m_initialized;
 }
 
-void NetworkMonitor::collectData() {
-    m_interfaces.clear();
+const char* NetworkMonitor::name() const {
+    return "network";
+}
 
-    // Get the table of network interfaces (use GetIfTable for Ming compatibility)
-    ULONG bufferSize = 0;
-    GetIfTable(nullptr, &bufferSize, FALSE);
-    
-    MIB_IFTABLE* ifTable = (MIB_IFTABLE*)malloc(bufferSize);
-    if (!ifTable) {
-        return;
-    }
-    
-    DWORD result = GetIfTable(ifTable, &bufferSize, FALSE);
-    
-    if (result != NO_ERROR) {
-        std::cerr << "Failed to get network interface table. Error: " << result << std::endl;
-        free(ifTable);
-        return;
-    }
+void NetworkMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::NetDownload);
+    metrics.addSeries(MetricId::NetUpload);
+    metrics.addSeries(MetricId::NetErrors);
+    metrics.addSeries(MetricId::NetDrops);
+    m_interfaceSeries.clear();
+}
 
-    // Iterate through all interfaces
-    for (DWORD i = 0; i < ifTable->dwNumEntries; i++) {
-        MIB_IFROW& row = ifTable->table[i];
-        
-        // Filter out loopback
-        if (row.dwType == MIB_IF_TYPE_LOOPBACK) {
-            continue;
-        }
+void NetworkMonitor::publish(MetricTable& metrics) {
+    metrics.set(MetricId::NetDownload, getTotalDownloadSpeed());
+    metrics.set(MetricId::NetUpload, getTotalUploadSpeed());
+    metrics.set(MetricId::NetErrors, getTotalErrorRate());
+    metrics.set(MetricId::NetDrops, getTotalDropRate());
 
-        NetworkInterfaceInfo info;
-        
-        // Convert description to wstring
-        char descBuffer[MAXLEN_IFDESCR + 1] = {0};
-        memcpy(descBuffer, row.bDescr, row.dwDescrLen);
-        info.description = SystemUtils::stringToWstring(descBuffer);
-        info.name = info.description;  // Use description as name
-        
-        info.bytesReceived = row.dwInOctets;
-        info.bytesSent = row.dwOutOctets;
-        info.downloadSpeed = 0.0;
-        info.uploadSpeed = 0.0;
-        info.isActive = (row.dwOperStatus == MIB_IF_OPER_STATUS_OPERATIONAL);
-        
-        m_interfaces.push_back(info);
+    // Per-interface series (interfaces may come and go between ticks);
+    // series names are only built the first time an interface is seen
+    for (const auto& iface : m_interfaces) {
+        auto found = m_interfaceSeries.find(iface.name);
+        if (found == m_interfaceSeries.end()) {
+            const std::string& label = NameTable::utf8(iface.name);
+            found = m_interfaceSeries.emplace(iface.name, std::make_pair(
+                metrics.addSeries(MetricId::NetInterfaceDownload, label),
+                metrics.addSeries(MetricId::NetInterfaceUpload, label))).first;
+        }
+        metrics.set(found->second.first, iface.downloadSpeed);
+        metrics.set(found->second.second, iface.uploadSpeed);
     }
+}
+
+void NetworkMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("net.collect_data");
+    ScopedTimer timer(stats);
 
-    free(ifTable);
+    if (!m_source->sample(m_interfaces, m_sampleTime)) {
+        m_interfaces.clear();
+    }
 }
 
 void NetworkMonitor::calculateSpeeds() {
-    DWORD currentTime = GetTickCount();
-    double timeDelta = (currentTime - m_lastUpdateTime) / 1000.0; // Convert to seconds
-    
-    if (timeDelta <= 0.0) {
+    static CollectorStats& stats = SelfStats::probe("net.calculate_speeds");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = m_sampleTime;
+    if (currentTime <= m_lastUpdateTime) {
         return;  // Avoid division by zero
     }
+    
+    double timeDelta = (currentTime - m_lastUpdateTime) / 1e6; // Convert to seconds
 
     // Resize previous stats if interface count changed
     if (m_previousStats.size() != m_interfaces.size()) {
         m_previousStats.resize(m_interfaces.size());
         for (size_t i = 0; i < m_interfaces.size(); i++) {
-            m_previousStats[i].bytesReceived = m_interfaces[i].bytesReceived;
-            m_previousStats[i].bytesSent = m_interfaces[i].bytesSent;
-            m_previousStats[i].timestamp = currentTime;
+            storePrevious(i, currentTime);
         }
         m_lastUpdateTime = currentTime;
         return;
@@ -157,25 +187,35 @@ void NetworkMonitor::calculateSpeeds() {
 
     // Calculate speeds for each interface
     for (size_t i = 0; i < m_interfaces.size(); i++) {
-        // Download speed
-        uint64_t receivedDelta = 0;
-        if (m_interfaces[i].bytesReceived >= m_previousStats[i].bytesReceived) {
-            receivedDelta = m_interfaces[i].bytesReceived - m_previousStats[i].bytesReceived;
-        }
-        m_interfaces[i].downloadSpeed = receivedDelta / timeDelta;
-
-        // Upload speed
-        uint64_t sentDelta = 0;
-        if (m_interfaces[i].bytesSent >= m_previousStats[i].bytesSent) {
-            sentDelta = m_interfaces[i].bytesSent - m_previousStats[i].bytesSent;
+        NetworkInterfaceInfo& iface = m_interfaces[i];
+        const PreviousStats& previous = m_previousStats[i];
+        if (previous.name != iface.name) {
+            storePrevious(i, currentTime);  // Another interface took this slot: rates from next update
+            continue;
         }
-        m_interfaces[i].uploadSpeed = sentDelta / timeDelta;
+        iface.downloadSpeed = SystemUtils::calculateRate(iface.bytesReceived, previous.bytesReceived, timeDelta);
+        iface.uploadSpeed = SystemUtils::calculateRate(iface.bytesSent, previous.bytesSent, timeDelta);
+        iface.packetReceiveRate = SystemUtils::calculateRate(iface.packetsReceived, previous.packetsReceived, timeDelta);
+        iface.packetSendRate = SystemUtils::calculateRate(iface.packetsSent, previous.packetsSent, timeDelta);
+        iface.errorRate = SystemUtils::calculateRate(iface.errors, previous.errors, timeDelta);
+        iface.dropRate = SystemUtils::calculateRate(iface.drops, previous.drops, timeDelta);
 
         // Update previous stats
-        m_previousStats[i].bytesReceived = m_interfaces[i].bytesReceived;
-        m_previousStats[i].bytesSent = m_interfaces[i].bytesSent;
-        m_previousStats[i].timestamp = currentTime;
+        storePrevious(i, currentTime);
     }
 
     m_lastUpdateTime = currentTime;
 }
+
+void NetworkMonitor::storePrevious(size_t index, uint64_t timestamp) {
+    const NetworkInterfaceInfo& iface = m_interfaces[index];
+    PreviousStats& previous = m_previousStats[index];
+    previous.name = iface.name;
+    previous.bytesReceived = iface.bytesReceived;
+    previous.bytesSent = iface.bytesSent;
+    previous.packetsReceived = iface.packetsReceived;
+    previous.packetsSent = iface.packetsSent;
+    previous.errors = iface.errors;
+    previous.drops = iface.drops;
+    previous.timestamp = timestamp;
+}
@@ -0,0 +1,223 @@
+#include "monitors/NumaMonitor.h"
+#include "monitors/CPUMonitor.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include <algorithm>
+#include <iostream>
+
+NumaMonitor::NumaMonitor()
+    : NumaMonitor(createDefaultTopologyDataSource())
+{
+}
+
+NumaMonitor::NumaMonitor(std::unique_ptr<TopologyDataSource> source)
+    : m_source(std::move(source))
+    , m_cpuSource(nullptr)
+    , m_initialized(false)
+{
+}
+
+NumaMonitor::~NumaMonitor() {
+}
+
+bool NumaMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No topology data source available" << std::endl;
+        return false;
+    }
+
+    if (!m_source->readTopology(m_topology) || m_topology.cpuCount() == 0) {
+        std::cerr << "Failed to read the CPU topology" << std::endl;
+        return false;
+    }
+
+    m_nodeCpuCounts.assign(m_topology.nodeCount, 0);
+    m_packageCpuCounts.assign(m_topology.packageCount, 0);
+    for (int cpu = 0; cpu < m_topology.cpuCount(); cpu++) {
+        m_nodeCpuCounts[m_topology.node[cpu]]++;
+        m_packageCpuCounts[m_topology.package[cpu]]++;
+    }
+
+    m_nodeCpuUsage.assign(m_topology.nodeCount, 0.0);
+    m_packageCpuUsage.assign(m_topology.packageCount, 0.0);
+    m_remotePercent.assign(m_topology.nodeCount, -1.0);
+    m_nodes.assign(m_topology.nodeCount, NodeMemory());
+    m_previousNodes = m_nodes;
+
+    // Baseline sample for the locality counters
+    m_source->sampleNodes(m_nodes);
+
+    m_initialized = true;
+    return true;
+}
+
+void NumaMonitor::setCpuSource(const CPUMonitor* cpuMonitor) {
+    m_cpuSource = cpuMonitor;
+}
+
+void NumaMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("numa.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+    if (m_cpuSource) {
+        aggregateCpu(*m_cpuSource);
+    }
+}
+
+const CPUTopology& NumaMonitor::getTopology() const {
+    return m_topology;
+}
+
+int NumaMonitor::getNodeCount() const {
+    return m_topology.nodeCount;
+}
+
+int NumaMonitor::getPackageCount() const {
+    return m_topology.packageCount;
+}
+
+int NumaMonitor::getNodeCpuCount(int node) const {
+    if (node < 0 || node >= static_cast<int>(m_nodeCpuCounts.size())) {
+        return 0;
+    }
+    return m_nodeCpuCounts[node];
+}
+
+double NumaMonitor::getNodeCpuUsage(int node) const {
+    if (node < 0 || node >= static_cast<int>(m_nodeCpuUsage.size())) {
+        return 0.0;
+    }
+    return m_nodeCpuUsage[node];
+}
+
+double NumaMonitor::getPackageCpuUsage(int package) const {
+    if (package < 0 || package >= static_cast<int>(m_packageCpuUsage.size())) {
+        return 0.0;
+    }
+    return m_packageCpuUsage[package];
+}
+
+uint64_t NumaMonitor::getNodeTotalMemory(int node) const {
+    if (node < 0 || node >= static_cast<int>(m_nodes.size())) {
+        return 0;
+    }
+    return m_nodes[node].totalPhys;
+}
+
+uint64_t NumaMonitor::getNodeAvailableMemory(int node) const {
+    if (node < 0 || node >= static_cast<int>(m_nodes.size())) {
+        return 0;
+    }
+    return m_nodes[node].availPhys;
+}
+
+double NumaMonitor::getNodeMemoryUsagePercent(int node) const {
+    uint64_t total = getNodeTotalMemory(node);
+    uint64_t available = getNodeAvailableMemory(node);
+    if (total == 0 || available > total) {
+        return 0.0;
+    }
+    return static_cast<double>(total - available) / static_cast<double>(total) * 100.0;
+}
+
+double NumaMonitor::getNodeRemotePercent(int node) const {
+    if (node < 0 || node >= static_cast<int>(m_remotePercent.size())) {
+        return -1.0;
+    }
+    return m_remotePercent[node];
+}
+
+int NumaMonitor::getBusiestNode() const {
+    if (m_nodeCpuUsage.empty()) {
+        return 0;
+    }
+    return static_cast<int>(std::max_element(m_nodeCpuUsage.begin(), m_nodeCpuUsage.end())
+                            - m_nodeCpuUsage.begin());
+}
+
+bool NumaMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* NumaMonitor::name() const {
+    return "numa";
+}
+
+void NumaMonitor::registerSeries(MetricTable& metrics) {
+    m_nodeCpuSeries.clear();
+    m_nodeMemorySeries.clear();
+    for (int i = 0; i < getNodeCount(); i++) {
+        std::string node = std::to_string(i);
+        m_nodeCpuSeries.push_back(metrics.addSeries(MetricId::NumaNodeCpu, node));
+        m_nodeMemorySeries.push_back(metrics.addSeries(MetricId::NumaNodeMemory, node));
+    }
+    m_packageSeries.clear();
+    for (int i = 0; i < getPackageCount(); i++) {
+        m_packageSeries.push_back(metrics.addSeries(MetricId::NumaSocketCpu, std::to_string(i)));
+    }
+}
+
+void NumaMonitor::publish(MetricTable& metrics) {
+    for (size_t i = 0; i < m_nodeCpuSeries.size(); i++) {
+        int node = static_cast<int>(i);
+        metrics.set(m_nodeCpuSeries[i], getNodeCpuUsage(node));
+        metrics.set(m_nodeMemorySeries[i], getNodeMemoryUsagePercent(node));
+    }
+    for (size_t i = 0; i < m_packageSeries.size(); i++) {
+        metrics.set(m_packageSeries[i], getPackageCpuUsage(static_cast<int>(i)));
+    }
+}
+
+void NumaMonitor::aggregateCpu(const CPUMonitor& cpuMonitor) {
+    std::fill(m_nodeCpuUsage.begin(), m_nodeCpuUsage.end(), 0.0);
+    std::fill(m_packageCpuUsage.begin(), m_packageCpuUsage.end(), 0.0);
+
+    const int cpuCount = std::min(m_topology.cpuCount(), cpuMonitor.getCoreCount());
+    for (int cpu = 0; cpu < cpuCount; cpu++) {
+        double usage = cpuMonitor.getCoreUsage(cpu);
+        m_nodeCpuUsage[m_topology.node[cpu]] += usage;
+        m_packageCpuUsage[m_topology.package[cpu]] += usage;
+    }
+
+    for (size_t node = 0; node < m_nodeCpuUsage.size(); node++) {
+        if (m_nodeCpuCounts[node] > 0) {
+            m_nodeCpuUsage[node] /= m_nodeCpuCounts[node];
+        }
+    }
+    for (size_t package = 0; package < m_packageCpuUsage.size(); package++) {
+        if (m_packageCpuCounts[package] > 0) {
+            m_packageCpuUsage[package] /= m_packageCpuCounts[package];
+        }
+    }
+}
+
+void NumaMonitor::collectData() {
+    m_previousNodes = m_nodes;
+    if (!m_source->sampleNodes(m_nodes)) {
+        return;
+    }
+
+    for (size_t node = 0; node < m_nodes.size(); node++) {
+        const NodeMemory& current = m_nodes[node];
+        const NodeMemory& previous = m_previousNodes[node];
+        if (current.localPages == 0 && current.remotePages == 0) {
+            m_remotePercent[node] = -1.0;   // No locality counters
+            continue;
+        }
+
+        uint64_t local = current.localPages >= previous.localPages ? current.localPages - previous.localPages : 0;
+        uint64_t remote = current.remotePages >= previous.remotePages ? current.remotePages - previous.remotePages : 0;
+        m_remotePercent[node] = local + remote > 0
+            ? static_cast<double>(remote) / static_cast<double>(local + remote) * 100.0
+            : 0.0;
+    }
+}
@@ -0,0 +1,211 @@
+#include "monitors/PerfMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <iostream>
+
+// ---------------------------------------------------------------------------
+// PerfCounters
+// ---------------------------------------------------------------------------
+
+PerfCounters::PerfCounters() {
+    for (int e = 0; e < EventCount; e++) {
+        available[e] = false;
+        perCpu[e] = false;
+    }
+}
+
+void PerfCounters::resize(int cpuCount) {
+    for (auto& event : values) {
+        event.assign(cpuCount, 0);
+    }
+}
+
+int PerfCounters::cpuCount() const {
+    return static_cast<int>(values[0].size());
+}
+
+const char* PerfCounters::eventName(Event event) {
+    static const char* const NAMES[EventCount] = {
+        "context_switches", "migrations", "page_faults", "cycles", "instructions", "cache_misses"
+    };
+    if (event < 0 || event >= EventCount) {
+        return "";
+    }
+    return NAMES[event];
+}
+
+// ---------------------------------------------------------------------------
+// PerfMonitor
+// ---------------------------------------------------------------------------
+
+PerfMonitor::PerfMonitor()
+    : PerfMonitor(createDefaultPerfDataSource())
+{
+}
+
+PerfMonitor::PerfMonitor(std::unique_ptr<PerfDataSource> source)
+    : m_source(std::move(source))
+    , m_previousTime(0)
+    , m_initialized(false)
+{
+    for (double& rate : m_totalRates) {
+        rate = 0.0;
+    }
+}
+
+PerfMonitor::~PerfMonitor() {
+}
+
+bool PerfMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No perf data source available" << std::endl;
+        return false;
+    }
+
+    if (!m_source->open(m_previous)) {
+        return false;
+    }
+
+    bool anyAvailable = false;
+    for (int e = 0; e < PerfCounters::EventCount; e++) {
+        anyAvailable = anyAvailable || m_previous.available[e];
+        m_rates[e].assign(m_previous.cpuCount(), 0.0);
+    }
+    if (!anyAvailable) {
+        std::cerr << "No performance events available" << std::endl;
+        return false;
+    }
+
+    m_current = m_previous;
+
+    // Baseline sample: the first update() reports rates since now
+    m_source->sample(m_previous, m_previousTime);
+
+    m_initialized = true;
+    return true;
+}
+
+void PerfMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("perf.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+bool PerfMonitor::isAvailable(PerfCounters::Event event) const {
+    if (!m_initialized || event < 0 || event >= PerfCounters::EventCount) {
+        return false;
+    }
+    return m_previous.available[event];
+}
+
+double PerfMonitor::getRate(PerfCounters::Event event) const {
+    if (!isAvailable(event)) {
+        return 0.0;
+    }
+    return m_totalRates[event];
+}
+
+double PerfMonitor::getCpuRate(PerfCounters::Event event, int cpu) const {
+    if (!isAvailable(event) || !m_previous.perCpu[event] || cpu < 0 || cpu >= getCpuCount()) {
+        return 0.0;
+    }
+    return m_rates[event][cpu];
+}
+
+double PerfMonitor::getIpc() const {
+    if (!isAvailable(PerfCounters::Instructions) || !isAvailable(PerfCounters::Cycles)) {
+        return -1.0;
+    }
+    double cycles = m_totalRates[PerfCounters::Cycles];
+    return cycles > 0.0 ? m_totalRates[PerfCounters::Instructions] / cycles : 0.0;
+}
+
+double PerfMonitor::getCpuIpc(int cpu) const {
+    if (!isAvailable(PerfCounters::Instructions) || !isAvailable(PerfCounters::Cycles)
+        || !m_previous.perCpu[PerfCounters::Instructions] || cpu < 0 || cpu >= getCpuCount()) {
+        return -1.0;
+    }
+    double cycles = m_rates[PerfCounters::Cycles][cpu];
+    return cycles > 0.0 ? m_rates[PerfCounters::Instructions][cpu] / cycles : 0.0;
+}
+
+int PerfMonitor::getCpuCount() const {
+    return m_previous.cpuCount();
+}
+
+bool PerfMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* PerfMonitor::name() const {
+    return "perf";
+}
+
+void PerfMonitor::registerSeries(MetricTable& metrics) {
+    // Perf events are optional; only counted events get a series
+    // and set() ignores the metrics left unregistered
+    auto addSeries = [this, &metrics](PerfCounters::Event event, MetricId metric) {
+        if (isAvailable(event)) {
+            metrics.addSeries(metric);
+        }
+    };
+    addSeries(PerfCounters::ContextSwitches, MetricId::PerfContextSwitches);
+    addSeries(PerfCounters::PageFaults, MetricId::PerfPageFaults);
+    addSeries(PerfCounters::Migrations, MetricId::PerfMigrations);
+    if (isAvailable(PerfCounters::Cycles) && isAvailable(PerfCounters::Instructions)) {
+        metrics.addSeries(MetricId::PerfIpc);
+    }
+}
+
+void PerfMonitor::publish(MetricTable& metrics) {
+    metrics.set(MetricId::PerfContextSwitches, getRate(PerfCounters::ContextSwitches));
+    metrics.set(MetricId::PerfPageFaults, getRate(PerfCounters::PageFaults));
+    metrics.set(MetricId::PerfMigrations, getRate(PerfCounters::Migrations));
+    if (getIpc() >= 0.0) {
+        metrics.set(MetricId::PerfIpc, getIpc());
+    }
+}
+
+void PerfMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("perf.collect_data");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = 0;
+    if (!m_source->sample(m_current, currentTime)) {
+        return;
+    }
+
+    const int cpuCount = getCpuCount();
+    double elapsedSec = currentTime > m_previousTime
+        ? static_cast<double>(currentTime - m_previousTime) / 1e6
+        : 0.0;
+
+    for (int e = 0; e < PerfCounters::EventCount; e++) {
+        const uint64_t* current = m_current.values[e].data();
+        const uint64_t* previous = m_previous.values[e].data();
+        double* rates = m_rates[e].data();
+        double total = 0.0;
+
+        // System-wide events only use the first slot
+        int count = m_current.perCpu[e] ? cpuCount : (cpuCount > 0 ? 1 : 0);
+        for (int cpu = 0; cpu < count; cpu++) {
+            rates[cpu] = SystemUtils::calculateRate(current[cpu], previous[cpu], elapsedSec);
+            total += rates[cpu];
+        }
+        m_totalRates[e] = total;
+    }
+
+    std::swap(m_previous, m_current);
+    m_previousTime = currentTime;
+}
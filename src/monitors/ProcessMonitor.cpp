@@ -0,0 +1,389 @@
+#include "monitors/ProcessMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+ProcessMonitor::ProcessMonitor()
+    : ProcessMonitor(createDefaultProcessDataSource())
+{
+}
+
+ProcessMonitor::ProcessMonitor(std::unique_ptr<ProcessDataSource> source)
+    : m_source(std::move(source))
+    , m_exitRate(0.0)
+    , m_exitedCpuRate(0.0)
+    , m_totalReadRate(0.0)
+    , m_totalWriteRate(0.0)
+    , m_previousTime(0)
+    , m_memoryBudget(DEFAULT_MEMORY_BUDGET_US)
+    , m_memoryRefreshes(0)
+    , m_memoryBacklog(0)
+    , m_topCount(DEFAULT_TOP_COUNT)
+    , m_eventDriven(false)
+    , m_initialized(false)
+{
+}
+
+ProcessMonitor::~ProcessMonitor() {
+}
+
+bool ProcessMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No process data source available" << std::endl;
+        return false;
+    }
+
+    m_eventDriven = m_source->openEvents();
+
+    // Baseline sample: the first update() reports rates since now
+    if (!m_source->sample(m_previous, m_previousTime)) {
+        return false;
+    }
+    m_source->drainExits(m_exits);
+
+    m_initialized = true;
+    return true;
+}
+
+void ProcessMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("process.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+void ProcessMonitor::setTopCount(int count) {
+    m_topCount = count > 0 ? count : 0;
+}
+
+size_t ProcessMonitor::getProcessCount() const {
+    return m_previous.size();
+}
+
+const std::vector<ProcessIoInfo>& ProcessMonitor::getTopReaders() const {
+    return m_topReaders;
+}
+
+const std::vector<ProcessIoInfo>& ProcessMonitor::getTopWriters() const {
+    return m_topWriters;
+}
+
+double ProcessMonitor::getTotalReadRate() const {
+    return m_totalReadRate;
+}
+
+double ProcessMonitor::getTotalWriteRate() const {
+    return m_totalWriteRate;
+}
+
+void ProcessMonitor::setMemoryBudget(uint64_t budgetMicros) {
+    m_memoryBudget = budgetMicros;
+}
+
+const std::vector<ProcessMemoryInfo>& ProcessMonitor::getTopMemory() const {
+    return m_topMemory;
+}
+
+int ProcessMonitor::getMemoryRefreshCount() const {
+    return m_memoryRefreshes;
+}
+
+int ProcessMonitor::getMemoryBacklog() const {
+    return m_memoryBacklog;
+}
+
+bool ProcessMonitor::isEventDriven() const {
+    return m_eventDriven;
+}
+
+double ProcessMonitor::getExitRate() const {
+    return m_exitRate;
+}
+
+double ProcessMonitor::getExitedCpuRate() const {
+    return m_exitedCpuRate;
+}
+
+const std::deque<ProcessExit>& ProcessMonitor::getRecentExits() const {
+    return m_recentExits;
+}
+
+bool ProcessMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* ProcessMonitor::name() const {
+    return "processes";
+}
+
+void ProcessMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::ProcessRead);
+    metrics.addSeries(MetricId::ProcessWrite);
+    metrics.addSeries(MetricId::ProcessExits);
+    metrics.addSeries(MetricId::ProcessExitedCpu);
+}
+
+void ProcessMonitor::publish(MetricTable& metrics) {
+    if (!m_initialized) {
+        return;
+    }
+    metrics.set(MetricId::ProcessRead, m_totalReadRate);
+    metrics.set(MetricId::ProcessWrite, m_totalWriteRate);
+    metrics.set(MetricId::ProcessExits, m_exitRate);
+    metrics.set(MetricId::ProcessExitedCpu, m_exitedCpuRate);
+}
+
+void ProcessMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = 0;
+    if (!m_source->sample(m_current, currentTime) || currentTime <= m_previousTime) {
+        return;
+    }
+    double elapsedSec = static_cast<double>(currentTime - m_previousTime) / 1e6;
+
+    const size_t rows = m_current.size();
+    m_rates.resize(rows);
+    m_totalReadRate = 0.0;
+    m_totalWriteRate = 0.0;
+
+    // Merge the two PID-sorted samples; a new process counts from zero
+    auto rate = [elapsedSec](uint64_t current, uint64_t previous) {
+        return current >= previous ? static_cast<double>(current - previous) / elapsedSec : 0.0;
+    };
+    size_t p = 0;
+    for (size_t row = 0; row < rows; row++) {
+        const ProcessCounters& current = m_current[row];
+        while (p < m_previous.size() && m_previous[p].pid < current.pid) {
+            p++;
+        }
+        ProcessCounters previous = {current.pid, 0, 0, 0, 0, 0, 0};
+        if (p < m_previous.size() && m_previous[p].pid == current.pid) {
+            previous = m_previous[p];
+        }
+
+        ProcessIoInfo& info = m_rates[row];
+        info.pid = current.pid;
+        info.name = NameTable::EMPTY;   // Named only if ranked
+        info.readRate = rate(current.readBytes, previous.readBytes);
+        info.writeRate = rate(current.writeBytes, previous.writeBytes);
+        info.readOpsRate = rate(current.readOps, previous.readOps);
+        info.writeOpsRate = rate(current.writeOps, previous.writeOps);
+        m_totalReadRate += info.readRate;
+        m_totalWriteRate += info.writeRate;
+    }
+
+    attributeExits(elapsedSec);
+
+    rank(&ProcessIoInfo::readRate, m_topReaders);
+    rank(&ProcessIoInfo::writeRate, m_topWriters);
+    refreshMemory(currentTime / 1000);
+    rankMemory(currentTime / 1000);
+
+    std::swap(m_previous, m_current);
+    std::swap(m_memory, m_nextMemory);
+    m_previousTime = currentTime;
+}
+
+void ProcessMonitor::rank(double ProcessIoInfo::*rate, std::vector<ProcessIoInfo>& top) {
+    const size_t rows = m_rates.size();
+    m_ranking.resize(rows);
+    for (uint32_t row = 0; row < rows; row++) {
+        m_ranking[row] = row;
+    }
+    size_t keep = std::min(rows, static_cast<size_t>(m_topCount));
+    std::partial_sort(m_ranking.begin(), m_ranking.begin() + keep, m_ranking.end(), [this, rate](uint32_t a, uint32_t b) {
+        return m_rates[a].*rate > m_rates[b].*rate;
+    });
+
+    top.clear();
+    for (size_t i = 0; i < keep; i++) {
+        const ProcessIoInfo& info = m_rates[m_ranking[i]];
+        if (info.*rate <= 0.0) {
+            break;  // Idle processes are not listed
+        }
+        top.push_back(info);
+        if (top.back().name == NameTable::EMPTY) {
+            top.back().name = m_source->processName(info.pid);
+        }
+    }
+}
+
+void ProcessMonitor::attributeExits(double elapsedSec) {
+    static CollectorStats& stats = SelfStats::probe("process.attribute_exits");
+    ScopedTimer timer(stats);
+
+    // Exits deferred by the previous sample are past their last live row
+    std::swap(m_exits, m_deferredExits);
+    m_deferredExits.clear();
+    m_source->drainExits(m_drained);
+    for (const ProcessExit& exit : m_drained) {
+        auto it = std::lower_bound(m_current.begin(), m_current.end(), exit.pid,
+                                   [](const ProcessCounters& counters, uint32_t pid) {
+            return counters.pid < pid;
+        });
+        if (it != m_current.end() && it->pid == exit.pid) {
+            m_deferredExits.push_back(exit);
+        } else {
+            m_exits.push_back(exit);
+        }
+    }
+
+    auto rate = [elapsedSec](uint64_t total, uint64_t seen) {
+        return total > seen ? static_cast<double>(total - seen) / elapsedSec : 0.0;
+    };
+    double cpuRate = 0.0;
+    for (const ProcessExit& exit : m_exits) {
+        // Only the part the previous sample has not seen belongs to this interval
+        ProcessCounters seen = {exit.pid, 0, 0, 0, 0, 0, 0};
+        auto it = std::lower_bound(m_previous.begin(), m_previous.end(), exit.pid,
+                                   [](const ProcessCounters& counters, uint32_t pid) {
+            return counters.pid < pid;
+        });
+        if (it != m_previous.end() && it->pid == exit.pid) {
+            seen = *it;
+        }
+
+        // Ranked with the live processes, so a short burst still makes the top lists
+        ProcessIoInfo info;
+        info.pid = exit.pid;
+        info.name = exit.name;
+        info.readRate = rate(exit.readBytes, seen.readBytes);
+        info.writeRate = rate(exit.writeBytes, seen.writeBytes);
+        info.readOpsRate = 0.0;
+        info.writeOpsRate = 0.0;
+        m_totalReadRate += info.readRate;
+        m_totalWriteRate += info.writeRate;
+        m_rates.push_back(info);
+
+        cpuRate += rate(exit.cpuMicros, seen.cpuMicros) / 1e6;
+
+        m_recentExits.push_front(exit);
+        if (m_recentExits.size() > RECENT_EXIT_COUNT) {
+            m_recentExits.pop_back();
+        }
+    }
+
+    m_exitRate = static_cast<double>(m_exits.size()) / elapsedSec;
+    m_exitedCpuRate = cpuRate;
+}
+
+void ProcessMonitor::refreshMemory(uint64_t nowMs) {
+    static CollectorStats& stats = SelfStats::probe("process.refresh_memory");
+    ScopedTimer timer(stats);
+
+    auto moved = [](uint64_t resident, uint64_t walked) {
+        return resident * 100 > walked * (100 + MEMORY_CHANGE_PERCENT)
+            || resident * 100 < walked * (100 - MEMORY_CHANGE_PERCENT);
+    };
+
+    // Carry the schedule over by PID and collect the due walks:
+    // new > moved > overdue, heaviest first within each class
+    const uint64_t pageMask = (1ULL << 60) - 1;
+    m_nextMemory.clear();
+    m_due.clear();
+    size_t p = 0;
+    for (size_t row = 0; row < m_current.size(); row++) {
+        const ProcessCounters& current = m_current[row];
+        while (p < m_memory.size() && m_memory[p].pid < current.pid) {
+            p++;
+        }
+        MemoryState state = {current.pid, {0, 0, 0, 0}, 0, MIN_MEMORY_INTERVAL_MS, 0, false};
+        if (p < m_memory.size() && m_memory[p].pid == current.pid) {
+            state = m_memory[p];
+        }
+
+        uint64_t urgency = 0;
+        if (m_memoryBudget == 0) {
+            urgency = 0;        // Walks disabled
+        } else if (state.refreshedMs == 0) {
+            urgency = 3;
+        } else if (state.detailed && moved(current.residentBytes, state.walkedResident)) {
+            urgency = 2;
+        } else if (nowMs - state.refreshedMs >= state.intervalMs) {
+            urgency = 1;
+        }
+        if (urgency > 0) {
+            uint64_t pages = std::min(current.residentBytes >> 12, pageMask);
+            m_due.emplace_back(urgency << 60 | pages, static_cast<uint32_t>(row));
+        }
+        m_nextMemory.push_back(state);
+    }
+    std::sort(m_due.begin(), m_due.end(), [](const std::pair<uint64_t, uint32_t>& a, const std::pair<uint64_t, uint32_t>& b) {
+        return a.first > b.first;
+    });
+
+    // Walk in priority order until the budget is spent
+    const auto start = std::chrono::steady_clock::now();
+    size_t walked = 0;
+    for (; walked < m_due.size(); walked++) {
+        auto spent = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        if (walked > 0 && static_cast<uint64_t>(spent.count()) >= m_memoryBudget) {
+            break;
+        }
+
+        uint32_t row = m_due[walked].second;
+        uint64_t resident = m_current[row].residentBytes;
+        MemoryState& state = m_nextMemory[row];
+        bool first = state.refreshedMs == 0;
+        bool changed = state.detailed && moved(resident, state.walkedResident);
+
+        if (m_source->readMemory(state.pid, state.memory)) {
+            // Stable processes back off; heavy ones never back off far
+            uint64_t cap = resident >= HEAVY_MEMORY_BYTES ? HEAVY_MEMORY_INTERVAL_MS : MAX_MEMORY_INTERVAL_MS;
+            state.intervalMs = first || changed ? MIN_MEMORY_INTERVAL_MS : std::min(state.intervalMs * 2, cap);
+            state.walkedResident = resident;
+            state.detailed = true;
+        } else {
+            state.intervalMs = MAX_MEMORY_INTERVAL_MS;  // Access denied: retry rarely
+            state.detailed = false;
+        }
+        state.refreshedMs = nowMs;
+    }
+
+    m_memoryRefreshes = static_cast<int>(walked);
+    m_memoryBacklog = static_cast<int>(m_due.size() - walked);
+}
+
+void ProcessMonitor::rankMemory(uint64_t nowMs) {
+    auto size = [this](uint32_t row) {
+        const MemoryState& state = m_nextMemory[row];
+        return state.detailed ? state.memory.proportional : m_current[row].residentBytes;
+    };
+
+    const size_t rows = m_current.size();
+    m_ranking.resize(rows);
+    for (uint32_t row = 0; row < rows; row++) {
+        m_ranking[row] = row;
+    }
+    size_t keep = std::min(rows, static_cast<size_t>(m_topCount));
+    std::partial_sort(m_ranking.begin(), m_ranking.begin() + keep, m_ranking.end(), [&size](uint32_t a, uint32_t b) {
+        return size(a) > size(b);
+    });
+
+    m_topMemory.clear();
+    for (size_t i = 0; i < keep; i++) {
+        uint32_t row = m_ranking[i];
+        const MemoryState& state = m_nextMemory[row];
+        ProcessMemoryInfo info;
+        info.pid = state.pid;
+        info.name = m_source->processName(state.pid);
+        info.memory = state.detailed ? state.memory : ProcessMemory{0, 0, 0, 0};
+        info.memory.resident = m_current[row].residentBytes;    // Cheap figure is always fresh
+        info.detailed = state.detailed;
+        info.ageMs = state.detailed ? nowMs - state.refreshedMs : 0;
+        m_topMemory.push_back(info);
+    }
+}
@@ -1,10 +1,18 @@
 #include "monitors/RAMMonitor.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
 #include <iostream>
 
 RAMMonitor::RAMMonitor()
-    : m_initialized(false)
+    : RAMMonitor(createDefaultMemoryDataSource())
+{
+}
+
+RAMMonitor::RAMMonitor(std::unique_ptr<MemoryDataSource> source)
+    : m_source(std::move(source))
+    , m_memInfo{}
+    , m_initialized(false)
 {
-    m_memInfo.dwLength = sizeof(MEMORYSTATUSEX);
 }
 
 RAMMonitor::~RAMMonitor() {
@@ -16,9 +24,14 @@ bool RAMMonitor::initialize() {
         return true;
     }
 
+    if (!m_source) {
+        std::cerr << "No memory data source available" << std::endl;
+        return false;
+    }
+
     // Try to get initial memory status
-    if (!GlobalMemoryStatusEx(&m_memInfo)) {
-        std::cerr << "Failed to get memory status. Error: " << GetLastError() << std::endl;
+    if (!m_source->sample(m_memInfo)) {
+        std::cerr << "Failed to get memory status" << std::endl;
         return false;
     }
 
@@ -31,44 +44,63 @@ void RAMMonitor::update() {
         return;
     }
 
+    static CollectorStats& stats = SelfStats::probe("ram.update");
+    ScopedTimer timer(stats);
+
     collectData();
 }
 
 uint64_t RAMMonitor::getTotalPhysicalMemory() const {
-    return m_memInfo.ullTotalPhys;
+    return m_memInfo.totalPhys;
 }
 
 uint64_t RAMMonitor::getAvailablePhysicalMemory() const {
-    return m_memInfo.ullAvailPhys;
+    return m_memInfo.availPhys;
 }
 
 uint64_t RAMMonitor::getUsedPhysicalMemory() const {
-    return m_memInfo.ullTotalPhys - m_memInfo.ullAvailPhys;
+    return m_memInfo.totalPhys - m_memInfo.availPhys;
 }
 
 double RAMMonitor::getMemoryUsagePercent() const {
-    return static_cast<double>(m_memInfo.dwMemoryLoad);
+    return static_cast<double>(m_memInfo.memoryLoad);
 }
 
 uint64_t RAMMonitor::getTotalVirtualMemory() const {
-    return m_memInfo.ullTotalPageFile;
+    return m_memInfo.totalPageFile;
 }
 
 uint64_t RAMMonitor::getAvailableVirtualMemory() const {
-    return m_memInfo.ullAvailPageFile;
+    return m_memInfo.availPageFile;
 }
 
 uint64_t RAMMonitor::getUsedVirtualMemory() const {
-    return m_memInfo.ullTotalPageFile - m_memInfo.ullAvailPageFile;
+    return m_memInfo.totalPageFile - m_memInfo.availPageFile;
 }
 
 bool RAMMonitor::isInitialized() const {
     return m_initialized;
 }
 
+const char* RAMMonitor::name() const {
+    return "ram";
+}
+
+void RAMMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::RamUsage);
+}
+
+void RAMMonitor::publish(MetricTable& metrics) {
+    metrics.set(MetricId::RamUsage, getMemoryUsagePercent());
+}
+
 void RAMMonitor::collectData() {
-    // Update memory information
-    if (!GlobalMemoryStatusEx(&m_memInfo)) {
-        std::cerr << "Failed to collect memory data. Error: " << GetLastError() << std::endl;
+    static CollectorStats& stats = SelfStats::probe("ram.collect_data");
+    ScopedTimer timer(stats);
+
+    // Update memory information (keeps the previous status on failure)
+    MemoryStatus status;
+    if (m_source->sample(status)) {
+        m_memInfo = status;
     }
 }
@@ -0,0 +1,249 @@
+#include "monitors/SchedMonitor.h"
+#include "monitors/DataSources.h"
+#include "core/MetricTable.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <iostream>
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    /**
+     * @brief Parse an unsigned decimal number and advance past it
+     * @return false if the cursor is not on a digit
+     */
+    bool parseNumber(const char*& cursor, const char* end, uint64_t& value) {
+        while (cursor < end && isSpace(*cursor)) {
+            cursor++;
+        }
+        if (cursor >= end || !isDigit(*cursor)) {
+            return false;
+        }
+        value = 0;
+        while (cursor < end && isDigit(*cursor)) {
+            value = value * 10 + static_cast<uint64_t>(*cursor - '0');
+            cursor++;
+        }
+        return true;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// SchedCounters
+// ---------------------------------------------------------------------------
+
+SchedCounters::SchedCounters()
+    : waitPerCpu(true)
+{
+}
+
+void SchedCounters::resize(int cpuCount) {
+    waitNs.assign(cpuCount, 0);
+    timeslices.assign(cpuCount, 0);
+}
+
+int SchedCounters::cpuCount() const {
+    return static_cast<int>(timeslices.size());
+}
+
+// ---------------------------------------------------------------------------
+// SchedMonitor
+// ---------------------------------------------------------------------------
+
+SchedMonitor::SchedMonitor()
+    : SchedMonitor(createDefaultSchedDataSource())
+{
+}
+
+SchedMonitor::SchedMonitor(std::unique_ptr<SchedDataSource> source)
+    : m_source(std::move(source))
+    , m_waitPercent(0.0)
+    , m_timesliceRate(0.0)
+    , m_waitPerTimeslice(0.0)
+    , m_previousTime(0)
+    , m_initialized(false)
+{
+}
+
+SchedMonitor::~SchedMonitor() {
+}
+
+bool SchedMonitor::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_source) {
+        std::cerr << "No scheduler data source available" << std::endl;
+        return false;
+    }
+
+    if (!m_source->open(m_previous) || m_previous.cpuCount() == 0) {
+        return false;
+    }
+
+    m_current = m_previous;
+    m_waitPercents.assign(m_previous.cpuCount(), 0.0);
+    m_timesliceRates.assign(m_previous.cpuCount(), 0.0);
+
+    // Baseline sample: the first update() reports rates since now
+    m_source->sample(m_previous, m_previousTime);
+
+    m_initialized = true;
+    return true;
+}
+
+void SchedMonitor::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("sched.update");
+    ScopedTimer timer(stats);
+
+    collectData();
+}
+
+int SchedMonitor::getCpuCount() const {
+    return static_cast<int>(m_timesliceRates.size());
+}
+
+bool SchedMonitor::hasPerCpuWait() const {
+    return m_previous.waitPerCpu;
+}
+
+double SchedMonitor::getCpuWaitPercent(int cpu) const {
+    if (!hasPerCpuWait() || cpu < 0 || cpu >= getCpuCount()) {
+        return 0.0;
+    }
+    return m_waitPercents[cpu];
+}
+
+double SchedMonitor::getWaitPercent() const {
+    return m_waitPercent;
+}
+
+double SchedMonitor::getCpuTimesliceRate(int cpu) const {
+    if (cpu < 0 || cpu >= getCpuCount()) {
+        return 0.0;
+    }
+    return m_timesliceRates[cpu];
+}
+
+double SchedMonitor::getTimesliceRate() const {
+    return m_timesliceRate;
+}
+
+double SchedMonitor::getWaitPerTimesliceMicros() const {
+    return m_waitPerTimeslice;
+}
+
+bool SchedMonitor::isInitialized() const {
+    return m_initialized;
+}
+
+const char* SchedMonitor::name() const {
+    return "sched";
+}
+
+void SchedMonitor::registerSeries(MetricTable& metrics) {
+    metrics.addSeries(MetricId::SchedWait);
+    metrics.addSeries(MetricId::SchedTimeslices);
+    metrics.addSeries(MetricId::SchedWaitPerTimeslice);
+}
+
+void SchedMonitor::publish(MetricTable& metrics) {
+    if (!m_initialized) {
+        return;
+    }
+    metrics.set(MetricId::SchedWait, getWaitPercent());
+    metrics.set(MetricId::SchedTimeslices, getTimesliceRate());
+    metrics.set(MetricId::SchedWaitPerTimeslice, getWaitPerTimesliceMicros());
+}
+
+bool SchedMonitor::parseSchedstat(const std::string& text, SchedCounters& counters) {
+    const char* cursor = text.c_str();
+    const char* end = cursor + text.size();
+    const bool sized = counters.cpuCount() > 0;
+    bool found = false;
+
+    while (cursor < end) {
+        const char* lineEnd = cursor;
+        while (lineEnd < end && *lineEnd != '\n') {
+            lineEnd++;
+        }
+
+        // "cpu<N> <f1> ... <f9>"
+        uint64_t cpu = 0;
+        if (lineEnd - cursor > 3 && cursor[0] == 'c' && cursor[1] == 'p' && cursor[2] == 'u') {
+            const char* field = cursor + 3;
+            uint64_t values[9];
+            int count = 0;
+            if (parseNumber(field, lineEnd, cpu)) {
+                while (count < 9 && parseNumber(field, lineEnd, values[count])) {
+                    count++;
+                }
+            }
+
+            if (count == 9) {
+                found = true;
+                if (!sized && cpu >= static_cast<uint64_t>(counters.cpuCount())) {
+                    counters.waitNs.resize(cpu + 1, 0);
+                    counters.timeslices.resize(cpu + 1, 0);
+                }
+                if (cpu < static_cast<uint64_t>(counters.cpuCount())) {
+                    counters.waitNs[cpu] = values[7];
+                    counters.timeslices[cpu] = values[8];
+                }
+            }
+        }
+
+        cursor = lineEnd < end ? lineEnd + 1 : end;
+    }
+
+    return found;
+}
+
+void SchedMonitor::collectData() {
+    static CollectorStats& stats = SelfStats::probe("sched.collect_data");
+    ScopedTimer timer(stats);
+
+    uint64_t currentTime = 0;
+    if (!m_source->sample(m_current, currentTime)) {
+        return;
+    }
+
+    const int cpuCount = getCpuCount();
+    double elapsedSec = currentTime > m_previousTime
+        ? static_cast<double>(currentTime - m_previousTime) / 1e6
+        : 0.0;
+
+    // Waiting nanoseconds per second of interval, as a percentage
+    const double nsToPercent = 100.0 / 1e9;
+    double waitNsRate = 0.0;
+    m_timesliceRate = 0.0;
+    for (int cpu = 0; cpu < cpuCount; cpu++) {
+        double waitRate = 0.0;
+        if (m_current.waitPerCpu || cpu == 0) {
+            waitRate = SystemUtils::calculateRate(m_current.waitNs[cpu], m_previous.waitNs[cpu], elapsedSec);
+        }
+        m_waitPercents[cpu] = waitRate * nsToPercent;
+        waitNsRate += waitRate;
+
+        m_timesliceRates[cpu] = SystemUtils::calculateRate(
+            m_current.timeslices[cpu], m_previous.timeslices[cpu], elapsedSec);
+        m_timesliceRate += m_timesliceRates[cpu];
+    }
+
+    m_waitPercent = cpuCount > 0 ? waitNsRate * nsToPercent / cpuCount : 0.0;
+    m_waitPerTimeslice = m_timesliceRate > 0.0 ? waitNsRate / m_timesliceRate / 1000.0 : 0.0;
+
+    std::swap(m_previous, m_current);
+    m_previousTime = currentTime;
+}
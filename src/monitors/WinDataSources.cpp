@@ -0,0 +1,1683 @@
+#include "monitors/WinDataSources.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <iphlpapi.h>
+#include <powerbase.h>
+#include <psapi.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#pragma comment(lib, "pdh.lib")
+#pragma comment(lib, "iphlpapi.lib")
+#pragma comment(lib, "powrprof.lib")
+#pragma comment(lib, "psapi.lib")
+#pragma comment(lib, "advapi32.lib")
+
+// ---------------------------------------------------------------------------
+// CPU
+// ---------------------------------------------------------------------------
+
+namespace {
+    // SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION with the fields winternl.h
+    // leaves as Reserved spelled out
+    struct ProcessorPerformanceInformation {
+        LARGE_INTEGER IdleTime;
+        LARGE_INTEGER KernelTime;           // Includes idle, DPC and interrupt time
+        LARGE_INTEGER UserTime;
+        LARGE_INTEGER DpcTime;
+        LARGE_INTEGER InterruptTime;
+        ULONG InterruptCount;
+    };
+
+    // SYSTEM_INTERRUPT_INFORMATION (winternl.h: Reserved1[24])
+    struct InterruptInformation {
+        ULONG ContextSwitches;
+        ULONG DpcCount;
+        ULONG DpcRate;
+        ULONG TimeIncrement;
+        ULONG DpcBypassCount;
+        ULONG ApcBypassCount;
+    };
+
+    constexpr ULONG SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION_CLASS = 8;
+    constexpr ULONG SYSTEM_INTERRUPT_INFORMATION_CLASS = 23;
+
+    // A processor group holds at most 64 logical processors
+    constexpr size_t MAX_GROUP_PROCESSORS = 64;
+
+    typedef LONG (WINAPI *NtQuerySystemInformationFn)(ULONG, PVOID, ULONG, PULONG);
+    typedef LONG (WINAPI *NtQuerySystemInformationExFn)(ULONG, PVOID, ULONG, PVOID, ULONG, PULONG);
+
+    uint64_t counterValue(const LARGE_INTEGER& value) {
+        return value.QuadPart > 0 ? static_cast<uint64_t>(value.QuadPart) : 0;
+    }
+
+    /**
+     * @brief Extend a 32-bit OS counter to 64 bits
+     * @param wide Running 64-bit value
+     * @param last Last raw value
+     * @param raw Current raw value
+     * @return Updated 64-bit value
+     */
+    uint64_t widenCounter(uint64_t& wide, ULONG& last, ULONG raw) {
+        // Unsigned subtraction absorbs a single wrap between two samples
+        wide += static_cast<ULONG>(raw - last);
+        last = raw;
+        return wide;
+    }
+}
+
+ProcessorGroupQuery::ProcessorGroupQuery()
+    : m_query(nullptr)
+    , m_queryEx(nullptr)
+{
+}
+
+bool ProcessorGroupQuery::open() {
+    HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
+    if (ntdll) {
+        m_query = GetProcAddress(ntdll, "NtQuerySystemInformation");
+        m_queryEx = GetProcAddress(ntdll, "NtQuerySystemInformationEx");
+    }
+
+    if (!m_query) {
+        std::cerr << "NtQuerySystemInformation is not available" << std::endl;
+        return false;
+    }
+
+    // Without the Ex variant only the caller's processor group is visible
+    m_groupSizes.clear();
+    if (m_queryEx) {
+        WORD groupCount = GetActiveProcessorGroupCount();
+        for (WORD group = 0; group < groupCount; group++) {
+            m_groupSizes.push_back(static_cast<WORD>(GetActiveProcessorCount(group)));
+        }
+    } else {
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        m_groupSizes.push_back(static_cast<WORD>(sysInfo.dwNumberOfProcessors));
+    }
+
+    return processorCount() > 0;
+}
+
+int ProcessorGroupQuery::processorCount() const {
+    int count = 0;
+    for (WORD size : m_groupSizes) {
+        count += size;
+    }
+    return count;
+}
+
+size_t ProcessorGroupQuery::groupCount() const {
+    return m_groupSizes.size();
+}
+
+bool ProcessorGroupQuery::query(ULONG infoClass, size_t group, size_t recordSize,
+                                std::vector<unsigned char>& buffer, size_t& recordCount) const {
+    buffer.resize(MAX_GROUP_PROCESSORS * recordSize);
+    ULONG length = static_cast<ULONG>(buffer.size());
+    ULONG returned = 0;
+    LONG status;
+
+    if (m_queryEx) {
+        USHORT groupNumber = static_cast<USHORT>(group);
+        status = reinterpret_cast<NtQuerySystemInformationExFn>(m_queryEx)(
+            infoClass, &groupNumber, sizeof(groupNumber), buffer.data(), length, &returned);
+    } else {
+        status = reinterpret_cast<NtQuerySystemInformationFn>(m_query)(
+            infoClass, buffer.data(), length, &returned);
+    }
+
+    if (status < 0) {
+        std::cerr << "Failed to query system information class " << infoClass
+                  << ". Status: " << status << std::endl;
+        recordCount = 0;
+        return false;
+    }
+
+    recordCount = returned / recordSize;
+    return true;
+}
+
+bool WinCPUDataSource::open(int& coreCount) {
+    if (!m_processors.open()) {
+        return false;
+    }
+    coreCount = m_processors.processorCount();
+    return true;
+}
+
+bool WinCPUDataSource::sample(CPUTimes& times) {
+    static CollectorStats& stats = SelfStats::probe("cpu.collect_data");
+
+    const int coreCount = times.coreCount();
+    int core = 0;
+
+    for (size_t group = 0; group < m_processors.groupCount(); group++) {
+        size_t recordCount = 0;
+        bool ok = m_processors.query(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION_CLASS, group,
+                                     sizeof(ProcessorPerformanceInformation), m_buffer, recordCount);
+
+        stats.addSyscalls(1);
+        stats.addBytesRead(recordCount * sizeof(ProcessorPerformanceInformation));
+
+        if (!ok) {
+            return false;
+        }
+
+        const auto* records = reinterpret_cast<const ProcessorPerformanceInformation*>(m_buffer.data());
+        for (size_t i = 0; i < recordCount && core < coreCount; i++, core++) {
+            const auto& record = records[i];
+            uint64_t idle = counterValue(record.IdleTime);
+            uint64_t kernel = counterValue(record.KernelTime);
+            uint64_t dpc = counterValue(record.DpcTime);
+            uint64_t interrupt = counterValue(record.InterruptTime);
+            uint64_t overhead = idle + dpc + interrupt;
+
+            times.columns[CPUTimes::User][core] = counterValue(record.UserTime);
+            times.columns[CPUTimes::System][core] = kernel > overhead ? kernel - overhead : 0;
+            times.columns[CPUTimes::Idle][core] = idle;
+            times.columns[CPUTimes::Irq][core] = interrupt;
+            times.columns[CPUTimes::SoftIrq][core] = dpc;
+        }
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Thermals
+// ---------------------------------------------------------------------------
+
+namespace {
+    // PROCESSOR_POWER_INFORMATION is documented but not declared in the SDK
+    struct ProcessorPowerInformation {
+        ULONG Number;
+        ULONG MaxMhz;
+        ULONG CurrentMhz;
+        ULONG MhzLimit;
+        ULONG MaxIdleState;
+        ULONG CurrentIdleState;
+    };
+}
+
+WinThermalDataSource::WinThermalDataSource()
+    : m_query(nullptr)
+    , m_temperatureCounter(nullptr)
+{
+}
+
+WinThermalDataSource::~WinThermalDataSource() {
+    if (m_query) {
+        PdhCloseQuery(m_query);
+    }
+}
+
+bool WinThermalDataSource::open(int coreCount) {
+    m_powerBuffer.resize(static_cast<size_t>(coreCount) * sizeof(ProcessorPowerInformation));
+    LONG status = CallNtPowerInformation(ProcessorInformation, nullptr, 0,
+                                         m_powerBuffer.data(), static_cast<ULONG>(m_powerBuffer.size()));
+    if (status != 0) {
+        std::cerr << "Failed to query processor power information. Status: " << status << std::endl;
+        return false;
+    }
+
+    // Thermal zones are optional (many desktops expose none)
+    if (PdhOpenQuery(nullptr, 0, &m_query) == ERROR_SUCCESS) {
+        if (PdhAddEnglishCounterW(m_query, L"\\Thermal Zone Information(*)\\Temperature", 0,
+                                  &m_temperatureCounter) != ERROR_SUCCESS) {
+            m_temperatureCounter = nullptr;
+        }
+        PdhCollectQueryData(m_query);
+    }
+    return true;
+}
+
+bool WinThermalDataSource::sample(CPUThermals& thermals) {
+    static CollectorStats& stats = SelfStats::probe("cpu.thermals");
+
+    LONG status = CallNtPowerInformation(ProcessorInformation, nullptr, 0,
+                                         m_powerBuffer.data(), static_cast<ULONG>(m_powerBuffer.size()));
+    stats.addSyscalls(1);
+    stats.addBytesRead(m_powerBuffer.size());
+    if (status != 0) {
+        return false;
+    }
+
+    const auto* records = reinterpret_cast<const ProcessorPowerInformation*>(m_powerBuffer.data());
+    size_t recordCount = m_powerBuffer.size() / sizeof(ProcessorPowerInformation);
+    for (size_t i = 0; i < recordCount && i < thermals.currentMhz.size(); i++) {
+        thermals.currentMhz[i] = records[i].CurrentMhz;
+        thermals.maxMhz[i] = records[i].MaxMhz;
+        thermals.limitMhz[i] = records[i].MhzLimit;
+    }
+
+    thermals.sensorNames.clear();
+    thermals.sensorCelsius.clear();
+    if (!m_temperatureCounter || PdhCollectQueryData(m_query) != ERROR_SUCCESS) {
+        return true;
+    }
+    stats.addSyscalls(1);
+
+    DWORD size = static_cast<DWORD>(m_counterBuffer.size());
+    DWORD count = 0;
+    auto* items = reinterpret_cast<PDH_FMT_COUNTERVALUE_ITEM_W*>(m_counterBuffer.data());
+    PDH_STATUS pdhStatus = PdhGetFormattedCounterArrayW(m_temperatureCounter, PDH_FMT_DOUBLE, &size, &count, items);
+    if (pdhStatus == PDH_MORE_DATA) {
+        // Grows once; later samples reuse the buffer
+        m_counterBuffer.resize(size);
+        items = reinterpret_cast<PDH_FMT_COUNTERVALUE_ITEM_W*>(m_counterBuffer.data());
+        pdhStatus = PdhGetFormattedCounterArrayW(m_temperatureCounter, PDH_FMT_DOUBLE, &size, &count, items);
+    }
+    if (pdhStatus != ERROR_SUCCESS) {
+        return true;
+    }
+    stats.addBytesRead(size);
+
+    for (DWORD i = 0; i < count; i++) {
+        // Thermal zones report Kelvin
+        thermals.sensorNames.push_back(SystemUtils::wstringToString(items[i].szName));
+        thermals.sensorCelsius.push_back(items[i].FmtValue.doubleValue - 273.15);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Interrupts
+// ---------------------------------------------------------------------------
+
+bool WinInterruptDataSource::open(int& cpuCount) {
+    if (!m_processors.open()) {
+        return false;
+    }
+    cpuCount = m_processors.processorCount();
+    m_counts.assign(2 * static_cast<size_t>(cpuCount), 0);
+    m_lastCounts.assign(2 * static_cast<size_t>(cpuCount), 0);
+    return true;
+}
+
+uint64_t WinInterruptDataSource::widen(size_t index, ULONG raw) {
+    if (index >= m_counts.size()) {
+        return raw;
+    }
+    return widenCounter(m_counts[index], m_lastCounts[index], raw);
+}
+
+bool WinInterruptDataSource::sample(InterruptCounters& counters, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("irq.collect_data");
+
+    const int cpuCount = counters.cpuCount;
+    uint64_t* interrupts = counters.addSource("Interrupts", false);
+    uint64_t* dpcs = counters.addSource("DPC", true);
+    timestampUs = SystemUtils::monotonicMicros();
+
+    int cpu = 0;
+    for (size_t group = 0; group < m_processors.groupCount(); group++) {
+        size_t recordCount = 0;
+        if (!m_processors.query(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION_CLASS, group,
+                                sizeof(ProcessorPerformanceInformation), m_buffer, recordCount)) {
+            return false;
+        }
+        stats.addSyscalls(1);
+        stats.addBytesRead(recordCount * sizeof(ProcessorPerformanceInformation));
+
+        const auto* records = reinterpret_cast<const ProcessorPerformanceInformation*>(m_buffer.data());
+        for (size_t i = 0; i < recordCount && cpu + static_cast<int>(i) < cpuCount; i++) {
+            interrupts[cpu + i] = widen(cpu + i, records[i].InterruptCount);
+        }
+
+        size_t dpcRecordCount = 0;
+        if (!m_processors.query(SYSTEM_INTERRUPT_INFORMATION_CLASS, group,
+                                sizeof(InterruptInformation), m_buffer, dpcRecordCount)) {
+            return false;
+        }
+        stats.addSyscalls(1);
+        stats.addBytesRead(dpcRecordCount * sizeof(InterruptInformation));
+
+        const auto* dpcRecords = reinterpret_cast<const InterruptInformation*>(m_buffer.data());
+        for (size_t i = 0; i < dpcRecordCount && cpu + static_cast<int>(i) < cpuCount; i++) {
+            dpcs[cpu + i] = widen(cpuCount + cpu + i, dpcRecords[i].DpcCount);
+        }
+
+        cpu += static_cast<int>(recordCount);
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Perf
+// ---------------------------------------------------------------------------
+
+namespace {
+    constexpr ULONG SYSTEM_PROCESSOR_CYCLE_TIME_INFORMATION_CLASS = 108;
+
+    // SYSTEM_PROCESSOR_CYCLE_TIME_INFORMATION
+    struct ProcessorCycleTimeInformation {
+        ULONGLONG CycleTime;
+    };
+}
+
+WinPerfDataSource::WinPerfDataSource()
+    : m_query(nullptr)
+    , m_pageFaultCounter(nullptr)
+{
+}
+
+WinPerfDataSource::~WinPerfDataSource() {
+    if (m_query) {
+        PdhCloseQuery(m_query);
+    }
+}
+
+bool WinPerfDataSource::open(PerfCounters& counters) {
+    if (!m_processors.open()) {
+        return false;
+    }
+
+    const int cpuCount = m_processors.processorCount();
+    counters.resize(cpuCount);
+    m_switches.assign(cpuCount, 0);
+    m_lastSwitches.assign(cpuCount, 0);
+
+    counters.available[PerfCounters::ContextSwitches] = true;
+    counters.perCpu[PerfCounters::ContextSwitches] = true;
+
+    // Cycle counts need Windows 7 or later
+    size_t recordCount = 0;
+    counters.available[PerfCounters::Cycles] = m_processors.query(
+        SYSTEM_PROCESSOR_CYCLE_TIME_INFORMATION_CLASS, 0, sizeof(ProcessorCycleTimeInformation),
+        m_buffer, recordCount) && recordCount > 0;
+    counters.perCpu[PerfCounters::Cycles] = true;
+
+    if (PdhOpenQuery(nullptr, 0, &m_query) == ERROR_SUCCESS
+        && PdhAddEnglishCounterW(m_query, L"\\Memory\\Page Faults/sec", 0, &m_pageFaultCounter) == ERROR_SUCCESS) {
+        counters.available[PerfCounters::PageFaults] = true;
+    } else {
+        m_pageFaultCounter = nullptr;
+    }
+    return true;
+}
+
+bool WinPerfDataSource::sample(PerfCounters& counters, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("perf.collect_data");
+
+    const int cpuCount = counters.cpuCount();
+    uint64_t* switches = counters.values[PerfCounters::ContextSwitches].data();
+    uint64_t* cycles = counters.values[PerfCounters::Cycles].data();
+    timestampUs = SystemUtils::monotonicMicros();
+
+    int cpu = 0;
+    for (size_t group = 0; group < m_processors.groupCount(); group++) {
+        size_t recordCount = 0;
+        if (!m_processors.query(SYSTEM_INTERRUPT_INFORMATION_CLASS, group,
+                                sizeof(InterruptInformation), m_buffer, recordCount)) {
+            return false;
+        }
+        stats.addSyscalls(1);
+        stats.addBytesRead(recordCount * sizeof(InterruptInformation));
+
+        const auto* records = reinterpret_cast<const InterruptInformation*>(m_buffer.data());
+        for (size_t i = 0; i < recordCount && cpu + static_cast<int>(i) < cpuCount; i++) {
+            size_t index = cpu + i;
+            switches[index] = widenCounter(m_switches[index], m_lastSwitches[index], records[i].ContextSwitches);
+        }
+
+        if (counters.available[PerfCounters::Cycles]) {
+            size_t cycleRecordCount = 0;
+            if (m_processors.query(SYSTEM_PROCESSOR_CYCLE_TIME_INFORMATION_CLASS, group,
+                                   sizeof(ProcessorCycleTimeInformation), m_buffer, cycleRecordCount)) {
+                const auto* cycleRecords = reinterpret_cast<const ProcessorCycleTimeInformation*>(m_buffer.data());
+                for (size_t i = 0; i < cycleRecordCount && cpu + static_cast<int>(i) < cpuCount; i++) {
+                    cycles[cpu + i] = cycleRecords[i].CycleTime;
+                }
+            }
+            stats.addSyscalls(1);
+            stats.addBytesRead(cycleRecordCount * sizeof(ProcessorCycleTimeInformation));
+        }
+
+        cpu += static_cast<int>(recordCount);
+    }
+
+    // Page faults are only counted system-wide
+    if (m_pageFaultCounter && PdhCollectQueryData(m_query) == ERROR_SUCCESS) {
+        PDH_RAW_COUNTER raw;
+        if (PdhGetRawCounterValue(m_pageFaultCounter, nullptr, &raw) == ERROR_SUCCESS && cpuCount > 0) {
+            counters.values[PerfCounters::PageFaults][0] = static_cast<uint64_t>(raw.FirstValue);
+        }
+        stats.addSyscalls(2);
+        stats.addBytesRead(sizeof(raw));
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Scheduler
+// ---------------------------------------------------------------------------
+
+WinSchedDataSource::WinSchedDataSource()
+    : m_query(nullptr)
+    , m_queueCounter(nullptr)
+    , m_waitNs(0)
+    , m_lastTimestamp(0)
+{
+}
+
+WinSchedDataSource::~WinSchedDataSource() {
+    if (m_query) {
+        PdhCloseQuery(m_query);
+    }
+}
+
+bool WinSchedDataSource::open(SchedCounters& counters) {
+    if (!m_processors.open()) {
+        return false;
+    }
+
+    if (PdhOpenQuery(nullptr, 0, &m_query) != ERROR_SUCCESS
+        || PdhAddEnglishCounterW(m_query, L"\\System\\Processor Queue Length", 0, &m_queueCounter) != ERROR_SUCCESS) {
+        std::cerr << "Failed to open processor queue length counter" << std::endl;
+        return false;
+    }
+
+    const int cpuCount = m_processors.processorCount();
+    counters.resize(cpuCount);
+    counters.waitPerCpu = false;
+    m_switches.assign(cpuCount, 0);
+    m_lastSwitches.assign(cpuCount, 0);
+    return true;
+}
+
+bool WinSchedDataSource::sample(SchedCounters& counters, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("sched.collect_data");
+
+    const int cpuCount = counters.cpuCount();
+    uint64_t* timeslices = counters.timeslices.data();
+    timestampUs = SystemUtils::monotonicMicros();
+
+    int cpu = 0;
+    for (size_t group = 0; group < m_processors.groupCount(); group++) {
+        size_t recordCount = 0;
+        if (!m_processors.query(SYSTEM_INTERRUPT_INFORMATION_CLASS, group,
+                                sizeof(InterruptInformation), m_buffer, recordCount)) {
+            return false;
+        }
+        stats.addSyscalls(1);
+        stats.addBytesRead(recordCount * sizeof(InterruptInformation));
+
+        const auto* records = reinterpret_cast<const InterruptInformation*>(m_buffer.data());
+        for (size_t i = 0; i < recordCount && cpu + static_cast<int>(i) < cpuCount; i++) {
+            size_t index = cpu + i;
+            timeslices[index] = widenCounter(m_switches[index], m_lastSwitches[index], records[i].ContextSwitches);
+        }
+        cpu += static_cast<int>(recordCount);
+    }
+
+    // Queue length is instantaneous; treat it as constant since the
+    // previous sample
+    PDH_FMT_COUNTERVALUE value;
+    if (PdhCollectQueryData(m_query) == ERROR_SUCCESS
+        && PdhGetFormattedCounterValue(m_queueCounter, PDH_FMT_LONG, nullptr, &value) == ERROR_SUCCESS
+        && m_lastTimestamp > 0 && timestampUs > m_lastTimestamp && value.longValue > 0) {
+        m_waitNs += static_cast<uint64_t>(value.longValue) * (timestampUs - m_lastTimestamp) * 1000ULL;
+    }
+    stats.addSyscalls(2);
+    m_lastTimestamp = timestampUs;
+
+    if (cpuCount > 0) {
+        counters.waitNs[0] = m_waitNs;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Memory
+// ---------------------------------------------------------------------------
+
+bool WinMemoryDataSource::sample(MemoryStatus& status) {
+    static CollectorStats& stats = SelfStats::probe("ram.collect_data");
+
+    MEMORYSTATUSEX memInfo;
+    memInfo.dwLength = sizeof(MEMORYSTATUSEX);
+
+    stats.addSyscalls(1);
+    stats.addBytesRead(sizeof(memInfo));
+
+    if (!GlobalMemoryStatusEx(&memInfo)) {
+        std::cerr << "Failed to collect memory data. Error: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    status.totalPhys = memInfo.ullTotalPhys;
+    status.availPhys = memInfo.ullAvailPhys;
+    status.totalPageFile = memInfo.ullTotalPageFile;
+    status.availPageFile = memInfo.ullAvailPageFile;
+    status.memoryLoad = memInfo.dwMemoryLoad;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Disk
+// ---------------------------------------------------------------------------
+
+WinDiskDataSource::WinDiskDataSource()
+    : m_query(nullptr)
+{
+}
+
+WinDiskDataSource::~WinDiskDataSource() {
+    // Clean up PDH resources
+    for (auto& counter : m_speedCounters) {
+        if (counter.readCounter) {
+            PdhRemoveCounter(counter.readCounter);
+        }
+        if (counter.writeCounter) {
+            PdhRemoveCounter(counter.writeCounter);
+        }
+    }
+
+    if (m_query) {
+        PdhCloseQuery(m_query);
+    }
+}
+
+bool WinDiskDataSource::enumerate(std::vector<DiskInfo>& disks) {
+    disks.clear();
+
+    // Get all logical drives
+    DWORD drives = GetLogicalDrives();
+
+    for (int i = 0; i < 26; i++) {
+        if (drives & (1 << i)) {
+            wchar_t driveLetter[4];
+            swprintf_s(driveLetter, L"%c:", L'A' + i);
+
+            // Check if it's a fixed drive (hard disk)
+            UINT driveType = GetDriveTypeW(driveLetter);
+            if (driveType == DRIVE_FIXED || driveType == DRIVE_REMOVABLE) {
+                DiskInfo info;
+                info.driveLetter = NameTable::intern(driveLetter);
+                info.totalSpace = 0;
+                info.freeSpace = 0;
+                info.usedSpace = 0;
+                info.usagePercent = 0.0;
+                info.readSpeed = 0.0;
+                info.writeSpeed = 0.0;
+                info.volumeName = NameTable::EMPTY;
+                info.fileSystem = NameTable::EMPTY;
+                info.described = false;
+
+                disks.push_back(info);
+            }
+        }
+    }
+
+    if (disks.empty()) {
+        return false;
+    }
+
+    // Create PDH query for speed monitoring
+    PDH_STATUS status = PdhOpenQuery(nullptr, 0, &m_query);
+    if (status != ERROR_SUCCESS) {
+        std::cerr << "Failed to open PDH query for disk monitoring. Error: " << status << std::endl;
+        return false;
+    }
+
+    // Setup speed counters
+    if (!setupSpeedCounters(disks)) {
+        std::cerr << "Failed to setup disk speed counters" << std::endl;
+    }
+
+    // Collect initial PDH data
+    PdhCollectQueryData(m_query);
+    return true;
+}
+
+void WinDiskDataSource::describe(DiskInfo& disk) {
+    static CollectorStats& stats = SelfStats::probe("disk.describe");
+    ScopedTimer timer(stats);
+    stats.addSyscalls(1);
+
+    // Spins up (or times out on) removable media, hence only on demand
+    wchar_t volumeName[MAX_PATH + 1] = {0};
+    wchar_t fileSystem[MAX_PATH + 1] = {0};
+    std::wstring root = NameTable::wide(disk.driveLetter) + L"\\";
+    if (GetVolumeInformationW(root.c_str(), volumeName, MAX_PATH, nullptr, nullptr, nullptr, fileSystem, MAX_PATH)) {
+        disk.volumeName = NameTable::intern(volumeName);
+        disk.fileSystem = NameTable::intern(fileSystem);
+    }
+}
+
+void WinDiskDataSource::sampleSpace(std::vector<DiskInfo>& disks) {
+    static CollectorStats& stats = SelfStats::probe("disk.collect_space_info");
+
+    stats.addSyscalls(disks.size());
+    stats.addBytesRead(disks.size() * 3 * sizeof(ULARGE_INTEGER));
+
+    for (auto& disk : disks) {
+        ULARGE_INTEGER freeBytesAvailable, totalBytes, totalFreeBytes;
+
+        if (GetDiskFreeSpaceExW(NameTable::wide(disk.driveLetter).c_str(), &freeBytesAvailable, &totalBytes, &totalFreeBytes)) {
+            disk.totalSpace = totalBytes.QuadPart;
+            disk.freeSpace = totalFreeBytes.QuadPart;
+        }
+    }
+}
+
+void WinDiskDataSource::sampleSpeeds(std::vector<DiskInfo>& disks) {
+    if (!m_query) {
+        return;
+    }
+
+    static CollectorStats& stats = SelfStats::probe("disk.collect_speed_info");
+
+    stats.addSyscalls(1 + 2 * m_speedCounters.size());
+    stats.addBytesRead(2 * m_speedCounters.size() * sizeof(PDH_FMT_COUNTERVALUE));
+
+    // Collect query data
+    PDH_STATUS status = PdhCollectQueryData(m_query);
+    if (status != ERROR_SUCCESS) {
+        return;
+    }
+
+    // Get read/write speeds for each disk
+    for (size_t i = 0; i < m_speedCounters.size() && i < disks.size(); i++) {
+        PDH_FMT_COUNTERVALUE counterValue;
+
+        // Read speed
+        if (m_speedCounters[i].readCounter) {
+            status = PdhGetFormattedCounterValue(m_speedCounters[i].readCounter, PDH_FMT_DOUBLE, nullptr, &counterValue);
+            if (status == ERROR_SUCCESS) {
+                disks[i].readSpeed = counterValue.doubleValue;
+            }
+        }
+
+        // Write speed
+        if (m_speedCounters[i].writeCounter) {
+            status = PdhGetFormattedCounterValue(m_speedCounters[i].writeCounter, PDH_FMT_DOUBLE, nullptr, &counterValue);
+            if (status == ERROR_SUCCESS) {
+                disks[i].writeSpeed = counterValue.doubleValue;
+            }
+        }
+    }
+}
+
+bool WinDiskDataSource::setupSpeedCounters(const std::vector<DiskInfo>& disks) {
+    if (!m_query) {
+        return false;
+    }
+
+    m_speedCounters.clear();
+
+    for (const auto& disk : disks) {
+        SpeedCounters counters;
+        counters.readCounter = nullptr;
+        counters.writeCounter = nullptr;
+
+        // Try to find the physical disk number for this drive
+        // Note: This is a simplified approach. In reality, mapping drive letters to physical disks is complex.
+        // We'll use _Total for demonstration, or try individual disk instances
+
+        std::wstring diskName = NameTable::wide(disk.driveLetter).substr(0, 1); // Just the letter (C, D, etc.)
+        counters.diskName = diskName;
+
+        // Try to add read counter
+        std::wstring readCounterPath = L"\\LogicalDisk(" + diskName + L":)\\Disk Read Bytes/sec";
+        PDH_STATUS status = PdhAddCounter(m_query, readCounterPath.c_str(), 0, &counters.readCounter);
+        if (status != ERROR_SUCCESS) {
+            counters.readCounter = nullptr;
+        }
+
+        // Try to add write counter
+        std::wstring writeCounterPath = L"\\LogicalDisk(" + diskName + L":)\\Disk Write Bytes/sec";
+        status = PdhAddCounter(m_query, writeCounterPath.c_str(), 0, &counters.writeCounter);
+        if (status != ERROR_SUCCESS) {
+            counters.writeCounter = nullptr;
+        }
+
+        m_speedCounters.push_back(counters);
+    }
+
+    return !m_speedCounters.empty();
+}
+
+// ---------------------------------------------------------------------------
+// Network
+// ---------------------------------------------------------------------------
+
+bool WinNetworkDataSource::sample(std::vector<NetworkInterfaceInfo>& interfaces, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("net.collect_data");
+
+    interfaces.clear();
+    timestampUs = SystemUtils::monotonicMicros();
+
+    // Get the table of network interfaces (use GetIfTable for Ming compatibility)
+    ULONG bufferSize = 0;
+    GetIfTable(nullptr, &bufferSize, FALSE);
+
+    MIB_IFTABLE* ifTable = (MIB_IFTABLE*)malloc(bufferSize);
+    if (!ifTable) {
+        return false;
+    }
+
+    DWORD result = GetIfTable(ifTable, &bufferSize, FALSE);
+    stats.addSyscalls(2);
+    stats.addBytesRead(bufferSize);
+
+    if (result != NO_ERROR) {
+        std::cerr << "Failed to get network interface table. Error: " << result << std::endl;
+        free(ifTable);
+        return false;
+    }
+
+    // Iterate through all interfaces
+    for (DWORD i = 0; i < ifTable->dwNumEntries; i++) {
+        MIB_IFROW& row = ifTable->table[i];
+
+        // Filter out loopback
+        if (row.dwType == MIB_IF_TYPE_LOOPBACK) {
+            continue;
+        }
+
+        NetworkInterfaceInfo info;
+
+        // Known descriptions convert nothing (the length includes the terminator)
+        const char* description = reinterpret_cast<const char*>(row.bDescr);
+        size_t length = row.dwDescrLen < sizeof(row.bDescr) ? row.dwDescrLen : sizeof(row.bDescr);
+        info.description = NameTable::intern(description, strnlen(description, length));
+        info.name = info.description;  // Use description as name
+
+        info.bytesReceived = row.dwInOctets;
+        info.bytesSent = row.dwOutOctets;
+        info.packetsReceived = static_cast<uint64_t>(row.dwInUcastPkts) + row.dwInNUcastPkts;
+        info.packetsSent = static_cast<uint64_t>(row.dwOutUcastPkts) + row.dwOutNUcastPkts;
+        info.errors = static_cast<uint64_t>(row.dwInErrors) + row.dwOutErrors;
+        info.drops = static_cast<uint64_t>(row.dwInDiscards) + row.dwOutDiscards;
+        info.downloadSpeed = 0.0;
+        info.uploadSpeed = 0.0;
+        info.packetReceiveRate = 0.0;
+        info.packetSendRate = 0.0;
+        info.errorRate = 0.0;
+        info.dropRate = 0.0;
+        info.isActive = (row.dwOperStatus == MIB_IF_OPER_STATUS_OPERATIONAL);
+
+        interfaces.push_back(info);
+    }
+
+    free(ifTable);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Connections
+// ---------------------------------------------------------------------------
+
+namespace {
+    constexpr uint64_t PROCESS_NAME_TTL_MS = 60000;    // PIDs are reused
+    constexpr uint64_t ESTATS_INTERVAL_US = 5000000;    // Per-connection byte counter reads
+
+    /**
+     * @brief Get the executable name of an open process
+     * @return File name without its directory, or "" on failure
+     */
+    NameId imageName(HANDLE process) {
+        wchar_t path[MAX_PATH];
+        DWORD length = MAX_PATH;
+        if (!QueryFullProcessImageNameW(process, 0, path, &length)) {
+            return NameTable::EMPTY;
+        }
+        DWORD start = length;
+        while (start > 0 && path[start - 1] != L'\\' && path[start - 1] != L'/') {
+            start--;
+        }
+        return NameTable::intern(path + start, length - start);
+    }
+
+    /**
+     * @brief Convert an IPv4 address and port in network byte order
+     */
+    ConnectionEndpoint ipv4Endpoint(DWORD address, DWORD port) {
+        ConnectionEndpoint endpoint = {};
+        std::memcpy(endpoint.address, &address, 4);
+        endpoint.port = static_cast<uint16_t>((port & 0xFF) << 8 | (port >> 8 & 0xFF));
+        endpoint.family = 4;
+        return endpoint;
+    }
+}
+
+WinConnectionDataSource::WinConnectionDataSource()
+    : m_namesTime(0)
+    , m_estatsTime(0)
+    , m_estatsDenied(false)
+{
+}
+
+bool WinConnectionDataSource::sample(ConnectionTable& table, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("conn.collect_data");
+
+    // One call for every connection and its owner (retry once if it grew)
+    DWORD size = static_cast<DWORD>(m_buffer.size());
+    DWORD result = ERROR_INSUFFICIENT_BUFFER;
+    for (int attempt = 0; attempt < 2 && result == ERROR_INSUFFICIENT_BUFFER; attempt++) {
+        if (size > m_buffer.size()) {
+            m_buffer.resize(size + size / 4);
+            size = static_cast<DWORD>(m_buffer.size());
+        }
+        result = GetExtendedTcpTable(m_buffer.empty() ? nullptr : m_buffer.data(), &size, FALSE,
+                                     AF_INET, TCP_TABLE_OWNER_PID_CONNECTIONS, 0);
+        stats.addSyscalls(1);
+    }
+    if (result != NO_ERROR) {
+        std::cerr << "Failed to get TCP connection table. Error: " << result << std::endl;
+        return false;
+    }
+    stats.addBytesRead(size);
+
+    // Byte counters cost one call per connection: read them at a slower
+    // rate, and not at all once enabling them was denied (no admin rights)
+    uint64_t now = SystemUtils::monotonicMicros();
+    bool readBytes = !m_estatsDenied && (m_estatsTime == 0 || now - m_estatsTime >= ESTATS_INTERVAL_US);
+    if (readBytes || m_estatsDenied) {
+        m_estatsTime = now;
+    }
+    timestampUs = m_estatsTime;
+
+    const auto* connections = reinterpret_cast<const MIB_TCPTABLE_OWNER_PID*>(m_buffer.data());
+    for (DWORD i = 0; i < connections->dwNumEntries; i++) {
+        const MIB_TCPROW_OWNER_PID& row = connections->table[i];
+        if (row.dwState != MIB_TCP_STATE_ESTAB) {
+            continue;
+        }
+
+        uint64_t received = 0;
+        uint64_t acked = 0;
+        if (readBytes && !m_estatsDenied) {
+            MIB_TCPROW estatsRow;
+            estatsRow.dwState = row.dwState;
+            estatsRow.dwLocalAddr = row.dwLocalAddr;
+            estatsRow.dwLocalPort = row.dwLocalPort;
+            estatsRow.dwRemoteAddr = row.dwRemoteAddr;
+            estatsRow.dwRemotePort = row.dwRemotePort;
+
+            // Enable collection the first time a connection is seen
+            TCP_ESTATS_DATA_RW_v0 rw = {};
+            TCP_ESTATS_DATA_ROD_v0 rod = {};
+            if (GetPerTcpConnectionEStats(&estatsRow, TcpConnectionEstatsData,
+                                          reinterpret_cast<PUCHAR>(&rw), 0, sizeof(rw),
+                                          nullptr, 0, 0,
+                                          reinterpret_cast<PUCHAR>(&rod), 0, sizeof(rod)) == NO_ERROR) {
+                if (rw.EnableCollection) {
+                    received = rod.ThruBytesReceived;
+                    acked = rod.ThruBytesAcked;
+                } else {
+                    rw.EnableCollection = TRUE;
+                    ULONG status = SetPerTcpConnectionEStats(&estatsRow, TcpConnectionEstatsData,
+                                                             reinterpret_cast<PUCHAR>(&rw), 0, sizeof(rw), 0);
+                    stats.addSyscalls(1);
+                    if (status == ERROR_ACCESS_DENIED) {
+                        std::cerr << "Per-connection byte counters need administrator rights; "
+                                     "listing connections without them" << std::endl;
+                        m_estatsDenied = true;
+                    }
+                }
+            }
+            stats.addSyscalls(1);
+        }
+
+        // The 4-tuple identifies the socket while it lives
+        uint64_t id = (static_cast<uint64_t>(row.dwLocalAddr) << 32 | row.dwRemoteAddr)
+            ^ (static_cast<uint64_t>(row.dwLocalPort & 0xFFFF) << 16 | (row.dwRemotePort & 0xFFFF)) * 0x9E3779B97F4A7C15ULL;
+        table.add(id, row.dwOwningPid, ipv4Endpoint(row.dwLocalAddr, row.dwLocalPort),
+                  ipv4Endpoint(row.dwRemoteAddr, row.dwRemotePort), received, acked);
+    }
+
+    return true;
+}
+
+NameId WinConnectionDataSource::processName(uint32_t pid) {
+    uint64_t now = GetTickCount64();
+    if (now - m_namesTime > PROCESS_NAME_TTL_MS) {
+        m_names.clear();
+        m_namesTime = now;
+    }
+    for (const auto& entry : m_names) {
+        if (entry.first == pid) {
+            return entry.second;
+        }
+    }
+
+    NameId name = NameTable::EMPTY;
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+    if (process) {
+        name = imageName(process);
+        CloseHandle(process);
+    } else if (pid == 4) {
+        name = NameTable::intern(L"System");
+    }
+    m_names.emplace_back(pid, name);
+    return name;
+}
+
+// ---------------------------------------------------------------------------
+// Processes
+// ---------------------------------------------------------------------------
+
+namespace {
+    // Microsoft-Windows-Kernel-Process {22FB2CD6-0E7B-422B-A0C7-2FAD1FD0E716}
+    const GUID KERNEL_PROCESS_PROVIDER = {
+        0x22fb2cd6, 0x0e7b, 0x422b, {0xa0, 0xc7, 0x2f, 0xad, 0x1f, 0xd0, 0xe7, 0x16}
+    };
+    constexpr ULONGLONG KERNEL_PROCESS_KEYWORD = 0x10;     // WINEVENT_KEYWORD_PROCESS
+    constexpr USHORT KERNEL_PROCESS_START = 1;
+    constexpr USHORT KERNEL_PROCESS_STOP = 2;
+    const wchar_t PROCESS_TRACE_SESSION[] = L"SystemMonitorProcessTrace";
+
+    constexpr ULONG SYSTEM_PROCESS_INFORMATION_CLASS = 5;
+    constexpr LONG STATUS_INFO_LENGTH_MISMATCH = static_cast<LONG>(0xC0000004);
+
+    // SYSTEM_PROCESS_INFORMATION with the fields winternl.h leaves as
+    // Reserved spelled out (thread records follow each entry)
+    struct SystemProcessRecord {
+        ULONG NextEntryOffset;
+        ULONG NumberOfThreads;
+        LARGE_INTEGER WorkingSetPrivateSize;
+        ULONG HardFaultCount;
+        ULONG NumberOfThreadsHighWatermark;
+        ULONGLONG CycleTime;
+        LARGE_INTEGER CreateTime;
+        LARGE_INTEGER UserTime;
+        LARGE_INTEGER KernelTime;
+        USHORT ImageNameLength;             // UNICODE_STRING ImageName
+        USHORT ImageNameMaximumLength;
+        PWSTR ImageNameBuffer;
+        LONG BasePriority;
+        HANDLE UniqueProcessId;
+        HANDLE InheritedFromUniqueProcessId;
+        ULONG HandleCount;
+        ULONG SessionId;
+        ULONG_PTR UniqueProcessKey;
+        SIZE_T PeakVirtualSize;
+        SIZE_T VirtualSize;
+        ULONG PageFaultCount;
+        SIZE_T PeakWorkingSetSize;
+        SIZE_T WorkingSetSize;
+        SIZE_T QuotaPeakPagedPoolUsage;
+        SIZE_T QuotaPagedPoolUsage;
+        SIZE_T QuotaPeakNonPagedPoolUsage;
+        SIZE_T QuotaNonPagedPoolUsage;
+        SIZE_T PagefileUsage;
+        SIZE_T PeakPagefileUsage;
+        SIZE_T PrivatePageCount;
+        LARGE_INTEGER ReadOperationCount;
+        LARGE_INTEGER WriteOperationCount;
+        LARGE_INTEGER OtherOperationCount;
+        LARGE_INTEGER ReadTransferCount;
+        LARGE_INTEGER WriteTransferCount;
+        LARGE_INTEGER OtherTransferCount;
+    };
+
+    uint64_t fileTimeValue(const FILETIME& time) {
+        return static_cast<uint64_t>(time.dwHighDateTime) << 32 | time.dwLowDateTime;
+    }
+
+    /**
+     * @brief Fill an EVENT_TRACE_PROPERTIES buffer for the real-time session
+     */
+    EVENT_TRACE_PROPERTIES* prepareTraceProperties(std::vector<unsigned char>& buffer) {
+        buffer.assign(sizeof(EVENT_TRACE_PROPERTIES) + sizeof(PROCESS_TRACE_SESSION), 0);
+        auto* properties = reinterpret_cast<EVENT_TRACE_PROPERTIES*>(buffer.data());
+        properties->Wnode.BufferSize = static_cast<ULONG>(buffer.size());
+        properties->Wnode.Flags = WNODE_FLAG_TRACED_GUID;
+        properties->Wnode.ClientContext = 1;        // QueryPerformanceCounter timestamps
+        properties->LogFileMode = EVENT_TRACE_REAL_TIME_MODE;
+        properties->FlushTimer = 1;                 // Deliver buffered events every second
+        properties->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+        return properties;
+    }
+}
+
+WinProcessDataSource::WinProcessDataSource(bool batched)
+    : m_querySystemInformation(nullptr)
+    , m_pageSize(4096)
+    , m_session(0)
+    , m_trace(0)
+    , m_reconciledUs(0)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    m_pageSize = info.dwPageSize;
+
+    HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
+    if (batched && ntdll) {
+        m_querySystemInformation = GetProcAddress(ntdll, "NtQuerySystemInformation");
+    }
+}
+
+WinProcessDataSource::~WinProcessDataSource() {
+    stopEvents();
+    for (const Tracked& process : m_tracked) {
+        if (process.handle) {
+            CloseHandle(process.handle);
+        }
+    }
+}
+
+bool WinProcessDataSource::sample(std::vector<ProcessCounters>& processes, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+
+    // Follow the notifications, and rescan when polling or to repair lost events
+    timestampUs = SystemUtils::monotonicMicros();
+    if (m_session) {
+        applyEvents();
+    }
+    bool batched = m_querySystemInformation && snapshot(processes);
+    if (!m_session || m_reconciledUs == 0 || timestampUs - m_reconciledUs >= RECONCILE_INTERVAL_MS * 1000) {
+        size_t count = 0;
+        if (batched) {
+            count = processes.size();
+            m_pids.resize(count);
+            for (size_t i = 0; i < count; i++) {
+                m_pids[i] = processes[i].pid;
+            }
+        } else if (!enumerate(count)) {
+            return false;
+        }
+        rescan(count);
+        m_reconciledUs = timestampUs;
+    }
+    if (batched) {
+        return true;
+    }
+
+    // Fallback: three calls per process on the cached handles
+    processes.clear();
+    for (const Tracked& process : m_tracked) {
+        IO_COUNTERS io;
+        if (!process.handle || !GetProcessIoCounters(process.handle, &io)) {
+            continue;
+        }
+        PROCESS_MEMORY_COUNTERS memory;
+        FILETIME created, exited, kernel, user;
+        uint64_t resident = 0;
+        uint64_t cpuMicros = 0;
+        if (GetProcessMemoryInfo(process.handle, &memory, sizeof(memory))) {
+            resident = memory.WorkingSetSize;
+        }
+        if (GetProcessTimes(process.handle, &created, &exited, &kernel, &user)) {
+            cpuMicros = (fileTimeValue(kernel) + fileTimeValue(user)) / 10;
+        }
+        processes.push_back({process.pid, io.ReadTransferCount, io.WriteTransferCount,
+                             io.ReadOperationCount, io.WriteOperationCount, resident, cpuMicros});
+    }
+    stats.addSyscalls(processes.size() * 3);
+    stats.addBytesRead(processes.size() * (sizeof(IO_COUNTERS) + sizeof(PROCESS_MEMORY_COUNTERS)));
+    return true;
+}
+
+bool WinProcessDataSource::snapshot(std::vector<ProcessCounters>& processes) {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+
+    // One call returns every process; retry with the size it asks for
+    auto query = reinterpret_cast<NtQuerySystemInformationFn>(m_querySystemInformation);
+    if (m_snapshot.empty()) {
+        m_snapshot.resize(1 << 20);
+    }
+    ULONG returned = 0;
+    LONG status;
+    for (;;) {
+        stats.addSyscalls(1);
+        status = query(SYSTEM_PROCESS_INFORMATION_CLASS, m_snapshot.data(),
+                       static_cast<ULONG>(m_snapshot.size()), &returned);
+        if (status != STATUS_INFO_LENGTH_MISMATCH) {
+            break;
+        }
+        // Room for processes started before the next call
+        m_snapshot.resize(returned + returned / 4 + 65536);
+    }
+    if (status < 0) {
+        std::cerr << "Failed to query the process list. Status: " << status
+                  << ", reading each process instead" << std::endl;
+        m_querySystemInformation = nullptr;
+        return false;
+    }
+    stats.addBytesRead(returned);
+
+    processes.clear();
+    size_t offset = 0;
+    for (;;) {
+        const auto* record = reinterpret_cast<const SystemProcessRecord*>(m_snapshot.data() + offset);
+        uint64_t cpuMicros = (counterValue(record->KernelTime) + counterValue(record->UserTime)) / 10;
+        processes.push_back({static_cast<uint32_t>(reinterpret_cast<ULONG_PTR>(record->UniqueProcessId)),
+                             counterValue(record->ReadTransferCount), counterValue(record->WriteTransferCount),
+                             counterValue(record->ReadOperationCount), counterValue(record->WriteOperationCount),
+                             record->WorkingSetSize, cpuMicros});
+        if (record->NextEntryOffset == 0) {
+            break;
+        }
+        offset += record->NextEntryOffset;
+    }
+
+    // The kernel lists processes in creation order
+    std::sort(processes.begin(), processes.end(), [](const ProcessCounters& a, const ProcessCounters& b) {
+        return a.pid < b.pid;
+    });
+    return true;
+}
+
+bool WinProcessDataSource::enumerate(size_t& count) {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+
+    // All PIDs in one call (grow the buffer until it is not filled)
+    if (m_pids.empty()) {
+        m_pids.resize(1024);
+    }
+    DWORD bytes = 0;
+    for (;;) {
+        DWORD capacity = static_cast<DWORD>(m_pids.size() * sizeof(DWORD));
+        stats.addSyscalls(1);
+        if (!EnumProcesses(m_pids.data(), capacity, &bytes)) {
+            std::cerr << "Failed to enumerate processes. Error: " << GetLastError() << std::endl;
+            return false;
+        }
+        if (bytes < capacity) {
+            break;
+        }
+        m_pids.resize(m_pids.size() * 2);
+    }
+    stats.addBytesRead(bytes);
+
+    count = bytes / sizeof(DWORD);
+    std::sort(m_pids.begin(), m_pids.begin() + count);
+    return true;
+}
+
+void WinProcessDataSource::rescan(size_t count) {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+
+    // Merge with the tracked processes: keep their handles, open new ones
+    // and finish the processes that are gone
+    m_next.clear();
+    size_t t = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t pid = m_pids[i];
+        while (t < m_tracked.size() && m_tracked[t].pid < pid) {
+            finish(m_tracked[t++]);
+        }
+        if (t < m_tracked.size() && m_tracked[t].pid == pid) {
+            m_next.push_back(std::move(m_tracked[t]));
+            t++;
+        } else {
+            Tracked process = {pid, 0, nullptr, NameTable::EMPTY, false};
+            if (pid != 0) {
+                process.handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+                stats.addSyscalls(1);
+            }
+            m_next.push_back(std::move(process));
+        }
+    }
+    while (t < m_tracked.size()) {
+        finish(m_tracked[t++]);
+    }
+    std::swap(m_tracked, m_next);
+}
+
+void WinProcessDataSource::applyEvents() {
+    {
+        std::lock_guard<std::mutex> lock(m_eventMutex);
+        std::swap(m_events, m_applying);
+    }
+
+    // In arrival order: a PID can exit and be reused within one batch
+    for (const Event& event : m_applying) {
+        auto it = std::lower_bound(m_tracked.begin(), m_tracked.end(), event.pid, [](const Tracked& process, uint32_t pid) {
+            return process.pid < pid;
+        });
+        bool known = it != m_tracked.end() && it->pid == event.pid;
+
+        if (!event.start) {
+            if (known) {
+                finish(*it);
+                m_tracked.erase(it);
+            }
+        } else if (!known) {
+            m_tracked.insert(it, Tracked{event.pid, event.parentPid, event.handle, NameTable::EMPTY, false});
+        } else {
+            // Already found by a rescan (the held handle pins the PID)
+            it->parentPid = event.parentPid;
+            if (!it->handle) {
+                it->handle = event.handle;
+            } else if (event.handle) {
+                CloseHandle(event.handle);
+            }
+        }
+    }
+    m_applying.clear();
+}
+
+void WinProcessDataSource::finish(Tracked& process) {
+    static CollectorStats& stats = SelfStats::probe("process.collect_io");
+
+    // The handle of an exited process still reads its final accounting
+    ProcessExit exit = {process.pid, process.parentPid, process.name, 0, 0, 0, 0};
+    if (process.handle) {
+        FILETIME created, exited, kernel, user;
+        if (GetProcessTimes(process.handle, &created, &exited, &kernel, &user)) {
+            exit.cpuMicros = (fileTimeValue(kernel) + fileTimeValue(user)) / 10;
+            if (fileTimeValue(exited) > fileTimeValue(created)) {
+                exit.lifetimeMs = (fileTimeValue(exited) - fileTimeValue(created)) / 10000;
+            }
+        }
+        IO_COUNTERS io;
+        if (GetProcessIoCounters(process.handle, &io)) {
+            exit.readBytes = io.ReadTransferCount;
+            exit.writeBytes = io.WriteTransferCount;
+        }
+        if (!process.named) {
+            exit.name = imageName(process.handle);
+        }
+        CloseHandle(process.handle);
+        process.handle = nullptr;
+        stats.addSyscalls(process.named ? 3 : 4);
+    }
+    m_exits.push_back(std::move(exit));
+}
+
+bool WinProcessDataSource::readMemory(uint32_t pid, ProcessMemory& memory) {
+    static CollectorStats& stats = SelfStats::probe("process.refresh_memory");
+
+    // The cached handle lacks PROCESS_VM_READ; walks are rare enough to
+    // open a handle for each
+    HANDLE process = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ, FALSE, pid);
+    stats.addSyscalls(1);
+    if (!process) {
+        return false;
+    }
+
+    // Entry count first, then the entries (retry once if the set grew)
+    bool walked = false;
+    for (int attempt = 0; attempt < 2 && !walked; attempt++) {
+        if (m_workingSet.size() < 2) {
+            m_workingSet.resize(2);
+        }
+        walked = QueryWorkingSet(process, m_workingSet.data(),
+                                 static_cast<DWORD>(m_workingSet.size() * sizeof(ULONG_PTR))) != FALSE;
+        stats.addSyscalls(1);
+        if (!walked) {
+            if (GetLastError() != ERROR_BAD_LENGTH) {
+                break;
+            }
+            ULONG_PTR entries = m_workingSet[0];
+            m_workingSet.resize(entries + entries / 8 + 64);
+        }
+    }
+
+    PROCESS_MEMORY_COUNTERS_EX counters;
+    bool counted = GetProcessMemoryInfo(process, reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+                                        sizeof(counters)) != FALSE;
+    stats.addSyscalls(1);
+    CloseHandle(process);
+    if (!walked || !counted) {
+        return false;
+    }
+
+    const auto* info = reinterpret_cast<const PSAPI_WORKING_SET_INFORMATION*>(m_workingSet.data());
+    ULONG_PTR entries = info->NumberOfEntries;
+    stats.addBytesRead(entries * sizeof(ULONG_PTR));
+
+    uint64_t proportional = 0;
+    uint64_t unique = 0;
+    for (ULONG_PTR i = 0; i < entries; i++) {
+        const PSAPI_WORKING_SET_BLOCK& block = info->WorkingSetInfo[i];
+        ULONG_PTR sharers = block.Shared && block.ShareCount > 1 ? block.ShareCount : 1;
+        proportional += m_pageSize / sharers;
+        if (sharers == 1) {
+            unique += m_pageSize;
+        }
+    }
+
+    memory.resident = entries * m_pageSize;
+    memory.proportional = proportional;
+    memory.unique = unique;
+    memory.swapped = counters.PrivateUsage > unique ? counters.PrivateUsage - unique : 0;
+    return true;
+}
+
+bool WinProcessDataSource::openEvents() {
+    if (m_session) {
+        return true;
+    }
+
+    // A session left behind by a run that did not stop it is replaced
+    ULONG status = StartTraceW(&m_session, PROCESS_TRACE_SESSION, prepareTraceProperties(m_traceProperties));
+    if (status == ERROR_ALREADY_EXISTS) {
+        ControlTraceW(0, PROCESS_TRACE_SESSION, prepareTraceProperties(m_traceProperties), EVENT_TRACE_CONTROL_STOP);
+        status = StartTraceW(&m_session, PROCESS_TRACE_SESSION, prepareTraceProperties(m_traceProperties));
+    }
+    if (status != ERROR_SUCCESS) {
+        m_session = 0;
+        std::cerr << "Process events unavailable (needs administrator rights), rescanning instead. Error: "
+                  << status << std::endl;
+        return false;
+    }
+
+    status = EnableTraceEx2(m_session, &KERNEL_PROCESS_PROVIDER, EVENT_CONTROL_CODE_ENABLE_PROVIDER,
+                            TRACE_LEVEL_INFORMATION, KERNEL_PROCESS_KEYWORD, 0, 0, nullptr);
+    if (status == ERROR_SUCCESS) {
+        EVENT_TRACE_LOGFILEW logFile = {};
+        logFile.LoggerName = const_cast<LPWSTR>(PROCESS_TRACE_SESSION);
+        logFile.ProcessTraceMode = PROCESS_TRACE_MODE_REAL_TIME | PROCESS_TRACE_MODE_EVENT_RECORD;
+        logFile.EventRecordCallback = onEvent;
+        logFile.Context = this;
+        m_trace = OpenTraceW(&logFile);
+        if (m_trace == INVALID_PROCESSTRACE_HANDLE) {
+            m_trace = 0;
+            status = GetLastError();
+        }
+    }
+    if (status != ERROR_SUCCESS) {
+        std::cerr << "Failed to subscribe to process events. Error: " << status << std::endl;
+        stopEvents();
+        return false;
+    }
+
+    // ProcessTrace blocks until the session stops
+    TRACEHANDLE trace = m_trace;
+    m_traceThread = std::thread([trace]() mutable {
+        ProcessTrace(&trace, 1, nullptr, nullptr);
+    });
+    return true;
+}
+
+void WinProcessDataSource::drainExits(std::vector<ProcessExit>& exits) {
+    exits.clear();
+    std::swap(exits, m_exits);
+}
+
+void WinProcessDataSource::stopEvents() {
+    if (m_session) {
+        ControlTraceW(m_session, nullptr, prepareTraceProperties(m_traceProperties), EVENT_TRACE_CONTROL_STOP);
+        m_session = 0;
+    }
+    if (m_trace) {
+        CloseTrace(m_trace);
+        m_trace = 0;
+    }
+    if (m_traceThread.joinable()) {
+        m_traceThread.join();
+    }
+
+    // Starts that were never applied
+    for (const Event& event : m_events) {
+        if (event.handle) {
+            CloseHandle(event.handle);
+        }
+    }
+    m_events.clear();
+}
+
+void WINAPI WinProcessDataSource::onEvent(PEVENT_RECORD record) {
+    const EVENT_HEADER& header = record->EventHeader;
+    if (!IsEqualGUID(header.ProviderId, KERNEL_PROCESS_PROVIDER) || record->UserDataLength < sizeof(ULONG)) {
+        return;
+    }
+
+    // ProcessStart: ProcessID, CreateTime, ParentProcessID, ...
+    // ProcessStop:  ProcessID, CreateTime, ExitTime, ...
+    const auto* data = static_cast<const unsigned char*>(record->UserData);
+    Event event = {0, 0, nullptr, false};
+    std::memcpy(&event.pid, data, sizeof(ULONG));
+    if (header.EventDescriptor.Id == KERNEL_PROCESS_START) {
+        if (record->UserDataLength >= 16) {
+            std::memcpy(&event.parentPid, data + 12, sizeof(ULONG));
+        }
+        // Open right away so a process living milliseconds keeps its totals
+        event.handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, event.pid);
+        event.start = true;
+    } else if (header.EventDescriptor.Id != KERNEL_PROCESS_STOP) {
+        return;
+    }
+
+    auto* self = static_cast<WinProcessDataSource*>(record->UserContext);
+    std::lock_guard<std::mutex> lock(self->m_eventMutex);
+    self->m_events.push_back(event);
+}
+
+NameId WinProcessDataSource::processName(uint32_t pid) {
+    auto it = std::lower_bound(m_tracked.begin(), m_tracked.end(), pid, [](const Tracked& process, uint32_t value) {
+        return process.pid < value;
+    });
+    if (it == m_tracked.end() || it->pid != pid) {
+        return NameTable::EMPTY;
+    }
+    if (!it->named) {
+        if (it->handle) {
+            it->name = imageName(it->handle);
+        } else if (pid == 4) {
+            it->name = NameTable::intern(L"System");
+        }
+        it->named = true;
+    }
+    return it->name;
+}
+
+// ---------------------------------------------------------------------------
+// Network stack
+// ---------------------------------------------------------------------------
+
+namespace {
+    // AF_INET and AF_INET6 without pulling in the Winsock headers
+    const ULONG STACK_FAMILIES[] = {2, 23};
+
+    const NetStackCounters::Counter WIN_STACK_COUNTERS[] = {
+        NetStackCounters::TcpOutSegments,
+        NetStackCounters::TcpRetransmits,
+        NetStackCounters::TcpResets,
+        NetStackCounters::TcpEstablishedResets,
+        NetStackCounters::UdpReceiveErrors,
+        NetStackCounters::IpReassemblyFailures
+    };
+}
+
+WinNetStackDataSource::WinNetStackDataSource() {
+    for (int c = 0; c < NetStackCounters::CounterCount; c++) {
+        m_values[c] = 0;
+        m_last[c] = 0;
+    }
+}
+
+bool WinNetStackDataSource::open(NetStackCounters& counters) {
+    MIB_TCPSTATS tcp;
+    if (GetTcpStatisticsEx(&tcp, STACK_FAMILIES[0]) != NO_ERROR) {
+        std::cerr << "Failed to get TCP statistics" << std::endl;
+        return false;
+    }
+    for (NetStackCounters::Counter counter : WIN_STACK_COUNTERS) {
+        counters.available[counter] = true;
+    }
+    return true;
+}
+
+bool WinNetStackDataSource::sample(NetStackCounters& counters, uint64_t& timestampUs) {
+    static CollectorStats& stats = SelfStats::probe("netstack.collect_data");
+
+    // Raw 32-bit sums over both families; the sums wrap like the counters
+    ULONG raw[NetStackCounters::CounterCount] = {};
+    for (ULONG family : STACK_FAMILIES) {
+        MIB_TCPSTATS tcp;
+        MIB_UDPSTATS udp;
+        MIB_IPSTATS ip;
+        if (GetTcpStatisticsEx(&tcp, family) == NO_ERROR) {
+            raw[NetStackCounters::TcpOutSegments] += tcp.dwOutSegs;
+            raw[NetStackCounters::TcpRetransmits] += tcp.dwRetransSegs;
+            raw[NetStackCounters::TcpResets] += tcp.dwOutRsts;
+            raw[NetStackCounters::TcpEstablishedResets] += tcp.dwEstabResets;
+        }
+        if (GetUdpStatisticsEx(&udp, family) == NO_ERROR) {
+            raw[NetStackCounters::UdpReceiveErrors] += udp.dwInErrors;
+        }
+        if (GetIpStatisticsEx(&ip, family) == NO_ERROR) {
+            raw[NetStackCounters::IpReassemblyFailures] += ip.dwReasmFails;
+        }
+        stats.addSyscalls(3);
+        stats.addBytesRead(sizeof(tcp) + sizeof(udp) + sizeof(ip));
+    }
+
+    timestampUs = SystemUtils::monotonicMicros();
+    for (NetStackCounters::Counter counter : WIN_STACK_COUNTERS) {
+        counters.values[counter] = widenCounter(m_values[counter], m_last[counter], raw[counter]);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Topology
+// ---------------------------------------------------------------------------
+
+namespace {
+    // RelationProcessorDie is missing from older SDK headers
+    constexpr int RELATION_PROCESSOR_DIE = 5;
+
+    /**
+     * @brief Set ids[cpu] = id for every logical CPU in an affinity mask
+     */
+    void assignMask(const GROUP_AFFINITY& affinity, const std::vector<int>& groupOffsets,
+                    std::vector<int>& ids, int id) {
+        if (affinity.Group >= groupOffsets.size()) {
+            return;
+        }
+        for (int bit = 0; bit < static_cast<int>(sizeof(KAFFINITY) * 8); bit++) {
+            if (affinity.Mask & (static_cast<KAFFINITY>(1) << bit)) {
+                size_t cpu = static_cast<size_t>(groupOffsets[affinity.Group] + bit);
+                if (cpu < ids.size()) {
+                    ids[cpu] = id;
+                }
+            }
+        }
+    }
+}
+
+WinTopologyDataSource::WinTopologyDataSource()
+    : m_query(nullptr)
+{
+}
+
+WinTopologyDataSource::~WinTopologyDataSource() {
+    if (m_query) {
+        PdhCloseQuery(m_query);
+    }
+}
+
+bool WinTopologyDataSource::readTopology(CPUTopology& topology) {
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+        std::cerr << "Failed to query processor topology. Error: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    std::vector<unsigned char> buffer(length);
+    auto* first = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data());
+    if (!GetLogicalProcessorInformationEx(RelationAll, first, &length)) {
+        std::cerr << "Failed to query processor topology. Error: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    // Logical CPUs are numbered group by group, as in WinCPUDataSource
+    std::vector<int> groupOffsets;
+    int cpuCount = 0;
+    WORD groupCount = GetActiveProcessorGroupCount();
+    for (WORD group = 0; group < groupCount; group++) {
+        groupOffsets.push_back(cpuCount);
+        cpuCount += static_cast<int>(GetActiveProcessorCount(group));
+    }
+
+    topology = CPUTopology();
+    topology.node.assign(cpuCount, 0);
+    topology.package.assign(cpuCount, 0);
+    topology.die.assign(cpuCount, -1);
+    topology.core.assign(cpuCount, 0);
+    m_nodeNumbers.clear();
+
+    for (DWORD offset = 0; offset < length; ) {
+        const auto* info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+
+        if (info->Relationship == RelationProcessorCore) {
+            for (WORD i = 0; i < info->Processor.GroupCount; i++) {
+                assignMask(info->Processor.GroupMask[i], groupOffsets, topology.core, topology.coreCount);
+            }
+            topology.coreCount++;
+        } else if (info->Relationship == RelationProcessorPackage) {
+            for (WORD i = 0; i < info->Processor.GroupCount; i++) {
+                assignMask(info->Processor.GroupMask[i], groupOffsets, topology.package, topology.packageCount);
+            }
+            topology.packageCount++;
+        } else if (static_cast<int>(info->Relationship) == RELATION_PROCESSOR_DIE) {
+            for (WORD i = 0; i < info->Processor.GroupCount; i++) {
+                assignMask(info->Processor.GroupMask[i], groupOffsets, topology.die, topology.dieCount);
+            }
+            topology.dieCount++;
+        } else if (info->Relationship == RelationNumaNode) {
+            // OS node numbers may be sparse; use dense IDs
+            assignMask(info->NumaNode.GroupMask, groupOffsets, topology.node,
+                       static_cast<int>(m_nodeNumbers.size()));
+            m_nodeNumbers.push_back(static_cast<USHORT>(info->NumaNode.NodeNumber));
+        }
+
+        offset += info->Size;
+    }
+
+    if (m_nodeNumbers.empty()) {
+        m_nodeNumbers.push_back(0);
+    }
+    topology.nodeCount = static_cast<int>(m_nodeNumbers.size());
+
+    // Dies are only reported by Windows 10 2004 and later
+    if (topology.dieCount == 0) {
+        topology.die = topology.package;
+        topology.dieCount = topology.packageCount;
+    }
+
+    // Node size comes from PDH (no Win32 API reports it per node)
+    if (PdhOpenQuery(nullptr, 0, &m_query) == ERROR_SUCCESS) {
+        for (USHORT number : m_nodeNumbers) {
+            std::wstring path = L"\\NUMA Node Memory(" + std::to_wstring(number) + L")\\Total MBytes";
+            PDH_HCOUNTER counter = nullptr;
+            if (PdhAddCounter(m_query, path.c_str(), 0, &counter) != ERROR_SUCCESS) {
+                counter = nullptr;
+            }
+            m_totalCounters.push_back(counter);
+        }
+    }
+
+    return cpuCount > 0;
+}
+
+bool WinTopologyDataSource::sampleNodes(std::vector<NodeMemory>& nodes) {
+    static CollectorStats& stats = SelfStats::probe("numa.collect_data");
+
+    if (m_query) {
+        PdhCollectQueryData(m_query);
+        stats.addSyscalls(1);
+    }
+
+    for (size_t i = 0; i < nodes.size() && i < m_nodeNumbers.size(); i++) {
+        ULONGLONG available = 0;
+        if (GetNumaAvailableMemoryNodeEx(m_nodeNumbers[i], &available)) {
+            nodes[i].availPhys = available;
+        }
+
+        PDH_FMT_COUNTERVALUE value;
+        if (i < m_totalCounters.size() && m_totalCounters[i]
+            && PdhGetFormattedCounterValue(m_totalCounters[i], PDH_FMT_LARGE, nullptr, &value) == ERROR_SUCCESS) {
+            nodes[i].totalPhys = static_cast<uint64_t>(value.largeValue) * 1024 * 1024;
+        }
+
+        stats.addSyscalls(2);
+        stats.addBytesRead(sizeof(available) + sizeof(value));
+    }
+
+    return true;
+}
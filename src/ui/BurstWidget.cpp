@@ -0,0 +1,168 @@
+#include "ui/BurstWidget.h"
+#include "monitors/BurstSampler.h"
+#include <QHBoxLayout>
+#include <QList>
+#include <QPointF>
+#include <QString>
+
+BurstWidget::BurstWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    setupUI();
+}
+
+BurstWidget::~BurstWidget() {
+}
+
+void BurstWidget::setupUI() {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+
+    QHBoxLayout *headerLayout = new QHBoxLayout();
+    m_summaryLabel = new QLabel("No burst captured yet (Tools > Capture Burst)", this);
+    m_summaryLabel->setStyleSheet("font-size: 14px; font-weight: bold;");
+    headerLayout->addWidget(m_summaryLabel, 1);
+
+    m_resetZoomButton = new QPushButton("Reset Zoom", this);
+    headerLayout->addWidget(m_resetZoomButton);
+    layout->addLayout(headerLayout);
+
+    m_overheadLabel = new QLabel(this);
+    layout->addWidget(m_overheadLabel);
+
+    // Setup chart
+    m_chart = new QChart();
+    m_chart->setTitle("Burst Capture");
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+
+    m_cpuSeries = new QLineSeries();
+    m_cpuSeries->setName("CPU %");
+    m_cpuSeries->setColor(QColor(42, 130, 218));
+
+    m_downloadSeries = new QLineSeries();
+    m_downloadSeries->setName("Download");
+    m_downloadSeries->setColor(QColor(5, 184, 204));
+
+    m_uploadSeries = new QLineSeries();
+    m_uploadSeries->setName("Upload");
+    m_uploadSeries->setColor(QColor(255, 107, 107));
+
+    m_diskReadSeries = new QLineSeries();
+    m_diskReadSeries->setName("Disk Read");
+    m_diskReadSeries->setColor(QColor(76, 175, 80));
+
+    m_diskWriteSeries = new QLineSeries();
+    m_diskWriteSeries->setName("Disk Write");
+    m_diskWriteSeries->setColor(QColor(255, 152, 0));
+
+    m_chart->addSeries(m_cpuSeries);
+    m_chart->addSeries(m_downloadSeries);
+    m_chart->addSeries(m_uploadSeries);
+    m_chart->addSeries(m_diskReadSeries);
+    m_chart->addSeries(m_diskWriteSeries);
+
+    // Setup axes
+    m_axisX = new QValueAxis();
+    m_axisX->setRange(0, 1000);
+    m_axisX->setLabelFormat("%.0f");
+    m_axisX->setTitleText("Time (ms)");
+
+    m_axisCpu = new QValueAxis();
+    m_axisCpu->setRange(0, 100);
+    m_axisCpu->setLabelFormat("%d");
+    m_axisCpu->setTitleText("CPU Usage (%)");
+
+    m_axisRate = new QValueAxis();
+    m_axisRate->setRange(0, 1);
+    m_axisRate->setLabelFormat("%.1f");
+    m_axisRate->setTitleText("Rate (MB/s)");
+
+    m_chart->addAxis(m_axisX, Qt::AlignBottom);
+    m_chart->addAxis(m_axisCpu, Qt::AlignLeft);
+    m_chart->addAxis(m_axisRate, Qt::AlignRight);
+
+    m_cpuSeries->attachAxis(m_axisX);
+    m_cpuSeries->attachAxis(m_axisCpu);
+    for (QLineSeries *series : {m_downloadSeries, m_uploadSeries, m_diskReadSeries, m_diskWriteSeries}) {
+        series->attachAxis(m_axisX);
+        series->attachAxis(m_axisRate);
+    }
+
+    m_chartView = new QChartView(m_chart, this);
+    m_chartView->setRenderHint(QPainter::Antialiasing);
+    m_chartView->setRubberBand(QChartView::HorizontalRubberBand);
+    layout->addWidget(m_chartView);
+
+    connect(m_resetZoomButton, &QPushButton::clicked, this, [this]() {
+        m_chart->zoomReset();
+    });
+
+    setLayout(layout);
+}
+
+void BurstWidget::setCapturing(int intervalMs, int windowMs) {
+    m_summaryLabel->setText(QString("Capturing every %1 ms for %2 ms...").arg(intervalMs).arg(windowMs));
+}
+
+void BurstWidget::setRecording(const BurstRecording& recording, const QString& savedPath) {
+    const size_t count = recording.sampleCount();
+
+    double meanCost = 0.0;
+    for (double cost : recording.costMicros) {
+        meanCost += cost;
+    }
+    meanCost = count > 0 ? meanCost / static_cast<double>(count) : 0.0;
+
+    m_summaryLabel->setText(QString("%1 samples every %2 ms over %3 ms, %4 dropped")
+        .arg(count)
+        .arg(recording.intervalMs)
+        .arg(recording.windowMs)
+        .arg(recording.droppedCount));
+
+    // Collector overhead relative to the sampling interval
+    double share = meanCost / (recording.intervalMs * 1000.0) * 100.0;
+    QString overhead = QString("Collector cost per sample: mean %1 us, p99 %2 us, max %3 us (%4% of the interval)")
+        .arg(meanCost, 0, 'f', 1)
+        .arg(recording.costPercentileMicros(99.0), 0, 'f', 1)
+        .arg(recording.costPercentileMicros(100.0), 0, 'f', 1)
+        .arg(share, 0, 'f', 1);
+    if (!savedPath.isEmpty()) {
+        overhead += "\nSaved to " + savedPath;
+    }
+    m_overheadLabel->setText(overhead);
+
+    // Replace the series in one call each (a capture holds up to 60000 points)
+    QList<QPointF> cpuPoints;
+    QList<QPointF> downloadPoints;
+    QList<QPointF> uploadPoints;
+    QList<QPointF> readPoints;
+    QList<QPointF> writePoints;
+    cpuPoints.reserve(static_cast<qsizetype>(count));
+    downloadPoints.reserve(static_cast<qsizetype>(count));
+    uploadPoints.reserve(static_cast<qsizetype>(count));
+    readPoints.reserve(static_cast<qsizetype>(count));
+    writePoints.reserve(static_cast<qsizetype>(count));
+
+    const double megabyte = 1024.0 * 1024.0;
+    double maxRate = 0.1;
+    for (size_t i = 0; i < count; i++) {
+        double time = recording.timeMs[i];
+        cpuPoints.append(QPointF(time, recording.cpuTotal[i]));
+        downloadPoints.append(QPointF(time, recording.netDownloadBps[i] / megabyte));
+        uploadPoints.append(QPointF(time, recording.netUploadBps[i] / megabyte));
+        readPoints.append(QPointF(time, recording.diskReadBps[i] / megabyte));
+        writePoints.append(QPointF(time, recording.diskWriteBps[i] / megabyte));
+
+        maxRate = qMax(maxRate, qMax(downloadPoints.back().y(), uploadPoints.back().y()));
+        maxRate = qMax(maxRate, qMax(readPoints.back().y(), writePoints.back().y()));
+    }
+
+    m_cpuSeries->replace(cpuPoints);
+    m_downloadSeries->replace(downloadPoints);
+    m_uploadSeries->replace(uploadPoints);
+    m_diskReadSeries->replace(readPoints);
+    m_diskWriteSeries->replace(writePoints);
+
+    m_chart->zoomReset();
+    m_axisX->setRange(0, count > 0 ? recording.timeMs.back() : recording.windowMs);
+    m_axisRate->setRange(0, maxRate * 1.2);
+}
@@ -1,12 +1,24 @@
 #include "ui/CPUWidget.h"
 #include "monitors/CPUMonitor.h"
-#include "utils/SystemUtils.h"
+#include "monitors/PerfMonitor.h"
+#include "monitors/SchedMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "core/AnomalyDetector.h"
+#include "core/MetricSchema.h"
+#include "ui/CoreHeatmapWidget.h"
 #include <QString>
+#include <algorithm>
 
 CPUWidget::CPUWidget(CPUMonitor *monitor, QWidget *parent)
     : QWidget(parent)
     , m_monitor(monitor)
-    , m_maxDataPoints(60)
+    , m_lastColumnUs(0)
+    , m_historySeconds(60)
+    , m_anomalyDetector(nullptr)
+    , m_anomalySeriesId(-1)
+    , m_perfMonitor(nullptr)
+    , m_schedMonitor(nullptr)
+    , m_processMonitor(nullptr)
 {
     setupUI();
 }
@@ -25,6 +37,26 @@ void CPUWidget::setupUI() {
     m_coreCountLabel->setStyleSheet("font-size: 14px;");
     layout->addWidget(m_coreCountLabel);
     
+    m_thermalLabel = new QLabel(this);
+    m_thermalLabel->setStyleSheet("font-size: 14px;");
+    m_thermalLabel->setVisible(false);
+    layout->addWidget(m_thermalLabel);
+    
+    m_perfLabel = new QLabel(this);
+    m_perfLabel->setStyleSheet("font-size: 14px;");
+    m_perfLabel->setVisible(false);
+    layout->addWidget(m_perfLabel);
+    
+    m_schedLabel = new QLabel(this);
+    m_schedLabel->setStyleSheet("font-size: 14px;");
+    m_schedLabel->setVisible(false);
+    layout->addWidget(m_schedLabel);
+
+    m_exitLabel = new QLabel(this);
+    m_exitLabel->setStyleSheet("font-size: 14px;");
+    m_exitLabel->setVisible(false);
+    layout->addWidget(m_exitLabel);
+    
     // Setup chart
     m_chart = new QChart();
     m_chart->setTitle("CPU Usage History");
@@ -34,9 +66,34 @@ void CPUWidget::setupUI() {
     m_series->setName("CPU %");
     m_chart->addSeries(m_series);
     
+    // Clock and temperature next to usage: 50% usage at half clock is
+    // not the same load as 50% at full clock
+    m_frequencySeries = new QLineSeries();
+    m_frequencySeries->setName("Frequency % of max");
+    m_frequencySeries->setColor(QColor(76, 175, 80));
+    m_chart->addSeries(m_frequencySeries);
+    
+    m_temperatureSeries = new QLineSeries();
+    m_temperatureSeries->setName("Max temperature");
+    m_temperatureSeries->setColor(QColor(255, 152, 0));
+    m_chart->addSeries(m_temperatureSeries);
+    
+    // Time spent runnable but not running, on the usage axis
+    m_waitSeries = new QLineSeries();
+    m_waitSeries->setName("Waiting to run %");
+    m_waitSeries->setColor(QColor(156, 39, 176));
+    m_waitSeries->setVisible(false);
+    m_chart->addSeries(m_waitSeries);
+    
+    m_anomalySeries = new QScatterSeries();
+    m_anomalySeries->setName("Anomaly");
+    m_anomalySeries->setColor(QColor(255, 107, 107));
+    m_anomalySeries->setMarkerSize(10.0);
+    m_chart->addSeries(m_anomalySeries);
+    
     // Setup axes
     m_axisX = new QValueAxis();
-    m_axisX->setRange(0, m_maxDataPoints);
+    m_axisX->setRange(0, m_historySeconds);
     m_axisX->setLabelFormat("%d");
     m_axisX->setTitleText("Time (seconds)");
     
@@ -45,18 +102,75 @@ void CPUWidget::setupUI() {
     m_axisY->setLabelFormat("%.0f%%");
     m_axisY->setTitleText("Usage");
     
+    m_axisTemperature = new QValueAxis();
+    m_axisTemperature->setRange(0, 110);
+    m_axisTemperature->setLabelFormat("%.0f");
+    m_axisTemperature->setTitleText("Temperature (C)");
+    
     m_chart->addAxis(m_axisX, Qt::AlignBottom);
     m_chart->addAxis(m_axisY, Qt::AlignLeft);
+    m_chart->addAxis(m_axisTemperature, Qt::AlignRight);
     m_series->attachAxis(m_axisX);
     m_series->attachAxis(m_axisY);
+    m_frequencySeries->attachAxis(m_axisX);
+    m_frequencySeries->attachAxis(m_axisY);
+    m_temperatureSeries->attachAxis(m_axisX);
+    m_temperatureSeries->attachAxis(m_axisTemperature);
+    m_waitSeries->attachAxis(m_axisX);
+    m_waitSeries->attachAxis(m_axisY);
+    m_anomalySeries->attachAxis(m_axisX);
+    m_anomalySeries->attachAxis(m_axisY);
     
     m_chartView = new QChartView(m_chart, this);
     m_chartView->setRenderHint(QPainter::Antialiasing);
     layout->addWidget(m_chartView);
     
+    // Per-core history as a heatmap (one row per core)
+    m_heatmapLabel = new QLabel("Per-core usage", this);
+    m_heatmapLabel->setStyleSheet("font-size: 14px;");
+    layout->addWidget(m_heatmapLabel);
+    
+    m_heatmap = new CoreHeatmapWidget(m_historySeconds, this);
+    layout->addWidget(m_heatmap);
+    
     setLayout(layout);
 }
 
+void CPUWidget::recordSample(uint64_t timestampUs) {
+    if (!m_monitor || !m_monitor->isInitialized()) {
+        return;
+    }
+    
+    // Update heatmap, one column per second so idle ticks keep its scale
+    int columns = 1;
+    if (m_lastColumnUs != 0) {
+        columns = static_cast<int>((timestampUs - m_lastColumnUs + 500000) / 1000000);
+        columns = std::clamp(columns, 1, m_historySeconds);
+    }
+    const auto& coreUsages = m_monitor->getCoreUsages();
+    for (int i = 0; i < columns; i++) {
+        m_heatmap->appendColumn(coreUsages.data(), static_cast<int>(coreUsages.size()));
+    }
+    m_lastColumnUs = timestampUs;
+    
+    bool sched = m_schedMonitor && m_schedMonitor->isInitialized();
+    m_dataPoints.push_back(m_monitor->getTotalUsage());
+    m_frequencyPoints.push_back(m_monitor->getAverageFrequencyPercent());
+    m_temperaturePoints.push_back(m_monitor->getMaxTemperature());
+    m_waitPoints.push_back(sched ? m_schedMonitor->getWaitPercent() : 0.0);
+    m_anomalyFlags.push_back(m_anomalyDetector && m_anomalyDetector->isAnomalous(m_anomalySeriesId));
+    m_timestamps.push_back(timestampUs);
+    const uint64_t spanUs = static_cast<uint64_t>(m_historySeconds) * 1000000;
+    while (timestampUs - m_timestamps.front() > spanUs) {
+        m_dataPoints.pop_front();
+        m_frequencyPoints.pop_front();
+        m_temperaturePoints.pop_front();
+        m_waitPoints.pop_front();
+        m_anomalyFlags.pop_front();
+        m_timestamps.pop_front();
+    }
+}
+
 void CPUWidget::updateData() {
     if (!m_monitor || !m_monitor->isInitialized()) {
         return;
@@ -66,18 +180,104 @@ void CPUWidget::updateData() {
     int coreCount = m_monitor->getCoreCount();
     
     // Update labels
-    QString usageStr = QString::fromStdWString(SystemUtils::formatPercent(usage, 1));
+    QString usageStr = QString::fromStdWString(formatMetric<MetricId::CpuTotal>(usage));
     m_usageLabel->setText("CPU Usage: " + usageStr);
     m_coreCountLabel->setText("Cores: " + QString::number(coreCount));
     
-    // Update chart
-    m_dataPoints.push_back(usage);
-    if (m_dataPoints.size() > static_cast<size_t>(m_maxDataPoints)) {
-        m_dataPoints.pop_front();
+    // Frequency, throttling and temperature
+    bool thermals = m_monitor->hasThermalData();
+    m_thermalLabel->setVisible(thermals);
+    m_frequencySeries->setVisible(thermals);
+    m_temperatureSeries->setVisible(thermals && m_monitor->getSensorCount() > 0);
+    m_axisTemperature->setVisible(thermals && m_monitor->getSensorCount() > 0);
+    if (thermals) {
+        QString text = QString("Frequency: %1% of max, %2 of %3 cores throttled")
+            .arg(m_monitor->getAverageFrequencyPercent(), 0, 'f', 0)
+            .arg(m_monitor->getThrottledCoreCount())
+            .arg(coreCount);
+        if (m_monitor->getSensorCount() > 0) {
+            text += QString(", hottest sensor %1 C").arg(m_monitor->getMaxTemperature(), 0, 'f', 0);
+        }
+        m_thermalLabel->setText(text);
+    }
+    
+    // IPC and scheduler events: low IPC at high usage means stalls,
+    // many switches at high usage means scheduling overhead
+    bool perf = m_perfMonitor && m_perfMonitor->isInitialized();
+    m_perfLabel->setVisible(perf);
+    if (perf) {
+        double ipc = m_perfMonitor->getIpc();
+        QString text = QString("IPC: %1").arg(ipc < 0.0 ? QString("n/a") : QString::number(ipc, 'f', 2));
+        const PerfCounters::Event events[] = {
+            PerfCounters::ContextSwitches, PerfCounters::PageFaults, PerfCounters::Migrations
+        };
+        const char *labels[] = {"switches/s", "faults/s", "migrations/s"};
+        for (int i = 0; i < 3; i++) {
+            if (m_perfMonitor->isAvailable(events[i])) {
+                text += QString(", %1 %2").arg(m_perfMonitor->getRate(events[i]), 0, 'f', 0).arg(labels[i]);
+            }
+        }
+        m_perfLabel->setText(text);
+    }
+    
+    // Run-queue wait
+    bool sched = m_schedMonitor && m_schedMonitor->isInitialized();
+    m_schedLabel->setVisible(sched);
+    m_waitSeries->setVisible(sched);
+    if (sched) {
+        m_schedLabel->setText(QString("Waiting to run: %1% per CPU, %2 timeslices/s, %3 us wait per timeslice")
+            .arg(m_schedMonitor->getWaitPercent(), 0, 'f', 1)
+            .arg(m_schedMonitor->getTimesliceRate(), 0, 'f', 0)
+            .arg(m_schedMonitor->getWaitPerTimesliceMicros(), 0, 'f', 1));
+    }
+    
+    // Short-lived processes: their CPU is not in any live process row
+    bool exits = m_processMonitor && m_processMonitor->isInitialized();
+    m_exitLabel->setVisible(exits);
+    if (exits) {
+        m_exitLabel->setText(QString("Exited processes: %1/s using %2 cores (%3)")
+            .arg(m_processMonitor->getExitRate(), 0, 'f', 1)
+            .arg(m_processMonitor->getExitedCpuRate(), 0, 'f', 2)
+            .arg(m_processMonitor->isEventDriven() ? "events" : "polling, short-lived processes missed"));
     }
     
+    // Update chart
     m_series->clear();
+    m_frequencySeries->clear();
+    m_temperatureSeries->clear();
+    m_waitSeries->clear();
+    m_anomalySeries->clear();
     for (size_t i = 0; i < m_dataPoints.size(); i++) {
-        m_series->append(i, m_dataPoints[i]);
+        // Seconds on the axis, newest point at its right end
+        double x = m_historySeconds
+            - static_cast<double>(m_timestamps.back() - m_timestamps[i]) / 1000000.0;
+        m_series->append(x, m_dataPoints[i]);
+        if (thermals) {
+            m_frequencySeries->append(x, qMin(m_frequencyPoints[i], 100.0));
+            m_temperatureSeries->append(x, m_temperaturePoints[i]);
+        }
+        if (sched) {
+            m_waitSeries->append(x, qMin(m_waitPoints[i], 100.0));
+        }
+        if (m_anomalyFlags[i]) {
+            m_anomalySeries->append(x, m_dataPoints[i]);
+        }
     }
 }
+
+void CPUWidget::setAnomalySource(const AnomalyDetector *detector, int seriesId) {
+    m_anomalyDetector = detector;
+    m_anomalySeriesId = seriesId;
+}
+
+void CPUWidget::setPerfSource(const PerfMonitor *monitor) {
+    m_perfMonitor = monitor;
+}
+
+void CPUWidget::setSchedSource(const SchedMonitor *monitor) {
+    m_schedMonitor = monitor;
+}
+
+void CPUWidget::setProcessSource(const ProcessMonitor *monitor) {
+    m_processMonitor = monitor;
+}
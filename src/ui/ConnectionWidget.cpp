@@ -0,0 +1,68 @@
+#include "ui/ConnectionWidget.h"
+#include "monitors/ConnectionMonitor.h"
+#include "ui/NameText.h"
+#include "utils/SystemUtils.h"
+#include <QHeaderView>
+#include <QString>
+
+ConnectionWidget::ConnectionWidget(ConnectionMonitor *monitor, QWidget *parent)
+    : QWidget(parent)
+    , m_monitor(monitor)
+{
+    setupUI();
+}
+
+ConnectionWidget::~ConnectionWidget() {
+}
+
+void ConnectionWidget::setupUI() {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    
+    m_summaryLabel = new QLabel("Connections: 0", this);
+    m_summaryLabel->setStyleSheet("font-size: 18px; font-weight: bold;");
+    layout->addWidget(m_summaryLabel);
+    
+    m_tableWidget = new QTableWidget(this);
+    m_tableWidget->setColumnCount(6);
+    m_tableWidget->setHorizontalHeaderLabels({
+        "Process", "PID", "Local", "Remote", "Download", "Upload"
+    });
+    
+    m_tableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_tableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    
+    layout->addWidget(m_tableWidget);
+    setLayout(layout);
+}
+
+void ConnectionWidget::updateData() {
+    if (!m_monitor || !m_monitor->isInitialized()) {
+        return;
+    }
+    
+    m_summaryLabel->setText(QString("Connections: %1 - Download %2, Upload %3")
+        .arg(m_monitor->getConnectionCount())
+        .arg(QString::fromStdWString(SystemUtils::formatSpeed(m_monitor->getTotalReceiveRate())))
+        .arg(QString::fromStdWString(SystemUtils::formatSpeed(m_monitor->getTotalSendRate()))));
+    
+    const auto& flows = m_monitor->getTopFlows();
+    m_tableWidget->setRowCount(static_cast<int>(flows.size()));
+    
+    for (size_t i = 0; i < flows.size(); i++) {
+        const FlowInfo& flow = flows[i];
+        int row = static_cast<int>(i);
+        
+        m_tableWidget->setItem(row, 0, new QTableWidgetItem(
+            NameText::get(flow.process, "-")));
+        m_tableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(flow.pid)));
+        m_tableWidget->setItem(row, 2, new QTableWidgetItem(QString::fromStdString(flow.local)));
+        m_tableWidget->setItem(row, 3, new QTableWidgetItem(QString::fromStdString(flow.remote)));
+        m_tableWidget->setItem(row, 4, new QTableWidgetItem(
+            QString::fromStdWString(SystemUtils::formatSpeed(flow.receiveRate))));
+        m_tableWidget->setItem(row, 5, new QTableWidgetItem(
+            QString::fromStdWString(SystemUtils::formatSpeed(flow.sendRate))));
+    }
+    
+    m_tableWidget->resizeColumnsToContents();
+}
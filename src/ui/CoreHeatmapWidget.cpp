@@ -0,0 +1,75 @@
+#include "ui/CoreHeatmapWidget.h"
+#include <QPainter>
+#include <QColor>
+
+CoreHeatmapWidget::CoreHeatmapWidget(int historyLength, QWidget *parent)
+    : QWidget(parent)
+    , m_historyLength(historyLength)
+    , m_nextColumn(0)
+{
+    setMinimumHeight(120);
+    buildPalette();
+}
+
+CoreHeatmapWidget::~CoreHeatmapWidget() {
+}
+
+void CoreHeatmapWidget::appendColumn(const double *usages, int count) {
+    if (count <= 0) {
+        return;
+    }
+
+    // Core count changed (or first tick): start a fresh history
+    if (m_image.height() != count) {
+        m_image = QImage(m_historyLength, count, QImage::Format_RGB32);
+        m_image.fill(m_palette[0]);
+        m_nextColumn = 0;
+    }
+
+    uchar *bits = m_image.bits();
+    const qsizetype bytesPerLine = m_image.bytesPerLine();
+    for (int core = 0; core < count; core++) {
+        int percent = static_cast<int>(usages[core] + 0.5);
+        percent = percent < 0 ? 0 : (percent > 100 ? 100 : percent);
+        reinterpret_cast<QRgb *>(bits + core * bytesPerLine)[m_nextColumn] = m_palette[percent];
+    }
+
+    m_nextColumn = (m_nextColumn + 1) % m_historyLength;
+
+    update();
+}
+
+void CoreHeatmapWidget::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), m_palette[0]);
+
+    if (m_image.isNull()) {
+        return;
+    }
+
+    // Oldest columns start at m_nextColumn; newest column ends at the right edge
+    const double columnWidth = static_cast<double>(width()) / m_historyLength;
+    const int tail = m_historyLength - m_nextColumn;    // Columns [m_nextColumn, end)
+    const int head = m_nextColumn;                      // Columns [0, m_nextColumn)
+
+    QRectF tailTarget(0.0, 0.0, tail * columnWidth, height());
+    QRectF headTarget(tail * columnWidth, 0.0, head * columnWidth, height());
+
+    if (tail > 0) {
+        painter.drawImage(tailTarget, m_image, QRectF(m_nextColumn, 0, tail, m_image.height()));
+    }
+    if (head > 0) {
+        painter.drawImage(headTarget, m_image, QRectF(0, 0, head, m_image.height()));
+    }
+}
+
+void CoreHeatmapWidget::buildPalette() {
+    m_palette.resize(101);
+    for (int percent = 0; percent <= 100; percent++) {
+        // Hue 240 (blue, idle) down to 0 (red, saturated)
+        int hue = 240 - percent * 240 / 100;
+        m_palette[percent] = QColor::fromHsv(hue, 200, 60 + percent * 195 / 100).rgb();
+    }
+}
@@ -1,12 +1,16 @@
 #include "ui/DiskWidget.h"
 #include "monitors/DiskMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "ui/NameText.h"
 #include "utils/SystemUtils.h"
 #include <QHeaderView>
+#include <QHBoxLayout>
 #include <QString>
 
 DiskWidget::DiskWidget(DiskMonitor *monitor, QWidget *parent)
     : QWidget(parent)
     , m_monitor(monitor)
+    , m_processMonitor(nullptr)
 {
     setupUI();
 }
@@ -28,6 +32,22 @@ void DiskWidget::setupUI() {
     m_tableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
     
     layout->addWidget(m_tableWidget);
+    
+    // Top writers and readers side by side
+    QHBoxLayout *processLayout = new QHBoxLayout();
+    m_writersTable = new QTableWidget(this);
+    m_readersTable = new QTableWidget(this);
+    for (QTableWidget *table : {m_writersTable, m_readersTable}) {
+        table->setColumnCount(4);
+        table->horizontalHeader()->setStretchLastSection(true);
+        table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        table->setSelectionBehavior(QAbstractItemView::SelectRows);
+        processLayout->addWidget(table);
+    }
+    m_writersTable->setHorizontalHeaderLabels({"Top Writers", "PID", "Write", "Writes/s"});
+    m_readersTable->setHorizontalHeaderLabels({"Top Readers", "PID", "Read", "Reads/s"});
+    layout->addLayout(processLayout);
+    
     setLayout(layout);
 }
 
@@ -36,6 +56,12 @@ void DiskWidget::updateData() {
         return;
 }
     
+    // Volume names and file systems are only read once the tab is shown,
+    // on a worker thread; they appear after the next update
+    if (isVisible()) {
+        m_monitor->describeVolumes();
+    }
+
     const auto& disks = m_monitor->getDiskInfo();
     m_tableWidget->setRowCount(static_cast<int>(disks.size()));
     
@@ -43,11 +69,11 @@ void DiskWidget::updateData() {
         const auto& disk = disks[i];
         
         m_tableWidget->setItem(i, 0, new QTableWidgetItem(
-            QString::fromStdWString(disk.driveLetter)));
+            NameText::get(disk.driveLetter)));
         m_tableWidget->setItem(i, 1, new QTableWidgetItem(
-            QString::fromStdWString(disk.volumeName)));
+            NameText::get(disk.volumeName)));
         m_tableWidget->setItem(i, 2, new QTableWidgetItem(
-            QString::fromStdWString(disk.fileSystem)));
+            NameText::get(disk.fileSystem)));
         m_tableWidget->setItem(i, 3, new QTableWidgetItem(
             QString::fromStdWString(SystemUtils::formatBytes(disk.totalSpace))));
         m_tableWidget->setItem(i, 4, new QTableWidgetItem(
@@ -62,4 +88,32 @@ void DiskWidget::updateData() {
     }
     
     m_tableWidget->resizeColumnsToContents();
+    
+    if (m_processMonitor && m_processMonitor->isInitialized()) {
+        fillProcessTable(m_writersTable, m_processMonitor->getTopWriters(), true);
+        fillProcessTable(m_readersTable, m_processMonitor->getTopReaders(), false);
+    }
+}
+
+void DiskWidget::setProcessSource(const ProcessMonitor *monitor) {
+    m_processMonitor = monitor;
+}
+
+void DiskWidget::fillProcessTable(QTableWidget *table, const std::vector<ProcessIoInfo>& processes, bool writes) {
+    table->setRowCount(static_cast<int>(processes.size()));
+    
+    for (size_t i = 0; i < processes.size(); i++) {
+        const ProcessIoInfo& process = processes[i];
+        int row = static_cast<int>(i);
+        
+        table->setItem(row, 0, new QTableWidgetItem(
+            NameText::get(process.name, "-")));
+        table->setItem(row, 1, new QTableWidgetItem(QString::number(process.pid)));
+        table->setItem(row, 2, new QTableWidgetItem(QString::fromStdWString(
+            SystemUtils::formatSpeed(writes ? process.writeRate : process.readRate))));
+        table->setItem(row, 3, new QTableWidgetItem(
+            QString::number(writes ? process.writeOpsRate : process.readOpsRate, 'f', 0)));
+    }
+    
+    table->resizeColumnsToContents();
 }
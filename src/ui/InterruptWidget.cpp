@@ -0,0 +1,96 @@
+#include "ui/InterruptWidget.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/CPUMonitor.h"
+#include <QHeaderView>
+#include <QString>
+#include <QStringList>
+
+InterruptWidget::InterruptWidget(InterruptMonitor *monitor, CPUMonitor *cpuMonitor, QWidget *parent)
+    : QWidget(parent)
+    , m_monitor(monitor)
+    , m_cpuMonitor(cpuMonitor)
+{
+    setupUI();
+}
+
+InterruptWidget::~InterruptWidget() {
+}
+
+void InterruptWidget::setupUI() {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    
+    m_summaryLabel = new QLabel("Interrupts: 0/s", this);
+    m_summaryLabel->setStyleSheet("font-size: 18px; font-weight: bold;");
+    layout->addWidget(m_summaryLabel);
+    
+    m_tableWidget = new QTableWidget(this);
+    m_tableWidget->setColumnCount(6);
+    m_tableWidget->setHorizontalHeaderLabels({
+        "Core", "IRQ/s", "Softirq/s", "IRQ %", "Softirq %", "Top Sources"
+    });
+    
+    m_tableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_tableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    
+    layout->addWidget(m_tableWidget);
+    setLayout(layout);
+}
+
+void InterruptWidget::updateData() {
+    if (!m_monitor || !m_monitor->isInitialized()) {
+        return;
+    }
+    
+    const int cpuCount = m_monitor->getCpuCount();
+    const bool haveBreakdown = m_cpuMonitor && m_cpuMonitor->isInitialized();
+    m_tableWidget->setRowCount(cpuCount);
+    
+    double totalRate = 0.0;
+    double totalDeferredRate = 0.0;
+    int hotspots = 0;
+    const QColor hotspotColor(255, 193, 7, 96);
+    
+    for (int cpu = 0; cpu < cpuCount; cpu++) {
+        double rate = m_monitor->getCpuRate(cpu);
+        double deferredRate = m_monitor->getCpuDeferredRate(cpu);
+        totalRate += rate;
+        totalDeferredRate += deferredRate;
+        
+        QStringList sources;
+        for (int source : m_monitor->getTopSources(cpu, TOP_SOURCES)) {
+            sources << QString("%1 (%2/s)")
+                .arg(QString::fromStdString(m_monitor->getSourceName(source)))
+                .arg(m_monitor->getRate(source, cpu), 0, 'f', 0);
+        }
+        
+        m_tableWidget->setItem(cpu, 0, new QTableWidgetItem(
+            QString("Core %1").arg(cpu)));
+        m_tableWidget->setItem(cpu, 1, new QTableWidgetItem(
+            QString::number(rate, 'f', 0)));
+        m_tableWidget->setItem(cpu, 2, new QTableWidgetItem(
+            QString::number(deferredRate, 'f', 0)));
+        m_tableWidget->setItem(cpu, 3, new QTableWidgetItem(haveBreakdown
+            ? QString::number(m_cpuMonitor->getCoreBreakdown(cpu, CPUTimes::Irq), 'f', 1) : QString("-")));
+        m_tableWidget->setItem(cpu, 4, new QTableWidgetItem(haveBreakdown
+            ? QString::number(m_cpuMonitor->getCoreBreakdown(cpu, CPUTimes::SoftIrq), 'f', 1) : QString("-")));
+        m_tableWidget->setItem(cpu, 5, new QTableWidgetItem(sources.join(", ")));
+        
+        if (m_monitor->isHotspot(cpu)) {
+            hotspots++;
+            for (int column = 0; column < m_tableWidget->columnCount(); column++) {
+                m_tableWidget->item(cpu, column)->setBackground(hotspotColor);
+            }
+        }
+    }
+    
+    QString summary = QString("Interrupts: %1/s, Softirq: %2/s")
+        .arg(totalRate, 0, 'f', 0)
+        .arg(totalDeferredRate, 0, 'f', 0);
+    if (hotspots > 0) {
+        summary += QString(" - %1 hotspot core(s)").arg(hotspots);
+    }
+    m_summaryLabel->setText(summary);
+    
+    m_tableWidget->resizeColumnsToContents();
+}
@@ -3,85 +3,388 @@
 #include "ui/RAMWidget.h"
 #include "ui/DiskWidget.h"
 #include "ui/NetworkWidget.h"
+#include "ui/SelfWidget.h"
+#include "ui/BurstWidget.h"
+#include "ui/InterruptWidget.h"
+#include "ui/NumaWidget.h"
+#include "ui/ConnectionWidget.h"
 #include "monitors/CPUMonitor.h"
 #include "monitors/RAMMonitor.h"
 #include "monitors/DiskMonitor.h"
 #include "monitors/NetworkMonitor.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/NumaMonitor.h"
+#include "monitors/PerfMonitor.h"
+#include "monitors/SchedMonitor.h"
+#include "monitors/NetStackMonitor.h"
+#include "monitors/ConnectionMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "monitors/FixtureDataSources.h"
+#include "monitors/BurstSampler.h"
+#include "monitors/BuiltinCollectors.h"
+#include "core/CollectorRegistry.h"
+#include "core/MetricTable.h"
+#include "core/AlertEngine.h"
+#include "core/AnomalyDetector.h"
+#include "core/SelfStats.h"
+#include "core/NameTable.h"
+#include "ui/TrayAlertSink.h"
+#include "utils/SystemUtils.h"
 
 #include <QMenuBar>
 #include <QAction>
 #include <QCloseEvent>
+#include <QPaintEvent>
+#include <QShowEvent>
+#include <QHideEvent>
+#include <QStatusBar>
 #include <QMessageBox>
 #include <QApplication>
+#include <QDir>
+#include <QDateTime>
+#include <QSysInfo>
+#include <cstring>
+#include <fstream>
 
-MainWindow::MainWindow(QWidget *parent)
+MainWindow::MainWindow(QWidget *parent, const QString& fixtureRoot, const QString& alertLog,
+                       uint64_t startUs)
     : QMainWindow(parent)
     , m_tabWidget(nullptr)
     , m_cpuWidget(nullptr)
     , m_ramWidget(nullptr)
     , m_diskWidget(nullptr)
     , m_networkWidget(nullptr)
+    , m_selfWidget(nullptr)
+    , m_burstWidget(nullptr)
+    , m_interruptWidget(nullptr)
+    , m_numaWidget(nullptr)
+    , m_connectionWidget(nullptr)
+    , m_collectorRegistry(nullptr)
     , m_cpuMonitor(nullptr)
     , m_ramMonitor(nullptr)
     , m_diskMonitor(nullptr)
     , m_networkMonitor(nullptr)
+    , m_interruptMonitor(nullptr)
+    , m_numaMonitor(nullptr)
+    , m_perfMonitor(nullptr)
+    , m_schedMonitor(nullptr)
+    , m_netStackMonitor(nullptr)
+    , m_connectionMonitor(nullptr)
+    , m_processMonitor(nullptr)
+    , m_metrics(nullptr)
+    , m_alertEngine(nullptr)
+    , m_anomalyDetector(nullptr)
+    , m_trayAlertSink(nullptr)
+    , m_alertLog(nullptr)
+    , m_alertLogSink(nullptr)
+    , m_tickClock(UPDATE_INTERVAL_MS * 1000ULL)
+    , m_burstSampler(nullptr)
+    , m_burstAlertSink(nullptr)
+    , m_burstTimer(nullptr)
     , m_trayIcon(nullptr)
     , m_trayMenu(nullptr)
     , m_updateTimer(nullptr)
+    , m_startupTimer(nullptr)
+    , m_rendering(true)
+    , m_startUs(startUs != 0 ? startUs : SystemUtils::monotonicMicros())
+    , m_firstFrameUs(0)
+    , m_firstDataUs(0)
+    , m_fixtureRoot(fixtureRoot)
+    , m_alertLogPath(alertLog)
 {
     setWindowTitle("System Monitor");
     setMinimumSize(900, 600);
     
+    // Collectors initialize in the background while the window shows
     initializeMonitors();
     setupUI();
     setupMenuBar();
     setupSystemTray();
     
-    // Setup update timer
+    // Setup update timer, started by finishStartup()
     m_updateTimer = new QTimer(this);
     connect(m_updateTimer, &QTimer::timeout, this, &MainWindow::updateMonitors);
-    m_updateTimer->start(UPDATE_INTERVAL_MS);
     
-    // Initial update
-    updateMonitors();
+    m_burstTimer = new QTimer(this);
+    connect(m_burstTimer, &QTimer::timeout, this, &MainWindow::checkBurst);
+    
+    m_startupTimer = new QTimer(this);
+    connect(m_startupTimer, &QTimer::timeout, this, &MainWindow::checkStartup);
+    m_startupTimer->start(STARTUP_POLL_MS);
+    statusBar()->showMessage("Starting collectors...");
 }
 
 MainWindow::~MainWindow() {
-    delete m_cpuMonitor;
-    delete m_ramMonitor;
-    delete m_diskMonitor;
-    delete m_networkMonitor;
+    m_startup.wait();
+    m_collectors.clear();
+    delete m_collectorRegistry;
+    delete m_alertEngine;
+    delete m_anomalyDetector;
+    delete m_trayAlertSink;
+    delete m_alertLogSink;
+    delete m_alertLog;
+    delete m_burstAlertSink;
+    delete m_burstSampler;
+    delete m_metrics;
+}
+
+template<typename T>
+T* MainWindow::findCollector(const char* name) const {
+    for (const auto& collector : m_collectors) {
+        if (std::strcmp(collector->name(), name) == 0) {
+            return dynamic_cast<T*>(collector.get());
+        }
+    }
+    return nullptr;
 }
 
 void MainWindow::initializeMonitors() {
-    m_cpuMonitor = new CPUMonitor();
-    m_cpuMonitor->initialize();
-    
-    m_ramMonitor = new RAMMonitor();
-    m_ramMonitor->initialize();
-    
-    m_diskMonitor = new DiskMonitor();
-    m_diskMonitor->initialize();
-    
-    m_networkMonitor = new NetworkMonitor();
-    m_networkMonitor->initialize();
+    // Compiled-in collectors, then plugins; collectors.conf next to the
+    // executable turns collectors off per host
+    QDir appDir(QApplication::applicationDirPath());
+    m_collectorRegistry = new CollectorRegistry();
+    registerBuiltinCollectors(*m_collectorRegistry);
+    m_collectorRegistry->loadPlugins(appDir.filePath("plugins").toStdWString());
+    std::ifstream config(appDir.filePath("collectors.conf").toStdString());
+    if (config) {
+        m_collectorRegistry->loadConfig(config, QSysInfo::machineHostName().toStdString());
+    }
+
+    CollectorContext context;
+    if (!m_fixtureRoot.isEmpty()) {
+        context.fixtureRoot = std::filesystem::path(m_fixtureRoot.toStdWString());
+        setWindowTitle("System Monitor (fixtures: " + m_fixtureRoot + ")");
+    }
+    m_collectors = m_collectorRegistry->createEnabled(context);
+
+    // Typed views for the widgets (nullptr if disabled)
+    m_cpuMonitor = findCollector<CPUMonitor>("cpu");
+    m_ramMonitor = findCollector<RAMMonitor>("ram");
+    m_diskMonitor = findCollector<DiskMonitor>("disk");
+    m_networkMonitor = findCollector<NetworkMonitor>("network");
+    m_interruptMonitor = findCollector<InterruptMonitor>("interrupts");
+    m_numaMonitor = findCollector<NumaMonitor>("numa");
+    m_perfMonitor = findCollector<PerfMonitor>("perf");
+    m_schedMonitor = findCollector<SchedMonitor>("sched");
+    m_netStackMonitor = findCollector<NetStackMonitor>("netstack");
+    m_connectionMonitor = findCollector<ConnectionMonitor>("connections");
+    m_processMonitor = findCollector<ProcessMonitor>("processes");
+    if (m_numaMonitor) {
+        m_numaMonitor->setCpuSource(m_cpuMonitor);
+    }
+
+    // Burst captures run on demand with their own sources
+    if (context.fixtureRoot.empty()) {
+        m_burstSampler = new BurstSampler(createDefaultCPUDataSource(),
+                                          createDefaultNetworkDataSource(),
+                                          createDefaultDiskDataSource());
+    } else {
+        m_burstSampler = new BurstSampler(std::make_unique<FixtureCPUDataSource>(context.fixtureRoot),
+                                          std::make_unique<FixtureNetworkDataSource>(context.fixtureRoot),
+                                          std::make_unique<FixtureDiskDataSource>(context.fixtureRoot));
+    }
+
+    // Initialize concurrently; a collector that fails to initialize
+    // (e.g. perf) publishes nothing and the UI hides its data
+    for (const auto& collector : m_collectors) {
+        bool deferred = collector.get() == m_numaMonitor || collector.get() == m_connectionMonitor;
+        m_startup.add(collector.get(), deferred);
+    }
+    m_startup.start();
+}
+
+void MainWindow::finishStartup() {
+    setupAlerts();
+    startWatchedCollectors();
+    updatePlaceholders();
+
+    m_updateTimer->start(updateInterval());
+    updateMonitors();
+    m_firstDataUs = SystemUtils::monotonicMicros();
+    reportStartup();
+}
+
+void MainWindow::checkStartup() {
+    for (Collector *collector : m_startup.poll()) {
+        // Collectors of the startup set register in finishStartup()
+        if (m_metrics) {
+            collector->registerSeries(*m_metrics);
+        }
+    }
+
+    if (!m_metrics) {
+        if (!m_startup.isStarting()) {
+            finishStartup();
+        }
+    } else {
+        updatePlaceholders();
+    }
+
+    if (m_metrics && !m_startup.isBusy()) {
+        m_startupTimer->stop();
+    }
+}
+
+Collector* MainWindow::deferredCollector(QWidget *page) const {
+    if (page && page == m_numaWidget) {
+        return m_numaMonitor;
+    }
+    if (page && page == m_connectionWidget) {
+        return m_connectionMonitor;
+    }
+    return nullptr;
+}
+
+void MainWindow::startWatchedCollectors() {
+    // Without a rule, numa.* and net.connections stay empty until the tab
+    // is first opened; checkStartup() registers the series once ready
+    const std::pair<Collector*, std::string> watched[] = {
+        {m_numaMonitor, "numa."},
+        {m_connectionMonitor, MetricSchema::def(MetricId::NetConnections).name},
+    };
+    for (const auto& entry : watched) {
+        if (entry.first && m_alertEngine->referencesSeries(entry.second) && m_startup.start(entry.first)) {
+            m_startupTimer->start(STARTUP_POLL_MS);
+        }
+    }
+}
+
+void MainWindow::tabChanged(int index) {
+    Collector *collector = deferredCollector(m_tabWidget->widget(index));
+    if (collector && m_startup.start(collector)) {
+        m_startupTimer->start(STARTUP_POLL_MS);
+    }
+
+    // Hidden tabs are not redrawn; catch up from the latest sample
+    if (m_metrics && m_rendering) {
+        renderPage(m_tabWidget->widget(index));
+    }
+}
+
+bool MainWindow::isRendering() const {
+    return isVisible() && !isMinimized();
+}
+
+int MainWindow::updateInterval() const {
+    return m_rendering ? UPDATE_INTERVAL_MS : IDLE_UPDATE_INTERVAL_MS;
+}
+
+void MainWindow::updateVisibility() {
+    bool rendering = isRendering();
+    if (rendering == m_rendering) {
+        return;
+    }
+    m_rendering = rendering;
+
+    // The next tick spans both intervals; the tick clock must not count it late
+    m_tickClock.setPeriod(updateInterval() * 1000ULL);
+    if (m_updateTimer->isActive()) {
+        m_updateTimer->start(updateInterval());
+    }
+
+    // The chart history kept growing while hidden: one redraw catches up
+    if (m_rendering && m_metrics) {
+        renderPage(m_tabWidget->currentWidget());
+    }
+}
+
+void MainWindow::renderPage(QWidget *page) {
+    if (!page) {
+        return;
+    }
+    if (page == m_cpuWidget) {
+        m_cpuWidget->updateData();
+    } else if (page == m_ramWidget) {
+        m_ramWidget->updateData();
+    } else if (page == m_diskWidget) {
+        m_diskWidget->updateData();
+    } else if (page == m_networkWidget) {
+        m_networkWidget->updateData();
+    } else if (page == m_interruptWidget) {
+        m_interruptWidget->updateData();
+    } else if (page == m_numaWidget) {
+        if (m_startup.isReady(m_numaMonitor)) {
+            m_numaWidget->updateData();
+        }
+    } else if (page == m_connectionWidget) {
+        if (m_startup.isReady(m_connectionMonitor)) {
+            m_connectionWidget->updateData();
+        }
+    } else if (page == m_selfWidget) {
+        m_selfWidget->updateData();
+    }
+}
+
+void MainWindow::updatePlaceholders() {
+    // A tab stays a disabled placeholder until its collectors are ready
+    for (int i = 0; i < m_tabWidget->count(); i++) {
+        QWidget *page = m_tabWidget->widget(i);
+        Collector *collector = deferredCollector(page);
+        page->setEnabled(m_metrics && (!collector || m_startup.isReady(collector)));
+    }
+}
+
+void MainWindow::reportStartup() {
+    if (m_firstFrameUs == 0 || m_firstDataUs == 0) {
+        return;
+    }
+    double frameMs = static_cast<double>(m_firstFrameUs - m_startUs) / 1000.0;
+    double dataMs = static_cast<double>(m_firstDataUs - m_startUs) / 1000.0;
+    m_metrics->set(MetricId::StartupFirstFrame, frameMs);
+    m_metrics->set(MetricId::StartupFirstData, dataMs);
+    statusBar()->showMessage(QString("Started: first frame %1, first data %2")
+        .arg(QString::fromStdWString(formatMetric<MetricId::StartupFirstFrame>(frameMs)))
+        .arg(QString::fromStdWString(formatMetric<MetricId::StartupFirstData>(dataMs))),
+        STATUS_TIMEOUT_MS);
 }
 
 void MainWindow::setupUI() {
     m_tabWidget = new QTabWidget(this);
     setCentralWidget(m_tabWidget);
     
-    // Create widgets
-    m_cpuWidget = new CPUWidget(m_cpuMonitor, this);
-    m_ramWidget = new RAMWidget(m_ramMonitor, this);
-    m_diskWidget = new DiskWidget(m_diskMonitor, this);
-    m_networkWidget = new NetworkWidget(m_networkMonitor, this);
-    
-    // Add tabs
-    m_tabWidget->addTab(m_cpuWidget, "CPU");
-    m_tabWidget->addTab(m_ramWidget, "RAM");
-    m_tabWidget->addTab(m_diskWidget, "Disk");
-    m_tabWidget->addTab(m_networkWidget, "Network");
+    // Create widgets and tabs of the enabled collectors
+    if (m_cpuMonitor) {
+        m_cpuWidget = new CPUWidget(m_cpuMonitor, this);
+        m_cpuWidget->setPerfSource(m_perfMonitor);
+        m_cpuWidget->setSchedSource(m_schedMonitor);
+        m_cpuWidget->setProcessSource(m_processMonitor);
+        m_tabWidget->addTab(m_cpuWidget, "CPU");
+    }
+    if (m_ramMonitor) {
+        m_ramWidget = new RAMWidget(m_ramMonitor, this);
+        m_ramWidget->setProcessSource(m_processMonitor);
+        m_tabWidget->addTab(m_ramWidget, "RAM");
+    }
+    if (m_diskMonitor) {
+        m_diskWidget = new DiskWidget(m_diskMonitor, this);
+        m_diskWidget->setProcessSource(m_processMonitor);
+        m_tabWidget->addTab(m_diskWidget, "Disk");
+    }
+    if (m_networkMonitor) {
+        m_networkWidget = new NetworkWidget(m_networkMonitor, this);
+        m_networkWidget->setInterruptSource(m_interruptMonitor);
+        m_networkWidget->setNetStackSource(m_netStackMonitor);
+        m_tabWidget->addTab(m_networkWidget, "Network");
+    }
+    if (m_connectionMonitor) {
+        m_connectionWidget = new ConnectionWidget(m_connectionMonitor, this);
+        m_tabWidget->addTab(m_connectionWidget, "Connections");
+    }
+    if (m_interruptMonitor && m_cpuMonitor) {
+        m_interruptWidget = new InterruptWidget(m_interruptMonitor, m_cpuMonitor, this);
+        m_tabWidget->addTab(m_interruptWidget, "Interrupts");
+    }
+    if (m_numaMonitor) {
+        m_numaWidget = new NumaWidget(m_numaMonitor, this);
+        m_tabWidget->addTab(m_numaWidget, "NUMA");
+    }
+    updatePlaceholders();
+    connect(m_tabWidget, &QTabWidget::currentChanged, this, &MainWindow::tabChanged);
+
+    m_selfWidget = new SelfWidget(this);
+    m_selfWidget->hide();  // Only added as a tab on request
+    m_burstWidget = new BurstWidget(this);
+    m_burstWidget->hide();  // Added as a tab by the first capture
 }
 
 void MainWindow::setupMenuBar() {
@@ -92,6 +395,19 @@ void MainWindow::setupMenuBar() {
     connect(exitAction, &QAction::triggered, this, &MainWindow::exitApplication);
     fileMenu->addAction(exitAction);
     
+    QMenu *viewMenu = menuBar()->addMenu("&View");
+    QAction *selfAction = new QAction("Show &Self Tab", this);
+    selfAction->setCheckable(true);
+    selfAction->setShortcut(QKeySequence("Ctrl+Shift+S"));
+    connect(selfAction, &QAction::toggled, this, &MainWindow::setSelfTabVisible);
+    viewMenu->addAction(selfAction);
+    
+    QMenu *toolsMenu = menuBar()->addMenu("&Tools");
+    QAction *burstAction = new QAction("Capture &Burst", this);
+    burstAction->setShortcut(QKeySequence("Ctrl+B"));
+    connect(burstAction, &QAction::triggered, this, &MainWindow::startBurst);
+    toolsMenu->addAction(burstAction);
+    
     QMenu *helpMenu = menuBar()->addMenu("&Help");
     QAction *aboutAction = new QAction("&About", this);
     connect(aboutAction, &QAction::triggered, this, [this]() {
@@ -123,18 +439,123 @@ void MainWindow::setupSystemTray() {
     m_trayIcon->show();
 }
 
+void MainWindow::setupAlerts() {
+    m_metrics = new MetricTable();
+    m_anomalyDetector = new AnomalyDetector();
+    m_alertEngine = new AlertEngine();
+    m_trayAlertSink = new TrayAlertSink(m_trayIcon);
+    m_alertEngine->addSink(m_trayAlertSink);
+    if (!m_alertLogPath.isEmpty()) {
+        m_alertLog = new std::ofstream(std::filesystem::path(m_alertLogPath.toStdWString()), std::ios::app);
+        if (*m_alertLog) {
+            m_alertLogSink = new StreamAlertSink(*m_alertLog);
+            m_alertEngine->addSink(m_alertLogSink);
+        } else {
+            m_trayIcon->showMessage("Alert log", "Cannot open " + m_alertLogPath,
+                QSystemTrayIcon::Warning, 3000);
+        }
+    }
+    m_burstAlertSink = new BurstAlertSink(m_burstSampler, BurstConfig{BURST_INTERVAL_MS, BURST_WINDOW_MS});
+    m_alertEngine->addSink(m_burstAlertSink);
+
+    // Register fixed series up front so rules bind once; deferred
+    // collectors register once started (see startWatchedCollectors())
+    for (Collector *collector : m_startup.ready()) {
+        collector->registerSeries(*m_metrics);
+    }
+    m_metrics->addSeries(MetricId::TickInterval);
+    m_metrics->addSeries(MetricId::TickSpan);
+    m_metrics->addSeries(MetricId::TickLate);
+    m_metrics->addSeries(MetricId::TickMissed);
+    m_metrics->addSeries(MetricId::StartupFirstFrame);
+    m_metrics->addSeries(MetricId::StartupFirstData);
+    m_anomalyDetector->registerSeries(*m_metrics);
+
+    if (m_cpuWidget) {
+        m_cpuWidget->setAnomalySource(m_anomalyDetector, m_metrics->seriesId(MetricId::CpuTotal));
+    }
+    if (m_networkWidget) {
+        m_networkWidget->setAnomalySource(m_anomalyDetector, m_metrics->seriesId(MetricId::NetDownload),
+                                          m_metrics->seriesId(MetricId::NetUpload));
+    }
+
+    // Rules file next to the executable replaces the default rules
+    std::ifstream rulesFile(
+        QDir(QApplication::applicationDirPath()).filePath("alerts.rules").toStdString());
+    if (rulesFile && m_alertEngine->loadRules(rulesFile) > 0) {
+        return;
+    }
+
+    m_alertEngine->addRule("cpu.total > 90 for 30s hysteresis 10");
+    m_alertEngine->addRule("ram.usage_percent > 90 for 30s hysteresis 5");
+    if (m_diskMonitor) {
+        // No "falling": it only fires on a drop after startup, so a disk
+        // that is already full when the monitor starts would stay silent
+        for (const auto& disk : m_diskMonitor->getDiskInfo()) {
+            std::string series = MetricSchema::seriesName(MetricId::DiskFree, NameTable::utf8(disk.driveLetter));
+            m_alertEngine->addRule(series + " < 5 hysteresis 1");
+        }
+    }
+}
+
+void MainWindow::publishMetrics() {
+    for (Collector *collector : m_startup.ready()) {
+        collector->publish(*m_metrics);
+    }
+
+    const Tick& tick = m_tickClock.current();
+    if (tick.sequence > 1) {
+        m_metrics->set(MetricId::TickInterval, static_cast<double>(tick.intervalUs) / 1000.0);
+    }
+    m_metrics->set(MetricId::TickSpan, static_cast<double>(tick.spanUs) / 1000.0);
+    m_metrics->set(MetricId::TickLate, static_cast<double>(m_tickClock.lateCount()));
+    m_metrics->set(MetricId::TickMissed, static_cast<double>(m_tickClock.missedCount()));
+
+    // Collection cost is exported like any other metric
+    SelfStats::publish(*m_metrics);
+}
+
 void MainWindow::updateMonitors() {
-    // Update all monitors
-    m_cpuMonitor->update();
-    m_ramMonitor->update();
-    m_diskMonitor->update();
-    m_networkMonitor->update();
+    // Stamp the tick, then update all monitors back to back; each rate
+    // uses its source's own sample timestamps
+    m_tickClock.begin();
+    for (Collector *collector : m_startup.ready()) {
+        collector->update();
+    }
+    m_tickClock.end();
+    
+    // Score anomalies and evaluate alert rules against the fresh sample
+    publishMetrics();
+    {
+        static CollectorStats& stats = SelfStats::probe("anomaly.update");
+        ScopedTimer timer(stats);
+        m_anomalyDetector->update(*m_metrics);
+        m_anomalyDetector->publish(*m_metrics);
+    }
+    {
+        static CollectorStats& stats = SelfStats::probe("alerts.evaluate");
+        ScopedTimer timer(stats);
+        m_alertEngine->evaluate(*m_metrics, m_tickClock.elapsedSeconds());
+    }
+    
+    // Captures requested by a signal or started by a "burst" alert rule
+    if (BurstSampler::takeSignalRequest()) {
+        startBurst();
+    }
+    watchBurst();
     
-    // Update all widgets
-    m_cpuWidget->updateData();
-    m_ramWidget->updateData();
-    m_diskWidget->updateData();
-    m_networkWidget->updateData();
+    // Chart history is kept for every tab; only the shown one is redrawn.
+    // RAM, Disk and Interrupt show current values only and keep none
+    const uint64_t tickUs = m_tickClock.current().timestampUs;
+    if (m_cpuWidget) {
+        m_cpuWidget->recordSample(tickUs);
+    }
+    if (m_networkWidget) {
+        m_networkWidget->recordSample(tickUs);
+    }
+    if (m_rendering) {
+        renderPage(m_tabWidget->currentWidget());
+    }
 }
 
 void MainWindow::toggleWindowVisibility() {
@@ -146,6 +567,63 @@ void MainWindow::toggleWindowVisibility() {
     }
 }
 
+void MainWindow::setSelfTabVisible(bool visible) {
+    int index = m_tabWidget->indexOf(m_selfWidget);
+    if (visible && index < 0) {
+        m_tabWidget->addTab(m_selfWidget, "Self");
+        m_selfWidget->updateData();
+    } else if (!visible && index >= 0) {
+        m_tabWidget->removeTab(index);
+        m_selfWidget->hide();
+    }
+}
+
+void MainWindow::startBurst() {
+    if (!m_burstSampler->start(BurstConfig{BURST_INTERVAL_MS, BURST_WINDOW_MS})) {
+        return;
+    }
+    watchBurst();
+}
+
+void MainWindow::watchBurst() {
+    if (!m_burstSampler->isRunning() || m_burstTimer->isActive()) {
+        return;
+    }
+
+    m_burstWidget->setCapturing(BURST_INTERVAL_MS, BURST_WINDOW_MS);
+    if (m_tabWidget->indexOf(m_burstWidget) < 0) {
+        m_tabWidget->addTab(m_burstWidget, "Burst");
+    }
+    m_burstTimer->start(BURST_POLL_MS);
+}
+
+void MainWindow::checkBurst() {
+    if (m_burstSampler->isRunning()) {
+        return;
+    }
+    m_burstTimer->stop();
+
+    BurstRecording recording;
+    if (!m_burstSampler->takeRecording(recording)) {
+        return;
+    }
+
+    // Keep every capture as a recording next to the executable
+    QDir recordings(QApplication::applicationDirPath());
+    recordings.mkpath("recordings");
+    QString path = recordings.filePath("recordings/burst-" +
+        QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss") + ".csv");
+    if (!recording.save(path.toStdString())) {
+        path.clear();
+    }
+
+    m_burstWidget->setRecording(recording, QDir::toNativeSeparators(path));
+    m_tabWidget->setCurrentWidget(m_burstWidget);
+    m_trayIcon->showMessage("Burst capture finished",
+        QString("%1 samples captured").arg(recording.sampleCount()),
+        QSystemTrayIcon::Information, 3000);
+}
+
 void MainWindow::trayIconActivated(QSystemTrayIcon::ActivationReason reason) {
     if (reason == QSystemTrayIcon::DoubleClick) {
         toggleWindowVisibility();
@@ -156,6 +634,32 @@ void MainWindow::exitApplication() {
     QApplication::quit();
 }
 
+void MainWindow::paintEvent(QPaintEvent *event) {
+    QMainWindow::paintEvent(event);
+    if (m_firstFrameUs == 0) {
+        m_firstFrameUs = SystemUtils::monotonicMicros();
+        reportStartup();
+    }
+}
+
+void MainWindow::showEvent(QShowEvent *event) {
+    QMainWindow::showEvent(event);
+    // isVisible() is only final once the event is handled
+    QTimer::singleShot(0, this, &MainWindow::updateVisibility);
+}
+
+void MainWindow::hideEvent(QHideEvent *event) {
+    QMainWindow::hideEvent(event);
+    QTimer::singleShot(0, this, &MainWindow::updateVisibility);
+}
+
+void MainWindow::changeEvent(QEvent *event) {
+    QMainWindow::changeEvent(event);
+    if (event->type() == QEvent::WindowStateChange) {
+        QTimer::singleShot(0, this, &MainWindow::updateVisibility);
+    }
+}
+
 void MainWindow::closeEvent(QCloseEvent *event) {
     if (m_trayIcon->isVisible()) {
         hide();
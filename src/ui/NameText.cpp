@@ -0,0 +1,21 @@
+#include "ui/NameText.h"
+#include <vector>
+
+QString NameText::get(NameId id, const QString& empty) {
+    if (id == NameTable::EMPTY) {
+        return empty;
+    }
+
+    // Null entries are names not converted yet
+    static std::vector<QString> texts;
+    if (id >= texts.size()) {
+        texts.resize(NameTable::size());
+    }
+    if (id >= texts.size()) {
+        return empty;   // Not an interned id
+    }
+    if (texts[id].isNull()) {
+        texts[id] = QString::fromStdWString(NameTable::wide(id));
+    }
+    return texts[id];
+}
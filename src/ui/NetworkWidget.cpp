@@ -1,12 +1,20 @@
 #include "ui/NetworkWidget.h"
 #include "monitors/NetworkMonitor.h"
-#include "utils/SystemUtils.h"
+#include "monitors/InterruptMonitor.h"
+#include "monitors/NetStackMonitor.h"
+#include "core/AnomalyDetector.h"
+#include "core/MetricSchema.h"
 #include <QString>
 
 NetworkWidget::NetworkWidget(NetworkMonitor *monitor, QWidget *parent)
     : QWidget(parent)
     , m_monitor(monitor)
-    , m_maxDataPoints(60)
+    , m_historySeconds(60)
+    , m_anomalyDetector(nullptr)
+    , m_downloadSeriesId(-1)
+    , m_uploadSeriesId(-1)
+    , m_interruptMonitor(nullptr)
+    , m_netStackMonitor(nullptr)
 {
     setupUI();
 }
@@ -25,6 +33,13 @@ void NetworkWidget::setupUI() {
     m_uploadLabel->setStyleSheet("font-size: 18px; font-weight: bold; color: #FF6B6B;");
     layout->addWidget(m_uploadLabel);
     
+    m_softirqLabel = new QLabel(this);
+    m_softirqLabel->setVisible(false);
+    layout->addWidget(m_softirqLabel);
+    
+    m_stackLabel = new QLabel(this);
+    layout->addWidget(m_stackLabel);
+    
     // Setup chart
     m_chart = new QChart();
     m_chart->setTitle("Network Traffic");
@@ -41,9 +56,15 @@ void NetworkWidget::setupUI() {
     m_chart->addSeries(m_downloadSeries);
     m_chart->addSeries(m_uploadSeries);
     
+    m_anomalySeries = new QScatterSeries();
+    m_anomalySeries->setName("Anomaly");
+    m_anomalySeries->setColor(QColor(255, 193, 7));
+    m_anomalySeries->setMarkerSize(10.0);
+    m_chart->addSeries(m_anomalySeries);
+    
     // Setup axes
     m_axisX = new QValueAxis();
-    m_axisX->setRange(0, m_maxDataPoints);
+    m_axisX->setRange(0, m_historySeconds);
     m_axisX->setLabelFormat("%d");
     m_axisX->setTitleText("Time (seconds)");
     
@@ -58,6 +79,8 @@ void NetworkWidget::setupUI() {
     m_downloadSeries->attachAxis(m_axisY);
     m_uploadSeries->attachAxis(m_axisX);
     m_uploadSeries->attachAxis(m_axisY);
+    m_anomalySeries->attachAxis(m_axisX);
+    m_anomalySeries->attachAxis(m_axisY);
     
     m_chartView = new QChartView(m_chart, this);
     m_chartView->setRenderHint(QPainter::Antialiasing);
@@ -66,6 +89,27 @@ void NetworkWidget::setupUI() {
     setLayout(layout);
 }
 
+void NetworkWidget::recordSample(uint64_t timestampUs) {
+    if (!m_monitor || !m_monitor->isInitialized()) {
+        return;
+    }
+    
+    m_downloadPoints.push_back(m_monitor->getTotalDownloadSpeed() / 1024.0);  // Convert to KB/s
+    m_uploadPoints.push_back(m_monitor->getTotalUploadSpeed() / 1024.0);
+    m_downloadAnomalies.push_back(m_anomalyDetector && m_anomalyDetector->isAnomalous(m_downloadSeriesId));
+    m_uploadAnomalies.push_back(m_anomalyDetector && m_anomalyDetector->isAnomalous(m_uploadSeriesId));
+    m_timestamps.push_back(timestampUs);
+    
+    const uint64_t spanUs = static_cast<uint64_t>(m_historySeconds) * 1000000;
+    while (timestampUs - m_timestamps.front() > spanUs) {
+        m_downloadPoints.pop_front();
+        m_uploadPoints.pop_front();
+        m_downloadAnomalies.pop_front();
+        m_uploadAnomalies.pop_front();
+        m_timestamps.pop_front();
+    }
+}
+
 void NetworkWidget::updateData() {
     if (!m_monitor || !m_monitor->isInitialized()) {
         return;
@@ -76,29 +120,87 @@ void NetworkWidget::updateData() {
     
     // Update labels
     m_downloadLabel->setText("Download: " + 
-        QString::fromStdWString(SystemUtils::formatSpeed(downloadSpeed)));
+        QString::fromStdWString(formatMetric<MetricId::NetDownload>(downloadSpeed)));
     m_uploadLabel->setText("Upload: " + 
-        QString::fromStdWString(SystemUtils::formatSpeed(uploadSpeed)));
-    
-    // Update chart
-    m_downloadPoints.push_back(downloadSpeed / 1024.0);  // Convert to KB/s
-    m_uploadPoints.push_back(uploadSpeed / 1024.0);
+        QString::fromStdWString(formatMetric<MetricId::NetUpload>(uploadSpeed)));
+    
+    // Packet processing cost on the CPUs next to the traffic it handles
+    if (m_interruptMonitor && m_interruptMonitor->isInitialized()) {
+        int rx = m_interruptMonitor->findSource("NET_RX");
+        int tx = m_interruptMonitor->findSource("NET_TX");
+        int dpc = m_interruptMonitor->findSource("DPC");
+        if (rx >= 0 || tx >= 0) {
+            m_softirqLabel->setText(QString("Softirq: NET_RX %1/s, NET_TX %2/s")
+                .arg(m_interruptMonitor->getSourceRate(rx), 0, 'f', 0)
+                .arg(m_interruptMonitor->getSourceRate(tx), 0, 'f', 0));
+        } else if (dpc >= 0) {
+            m_softirqLabel->setText(QString("DPC: %1/s")
+                .arg(m_interruptMonitor->getSourceRate(dpc), 0, 'f', 0));
+        }
+        m_softirqLabel->setVisible(rx >= 0 || tx >= 0 || dpc >= 0);
+    }
     
-    if (m_downloadPoints.size() > static_cast<size_t>(m_maxDataPoints)) {
-        m_downloadPoints.pop_front();
-        m_uploadPoints.pop_front();
+    // Interface errors and drops, then protocol counters when available
+    QString stack = QString("Interfaces: %1 errors/s, %2 drops/s")
+        .arg(m_monitor->getTotalErrorRate(), 0, 'f', 0)
+        .arg(m_monitor->getTotalDropRate(), 0, 'f', 0);
+    if (m_netStackMonitor && m_netStackMonitor->isInitialized()) {
+        stack += QString("\nTCP: %1 retransmits/s (%2%), %3 resets/s")
+            .arg(m_netStackMonitor->getRate(NetStackCounters::TcpRetransmits), 0, 'f', 0)
+            .arg(m_netStackMonitor->getRetransmitPercent(), 0, 'f', 2)
+            .arg(m_netStackMonitor->getRate(NetStackCounters::TcpResets), 0, 'f', 0);
+        if (m_netStackMonitor->isAvailable(NetStackCounters::TcpListenOverflows)) {
+            stack += QString(", listen overflows %1/s, drops %2/s, SYN cookies %3/s")
+                .arg(m_netStackMonitor->getRate(NetStackCounters::TcpListenOverflows), 0, 'f', 0)
+                .arg(m_netStackMonitor->getRate(NetStackCounters::TcpListenDrops), 0, 'f', 0)
+                .arg(m_netStackMonitor->getRate(NetStackCounters::TcpSynCookies), 0, 'f', 0);
+        }
+        stack += QString("\nUDP: %1 receive errors/s").arg(
+            m_netStackMonitor->getRate(NetStackCounters::UdpReceiveErrors), 0, 'f', 0);
+        if (m_netStackMonitor->isAvailable(NetStackCounters::UdpBufferErrors)) {
+            stack += QString(" (%1 buffer)").arg(
+                m_netStackMonitor->getRate(NetStackCounters::UdpBufferErrors), 0, 'f', 0);
+        }
+        stack += QString(", IP: %1 reassembly failures/s").arg(
+            m_netStackMonitor->getRate(NetStackCounters::IpReassemblyFailures), 0, 'f', 0);
     }
+    m_stackLabel->setText(stack);
     
+    // Update chart
     m_downloadSeries->clear();
     m_uploadSeries->clear();
+    m_anomalySeries->clear();
     
     double maxSpeed = 1.0;
     for (size_t i = 0; i < m_downloadPoints.size(); i++) {
-        m_downloadSeries->append(i, m_downloadPoints[i]);
-        m_uploadSeries->append(i, m_uploadPoints[i]);
+        // Seconds on the axis, newest point at its right end
+        double x = m_historySeconds
+            - static_cast<double>(m_timestamps.back() - m_timestamps[i]) / 1000000.0;
+        m_downloadSeries->append(x, m_downloadPoints[i]);
+        m_uploadSeries->append(x, m_uploadPoints[i]);
+        if (m_downloadAnomalies[i]) {
+            m_anomalySeries->append(x, m_downloadPoints[i]);
+        }
+        if (m_uploadAnomalies[i]) {
+            m_anomalySeries->append(x, m_uploadPoints[i]);
+        }
         maxSpeed = qMax(maxSpeed, qMax(m_downloadPoints[i], m_uploadPoints[i]));
     }
     
     // Auto-adjust Y axis
     m_axisY->setRange(0, maxSpeed * 1.2);
 }
+
+void NetworkWidget::setAnomalySource(const AnomalyDetector *detector, int downloadSeriesId, int uploadSeriesId) {
+    m_anomalyDetector = detector;
+    m_downloadSeriesId = downloadSeriesId;
+    m_uploadSeriesId = uploadSeriesId;
+}
+
+void NetworkWidget::setInterruptSource(const InterruptMonitor *monitor) {
+    m_interruptMonitor = monitor;
+}
+
+void NetworkWidget::setNetStackSource(const NetStackMonitor *monitor) {
+    m_netStackMonitor = monitor;
+}
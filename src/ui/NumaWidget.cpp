@@ -0,0 +1,93 @@
+#include "ui/NumaWidget.h"
+#include "monitors/NumaMonitor.h"
+#include "utils/SystemUtils.h"
+#include <QHeaderView>
+#include <QString>
+#include <QStringList>
+
+NumaWidget::NumaWidget(NumaMonitor *monitor, QWidget *parent)
+    : QWidget(parent)
+    , m_monitor(monitor)
+{
+    setupUI();
+}
+
+NumaWidget::~NumaWidget() {
+}
+
+void NumaWidget::setupUI() {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    
+    m_topologyLabel = new QLabel("Topology: unknown", this);
+    m_topologyLabel->setStyleSheet("font-size: 18px; font-weight: bold;");
+    layout->addWidget(m_topologyLabel);
+    
+    m_packageLabel = new QLabel(this);
+    layout->addWidget(m_packageLabel);
+    
+    m_tableWidget = new QTableWidget(this);
+    m_tableWidget->setColumnCount(6);
+    m_tableWidget->setHorizontalHeaderLabels({
+        "Node", "CPUs", "CPU %", "Memory Used", "Available", "Remote Allocations"
+    });
+    
+    m_tableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_tableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    
+    layout->addWidget(m_tableWidget);
+    setLayout(layout);
+}
+
+void NumaWidget::updateData() {
+    if (!m_monitor || !m_monitor->isInitialized()) {
+        return;
+    }
+    
+    const CPUTopology& topology = m_monitor->getTopology();
+    m_topologyLabel->setText(QString("%1 socket(s), %2 die(s), %3 node(s), %4 cores, %5 logical CPUs")
+        .arg(topology.packageCount)
+        .arg(topology.dieCount)
+        .arg(topology.nodeCount)
+        .arg(topology.coreCount)
+        .arg(topology.cpuCount()));
+    
+    QStringList packages;
+    for (int package = 0; package < m_monitor->getPackageCount(); package++) {
+        packages << QString("Socket %1: %2%")
+            .arg(package)
+            .arg(m_monitor->getPackageCpuUsage(package), 0, 'f', 1);
+    }
+    m_packageLabel->setText(packages.join("    "));
+    
+    const int nodeCount = m_monitor->getNodeCount();
+    m_tableWidget->setRowCount(nodeCount);
+    const QColor saturatedColor(255, 107, 107, 96);
+    
+    for (int node = 0; node < nodeCount; node++) {
+        double cpuUsage = m_monitor->getNodeCpuUsage(node);
+        double memoryUsage = m_monitor->getNodeMemoryUsagePercent(node);
+        double remote = m_monitor->getNodeRemotePercent(node);
+        
+        m_tableWidget->setItem(node, 0, new QTableWidgetItem(
+            QString("Node %1").arg(node)));
+        m_tableWidget->setItem(node, 1, new QTableWidgetItem(
+            QString::number(m_monitor->getNodeCpuCount(node))));
+        m_tableWidget->setItem(node, 2, new QTableWidgetItem(
+            QString::number(cpuUsage, 'f', 1)));
+        m_tableWidget->setItem(node, 3, new QTableWidgetItem(m_monitor->getNodeTotalMemory(node) > 0
+            ? QString::fromStdWString(SystemUtils::formatPercent(memoryUsage)) : QString("-")));
+        m_tableWidget->setItem(node, 4, new QTableWidgetItem(
+            QString::fromStdWString(SystemUtils::formatBytes(m_monitor->getNodeAvailableMemory(node)))));
+        m_tableWidget->setItem(node, 5, new QTableWidgetItem(remote >= 0.0
+            ? QString::fromStdWString(SystemUtils::formatPercent(remote)) : QString("n/a")));
+        
+        if (cpuUsage >= SATURATED_PERCENT || memoryUsage >= SATURATED_PERCENT) {
+            for (int column = 0; column < m_tableWidget->columnCount(); column++) {
+                m_tableWidget->item(node, column)->setBackground(saturatedColor);
+            }
+        }
+    }
+    
+    m_tableWidget->resizeColumnsToContents();
+}
@@ -1,11 +1,16 @@
 #include "ui/RAMWidget.h"
 #include "monitors/RAMMonitor.h"
+#include "monitors/ProcessMonitor.h"
+#include "core/MetricSchema.h"
+#include "ui/NameText.h"
 #include "utils/SystemUtils.h"
+#include <QHeaderView>
 #include <QString>
 
 RAMWidget::RAMWidget(RAMMonitor *monitor, QWidget *parent)
     : QWidget(parent)
     , m_monitor(monitor)
+    , m_processMonitor(nullptr)
 {
     setupUI();
 }
@@ -41,7 +46,21 @@ void RAMWidget::setupUI() {
     m_detailsLabel->setStyleSheet("font-size: 12px;");
     layout->addWidget(m_detailsLabel);
     
-    layout->addStretch();
+    // Memory by process: proportional memory splits shared pages fairly
+    m_processLabel = new QLabel("", this);
+    m_processLabel->setStyleSheet("font-size: 12px;");
+    layout->addWidget(m_processLabel);
+    
+    m_processTable = new QTableWidget(this);
+    m_processTable->setColumnCount(7);
+    m_processTable->setHorizontalHeaderLabels({
+        "Process", "PID", "Resident", "Proportional", "Private", "Swapped", "Walked"
+    });
+    m_processTable->horizontalHeader()->setStretchLastSection(true);
+    m_processTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_processTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    layout->addWidget(m_processTable);
+    
     setLayout(layout);
 }
 
@@ -56,7 +75,7 @@ void RAMWidget::updateData() {
     uint64_t availableRAM = m_monitor->getAvailablePhysicalMemory();
     
     // Update labels
-    QString usageStr = QString::fromStdWString(SystemUtils::formatPercent(usagePercent, 1));
+    QString usageStr = QString::fromStdWString(formatMetric<MetricId::RamUsage>(usagePercent));
     m_usageLabel->setText("RAM Usage: " + usageStr);
     
     m_progressBar->setValue(static_cast<int>(usagePercent));
@@ -71,4 +90,41 @@ void RAMWidget::updateData() {
             .arg(usedStr)
             .arg(availableStr)
     );
+    
+    if (!m_processMonitor || !m_processMonitor->isInitialized()) {
+        return;
+    }
+    
+    m_processLabel->setText(QString("Processes: %1 | Page walks: %2 this update, %3 due")
+        .arg(m_processMonitor->getProcessCount())
+        .arg(m_processMonitor->getMemoryRefreshCount())
+        .arg(m_processMonitor->getMemoryBacklog()));
+    
+    const auto& processes = m_processMonitor->getTopMemory();
+    m_processTable->setRowCount(static_cast<int>(processes.size()));
+    
+    for (size_t i = 0; i < processes.size(); i++) {
+        const ProcessMemoryInfo& process = processes[i];
+        int row = static_cast<int>(i);
+        auto bytes = [&process](uint64_t value) {
+            return process.detailed ? QString::fromStdWString(SystemUtils::formatBytes(value)) : QString("-");
+        };
+        
+        m_processTable->setItem(row, 0, new QTableWidgetItem(
+            NameText::get(process.name, "-")));
+        m_processTable->setItem(row, 1, new QTableWidgetItem(QString::number(process.pid)));
+        m_processTable->setItem(row, 2, new QTableWidgetItem(
+            QString::fromStdWString(SystemUtils::formatBytes(process.memory.resident))));
+        m_processTable->setItem(row, 3, new QTableWidgetItem(bytes(process.memory.proportional)));
+        m_processTable->setItem(row, 4, new QTableWidgetItem(bytes(process.memory.unique)));
+        m_processTable->setItem(row, 5, new QTableWidgetItem(bytes(process.memory.swapped)));
+        m_processTable->setItem(row, 6, new QTableWidgetItem(
+            process.detailed ? QString("%1 s ago").arg(process.ageMs / 1000) : QString("pending")));
+    }
+    
+    m_processTable->resizeColumnsToContents();
+}
+
+void RAMWidget::setProcessSource(const ProcessMonitor *monitor) {
+    m_processMonitor = monitor;
 }
@@ -0,0 +1,57 @@
+#include "ui/SelfWidget.h"
+#include "core/SelfStats.h"
+#include "utils/SystemUtils.h"
+#include <QHeaderView>
+#include <QString>
+
+SelfWidget::SelfWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    setupUI();
+}
+
+SelfWidget::~SelfWidget() {
+}
+
+void SelfWidget::setupUI() {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    
+    m_tableWidget = new QTableWidget(this);
+    m_tableWidget->setColumnCount(7);
+    m_tableWidget->setHorizontalHeaderLabels({
+        "Probe", "Calls", "Mean (us)", "p99 (us)", "Max (us)", "OS Calls", "Bytes Read"
+    });
+    
+    m_tableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_tableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    
+    layout->addWidget(m_tableWidget);
+    setLayout(layout);
+}
+
+void SelfWidget::updateData() {
+    const auto probes = SelfStats::probes();
+    m_tableWidget->setRowCount(static_cast<int>(probes.size()));
+    
+    for (size_t i = 0; i < probes.size(); i++) {
+        const auto& stats = *probes[i];
+        
+        m_tableWidget->setItem(i, 0, new QTableWidgetItem(
+            QString::fromStdString(stats.name())));
+        m_tableWidget->setItem(i, 1, new QTableWidgetItem(
+            QString::number(stats.callCount())));
+        m_tableWidget->setItem(i, 2, new QTableWidgetItem(
+            QString::number(stats.meanMicros(), 'f', 1)));
+        m_tableWidget->setItem(i, 3, new QTableWidgetItem(
+            QString::number(stats.percentileMicros(99.0), 'f', 0)));
+        m_tableWidget->setItem(i, 4, new QTableWidgetItem(
+            QString::number(stats.maxMicros(), 'f', 0)));
+        m_tableWidget->setItem(i, 5, new QTableWidgetItem(
+            QString::number(stats.syscallCount())));
+        m_tableWidget->setItem(i, 6, new QTableWidgetItem(
+            QString::fromStdWString(SystemUtils::formatBytes(stats.bytesRead()))));
+    }
+    
+    m_tableWidget->resizeColumnsToContents();
+}
@@ -0,0 +1,24 @@
+#include "ui/TrayAlertSink.h"
+#include "core/MetricSchema.h"
+#include <QSystemTrayIcon>
+#include <QString>
+
+TrayAlertSink::TrayAlertSink(QSystemTrayIcon *trayIcon)
+    : m_trayIcon(trayIcon)
+{
+}
+
+void TrayAlertSink::onAlert(const AlertEvent& event) {
+    if (!m_trayIcon || !m_trayIcon->isVisible()) {
+        return;
+    }
+
+    QString title = event.raised ? "Alert" : "Alert cleared";
+    QString message = QString("%1\n%2 = %3")
+        .arg(QString::fromStdString(event.ruleName))
+        .arg(QString::fromStdString(event.series))
+        .arg(QString::fromStdWString(MetricSchema::format(event.unit, event.value)));
+
+    m_trayIcon->showMessage(title, message,
+        event.raised ? QSystemTrayIcon::Warning : QSystemTrayIcon::Information);
+}
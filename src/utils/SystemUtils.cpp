@@ -3,6 +3,11 @@
 #include <iomanip>
 #include <codecvt>
 #include <locale>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <chrono>
+#endif
 
 std::wstring SystemUtils::formatBytes(uint64_t bytes, int precision) {
     const wchar_t* units[] = {L"B", L"KB", L"MB", L"GB", L"TB"};
@@ -53,3 +58,21 @@ std::wstring SystemUtils::stringToWstring(const std::string& str) {
     std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
     return converter.from_bytes(str);
 }
+
+uint64_t SystemUtils::monotonicMicros() {
+#ifdef _WIN32
+    static const uint64_t frequency = [] {
+        LARGE_INTEGER value;
+        QueryPerformanceFrequency(&value);
+        return static_cast<uint64_t>(value.QuadPart);
+    }();
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    uint64_t ticks = static_cast<uint64_t>(counter.QuadPart);
+    // Split to avoid overflowing ticks * 1000000
+    return ticks / frequency * 1000000 + ticks % frequency * 1000000 / frequency + 1;
+#else
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count()) + 1;
+#endif
+}
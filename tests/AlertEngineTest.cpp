@@ -0,0 +1,146 @@
+#include "core/AlertEngine.h"
+#include "core/MetricTable.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << std::endl;
+            g_failures++;
+        }
+    }
+
+    /**
+     * @brief Sink remembering the events it received
+     */
+    class RecordingSink : public AlertSink {
+    public:
+        void onAlert(const AlertEvent& event) override {
+            events.push_back(event);
+        }
+
+        std::vector<AlertEvent> events;
+    };
+
+    /**
+     * @brief Feed one value per second to a single rule
+     * @return Events raised or cleared
+     */
+    std::vector<AlertEvent> replay(const std::string& rule, const std::vector<double>& values) {
+        MetricTable metrics;
+        int id = metrics.addSeries("disk.C:.free_percent", MetricUnit::Percent);
+        AlertEngine engine;
+        RecordingSink sink;
+        engine.addSink(&sink);
+        engine.addRule(rule);
+
+        double nowSec = 0.0;
+        for (double value : values) {
+            metrics.set(id, value);
+            engine.evaluate(metrics, nowSec);
+            nowSec += 1.0;
+        }
+        return sink.events;
+    }
+
+    void testFallingPlateau() {
+        // Crosses the threshold once, then stays flat: the drop that
+        // started the violation is the trend
+        auto events = replay("disk.C:.free_percent < 5 falling", {6.0, 4.9, 4.9, 4.9});
+        check(events.size() == 1 && events[0].raised, "falling fires on the crossing tick");
+
+        events = replay("disk.C:.free_percent < 5 falling for 2s", {6.0, 4.9, 4.9, 4.9});
+        check(events.size() == 1 && events[0].timestamp == 3.0, "falling with duration survives a plateau");
+    }
+
+    void testFallingNeedsDrop() {
+        // Already below the threshold at the first sample and never lower
+        auto events = replay("disk.C:.free_percent < 5 falling", {4.0, 4.0, 4.0});
+        check(events.empty(), "flat series below threshold is not falling");
+
+        events = replay("disk.C:.free_percent < 5 falling", {4.0, 4.0, 3.5});
+        check(events.size() == 1 && events[0].timestamp == 2.0, "falling fires once the value drops");
+    }
+
+    void testRisingPlateau() {
+        auto events = replay("disk.C:.free_percent > 90 rising for 3s", {80.0, 95.0, 95.0, 95.0, 95.0});
+        check(events.size() == 1 && events[0].timestamp == 4.0, "rising with duration survives a plateau");
+
+        events = replay("disk.C:.free_percent > 90 rising", {95.0, 80.0, 95.0});
+        check(events.size() == 1 && events[0].timestamp == 2.0, "rising restarts after the value recovers");
+    }
+
+    void testHysteresis() {
+        auto events = replay("disk.C:.free_percent < 5 falling hysteresis 1", {6.0, 4.0, 4.0, 5.5, 6.5});
+        check(events.size() == 2 && events[0].raised && !events[1].raised && events[1].timestamp == 4.0,
+              "clears only past the hysteresis band");
+    }
+
+    void testInterfaceLabel() {
+        // Windows interface descriptions have spaces and parentheses
+        MetricTable metrics;
+        int id = metrics.addSeries(MetricId::NetInterfaceDownload, "Intel(R) Ethernet Connection I219-V");
+        check(metrics.seriesName(id) == "net.Intel_R_Ethernet_Connection_I219-V.download",
+              "interface label is sanitized");
+
+        AlertEngine engine;
+        RecordingSink sink;
+        engine.addSink(&sink);
+        check(engine.addRule("net.Intel_R_Ethernet_Connection_I219-V.download > 1000"),
+              "rule on a sanitized interface parses");
+        metrics.set(id, 5000.0);
+        engine.evaluate(metrics, 0.0);
+        check(sink.events.size() == 1, "rule on a sanitized interface binds");
+    }
+
+    void testReferencesSeries() {
+        AlertEngine engine;
+        engine.addRule("numa.node.0.cpu > 90");
+        check(engine.referencesSeries("numa."), "rule on a numa series is found by prefix");
+        check(!engine.referencesSeries("net.connections"), "unwatched prefix is not referenced");
+    }
+
+    void testStreamSink() {
+        // The unit a real event carries for this series
+        MetricTable metrics;
+        int id = metrics.addSeries(MetricId::DiskFree, "C:");
+
+        std::ostringstream out;
+        StreamAlertSink sink(out);
+        AlertEvent event;
+        event.ruleName = "disk.C:.free_percent < 5 falling";
+        event.series = "disk.C:.free_percent";
+        event.value = 4.5;
+        event.unit = metrics.seriesUnit(id);
+        event.threshold = 5.0;
+        event.raised = true;
+        event.timestamp = 0.0;
+        event.burst = false;
+        sink.onAlert(event);
+        check(event.unit == MetricUnit::Percent, "free space series is a percent");
+        check(out.str() == "ALERT disk.C:.free_percent < 5 falling (disk.C:.free_percent = 4.5%, threshold 5.0%)\n",
+              "stream sink writes one line per event");
+    }
+}
+
+int main() {
+    testFallingPlateau();
+    testFallingNeedsDrop();
+    testRisingPlateau();
+    testHysteresis();
+    testInterfaceLabel();
+    testReferencesSeries();
+    testStreamSink();
+
+    if (g_failures > 0) {
+        std::cerr << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All alert engine checks passed" << std::endl;
+    return 0;
+}